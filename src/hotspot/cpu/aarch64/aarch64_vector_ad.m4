@@ -196,7 +196,7 @@ source %{
         }
         break;
       case Op_ExpandV:
-        if (UseSVE < 2 || is_subword_type(bt)) {
+        if (UseSVE < 2) {
           return false;
         }
         break;
@@ -4905,6 +4905,7 @@ instruct vcompressS(vReg dst, vReg src, pReg pg,
 %}
 
 instruct vexpand(vReg dst, vReg src, pRegGov pg) %{
+  predicate(!is_subword_type(Matcher::vector_element_basic_type(n)));
   match(Set dst (ExpandV src pg));
   effect(TEMP_DEF dst);
   format %{ "vexpand $dst, $pg, $src" %}
@@ -4933,6 +4934,35 @@ instruct vexpand(vReg dst, vReg src, pRegGov pg) %{
   ins_pipe(pipe_slow);
 %}
 
+instruct vexpandB(vReg dst, vReg src, pRegGov pg, vReg tmp1, vReg tmp2,
+                  vReg tmp3, vReg tmp4, pReg ptmp, pRegGov pgtmp) %{
+  predicate(Matcher::vector_element_basic_type(n) == T_BYTE);
+  match(Set dst (ExpandV src pg));
+  effect(TEMP_DEF dst, TEMP tmp1, TEMP tmp2, TEMP tmp3, TEMP tmp4, TEMP ptmp, TEMP pgtmp);
+  format %{ "vexpandB $dst, $pg, $src\t# KILL $tmp1, $tmp2, $tmp3, $tmp4, $ptmp, $pgtmp" %}
+  ins_encode %{
+    assert(UseSVE == 2, "must be sve2");
+    __ sve_expand_byte($dst$$FloatRegister, $src$$FloatRegister, $pg$$PRegister,
+                       $tmp1$$FloatRegister, $tmp2$$FloatRegister,
+                       $tmp3$$FloatRegister, $tmp4$$FloatRegister,
+                       $ptmp$$PRegister, $pgtmp$$PRegister);
+  %}
+  ins_pipe(pipe_slow);
+%}
+
+instruct vexpandS(vReg dst, vReg src, pRegGov pg, vReg tmp1, vReg tmp2, pRegGov pgtmp) %{
+  predicate(Matcher::vector_element_basic_type(n) == T_SHORT);
+  match(Set dst (ExpandV src pg));
+  effect(TEMP_DEF dst, TEMP tmp1, TEMP tmp2, TEMP pgtmp);
+  format %{ "vexpandS $dst, $pg, $src\t# KILL $tmp1, $tmp2, $pgtmp" %}
+  ins_encode %{
+    assert(UseSVE == 2, "must be sve2");
+    __ sve_expand_short($dst$$FloatRegister, $src$$FloatRegister, $pg$$PRegister,
+                        $tmp1$$FloatRegister, $tmp2$$FloatRegister, $pgtmp$$PRegister);
+  %}
+  ins_pipe(pipe_slow);
+%}
+
 // ------------------------------ Vector signum --------------------------------
 
 // Vector Math.signum
@@ -2079,6 +2079,107 @@ void C2_MacroAssembler::sve_compress_byte(FloatRegister dst, FloatRegister src,
   sve_orr(dst, dst, vtmp1);
 }
 
+// Compute the TBL indices that expand the active S-sized lanes of pgtmp:
+// dst[i] = (number of active lanes below i) + offset for active lanes.
+// The value of inactive lanes is unspecified and must be masked by the caller.
+void C2_MacroAssembler::sve_expand_index_int(FloatRegister dst, PRegister pgtmp,
+                                             Register offset, FloatRegister vtmp) {
+  assert(pgtmp->is_governing(), "This register has to be a governing predicate register");
+  assert_different_registers(dst, vtmp);
+
+  // dst = 0 0 0 0
+  sve_dup(dst, S, 0);
+  // Count the active lanes up to and including each active lane.
+  // pgtmp = 1 0 1 1, dst = 3 0 2 1
+  sve_histcnt(dst, S, pgtmp, dst, dst);
+  // dst = 2 -1 1 0
+  sve_sub(dst, S, 1);
+  if (offset != noreg) {
+    sve_dup(vtmp, S, offset);
+    sve_add(dst, S, pgtmp, vtmp);
+  }
+}
+
+// Unpack the lowest-numbered elements of src into the active elements of dst, under
+// the control of mask. Inactive elements of dst are set to zero. HISTCNT only supports
+// word and doubleword elements, so the TBL indices are computed on INT halves.
+// Clobbers: rscratch1, rscratch2
+// Preserves: src, mask
+void C2_MacroAssembler::sve_expand_short(FloatRegister dst, FloatRegister src, PRegister mask,
+                                         FloatRegister vtmp1, FloatRegister vtmp2,
+                                         PRegister pgtmp) {
+  assert(pgtmp->is_governing(), "This register has to be a governing predicate register");
+  assert_different_registers(dst, src, vtmp1, vtmp2);
+  assert_different_registers(mask, pgtmp);
+
+  // Example input:   src   = 8888 7777 6666 5555 4444 3333 2222 1111
+  //                  mask  = 0001 0000 0000 0001 0001 0000 0001 0001
+  // Expected result: dst   = 5555 0000 0000 4444 3333 0000 2222 1111
+
+  // Indices of the lowest half.
+  // vtmp1 = 00000002 ffffffff 00000001 00000000
+  sve_punpklo(pgtmp, mask);
+  sve_expand_index_int(vtmp1, pgtmp, noreg, dst);
+  // rscratch1 = 3
+  sve_cntp(rscratch1, S, ptrue, pgtmp);
+
+  // Indices of the highest half, following the active elements of the lowest half.
+  // vtmp2 = 00000004 ffffffff ffffffff 00000003
+  sve_punpkhi(pgtmp, mask);
+  sve_expand_index_int(vtmp2, pgtmp, rscratch1, dst);
+
+  // Narrow the indices to type SHORT.
+  // vtmp1 = 0004 ffff ffff 0003 0002 ffff 0001 0000
+  sve_uzp1(vtmp1, H, vtmp1, vtmp2);
+  // dst = 5555 xxxx xxxx 4444 3333 xxxx 2222 1111
+  sve_tbl(dst, H, src, vtmp1);
+  // dst = 5555 0000 0000 4444 3333 0000 2222 1111
+  sve_dup(vtmp2, H, 0);
+  sve_sel(dst, H, mask, dst, vtmp2);
+}
+
+// Clobbers: rscratch1, rscratch2
+// Preserves: src, mask
+void C2_MacroAssembler::sve_expand_byte(FloatRegister dst, FloatRegister src, PRegister mask,
+                                        FloatRegister vtmp1, FloatRegister vtmp2,
+                                        FloatRegister vtmp3, FloatRegister vtmp4,
+                                        PRegister ptmp, PRegister pgtmp) {
+  assert(pgtmp->is_governing(), "This register has to be a governing predicate register");
+  assert_different_registers(dst, src, vtmp1, vtmp2, vtmp3, vtmp4);
+  assert_different_registers(mask, ptmp, pgtmp);
+
+  // Same as sve_expand_short, but the TBL indices are computed on the four
+  // INT quarters of the vector, each following the active elements of the
+  // quarters below it.
+  sve_punpklo(ptmp, mask);
+  sve_punpklo(pgtmp, ptmp);
+  sve_expand_index_int(vtmp1, pgtmp, noreg, dst);
+  sve_cntp(rscratch1, S, ptrue, pgtmp);
+
+  sve_punpkhi(pgtmp, ptmp);
+  sve_expand_index_int(vtmp2, pgtmp, rscratch1, dst);
+  sve_cntp(rscratch2, S, ptrue, pgtmp);
+  add(rscratch1, rscratch1, rscratch2);
+
+  sve_punpkhi(ptmp, mask);
+  sve_punpklo(pgtmp, ptmp);
+  sve_expand_index_int(vtmp3, pgtmp, rscratch1, dst);
+  sve_cntp(rscratch2, S, ptrue, pgtmp);
+  add(rscratch1, rscratch1, rscratch2);
+
+  sve_punpkhi(pgtmp, ptmp);
+  sve_expand_index_int(vtmp4, pgtmp, rscratch1, dst);
+
+  // Narrow the indices to type BYTE.
+  sve_uzp1(vtmp1, H, vtmp1, vtmp2);
+  sve_uzp1(vtmp3, H, vtmp3, vtmp4);
+  sve_uzp1(vtmp1, B, vtmp1, vtmp3);
+  sve_tbl(dst, B, src, vtmp1);
+  // An index of an inactive element may be in range, so clear them explicitly.
+  sve_dup(vtmp2, B, 0);
+  sve_sel(dst, B, mask, dst, vtmp2);
+}
+
 void C2_MacroAssembler::neon_reverse_bits(FloatRegister dst, FloatRegister src, BasicType bt, bool isQ) {
   assert(bt == T_BYTE || bt == T_SHORT || bt == T_INT || bt == T_LONG, "unsupported basic type");
   SIMD_Arrangement size = isQ ? T16B : T8B;
@@ -166,6 +166,18 @@
                           FloatRegister vtmp1, FloatRegister vtmp2,
                           PRegister pgtmp);
 
+  void sve_expand_index_int(FloatRegister dst, PRegister pgtmp,
+                            Register offset, FloatRegister vtmp);
+
+  void sve_expand_byte(FloatRegister dst, FloatRegister src, PRegister mask,
+                       FloatRegister vtmp1, FloatRegister vtmp2,
+                       FloatRegister vtmp3, FloatRegister vtmp4,
+                       PRegister ptmp, PRegister pgtmp);
+
+  void sve_expand_short(FloatRegister dst, FloatRegister src, PRegister mask,
+                        FloatRegister vtmp1, FloatRegister vtmp2,
+                        PRegister pgtmp);
+
   void neon_reverse_bits(FloatRegister dst, FloatRegister src, BasicType bt, bool isQ);
 
   void neon_reverse_bytes(FloatRegister dst, FloatRegister src, BasicType bt, bool isQ);
@@ -213,10 +213,11 @@ void VM_Version::initialize() {
     }
   }
 
-  // Neoverse N1, N2 and V1
+  // Neoverse N1, N2, V1 and V2
   if (_cpu == CPU_ARM && ((_model == 0xd0c || _model2 == 0xd0c)
                           || (_model == 0xd49 || _model2 == 0xd49)
-                          || (_model == 0xd40 || _model2 == 0xd40))) {
+                          || (_model == 0xd40 || _model2 == 0xd40)
+                          || (_model == 0xd4f || _model2 == 0xd4f))) {
     if (FLAG_IS_DEFAULT(UseSIMDForMemoryOps)) {
       FLAG_SET_DEFAULT(UseSIMDForMemoryOps, true);
     }
@@ -254,8 +255,9 @@ void VM_Version::initialize() {
     FLAG_SET_DEFAULT(UseCRC32, false);
   }
 
-  // Neoverse V1
-  if (_cpu == CPU_ARM && (_model == 0xd40 || _model2 == 0xd40)) {
+  // Neoverse V1 and V2
+  if (_cpu == CPU_ARM && ((_model == 0xd40 || _model2 == 0xd40)
+                          || (_model == 0xd4f || _model2 == 0xd4f))) {
     if (FLAG_IS_DEFAULT(UseCryptoPmullForCRC32)) {
       FLAG_SET_DEFAULT(UseCryptoPmullForCRC32, true);
     }
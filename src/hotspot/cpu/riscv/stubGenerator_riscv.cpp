@@ -2941,6 +2941,68 @@ class StubGenerator: public StubCodeGenerator {
     return entry;
   }
 
+  // Arguments:
+  //
+  // Input:
+  //   c_rarg0   - obja address
+  //   c_rarg1   - objb address
+  //   c_rarg2   - length
+  //   c_rarg3   - log2 of the array index scale
+  //
+  // Output:
+  //   x10       - index of the first mismatching element, or -1 if the
+  //               ranges are equal
+  //
+  address generate_vectorizedMismatch() {
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", "vectorizedMismatch");
+    address entry = __ pc();
+
+    Label loop, mismatch, done;
+
+    Register obja   = c_rarg0;
+    Register objb   = c_rarg1;
+    Register length = c_rarg2;
+    Register scale  = c_rarg3;
+
+    // obja is in x10 too, so the result only goes there on exit.
+    Register result = t2;
+    Register cnt    = c_rarg4;
+    Register pos    = c_rarg5;
+    Register vl     = t0;
+    Register idx    = t1;
+
+    // Compare bytes, the element size only matters for the returned index.
+    __ sll(cnt, length, scale);
+    __ mv(pos, zr);
+    __ mv(result, -1);
+    __ beqz(cnt, done);
+
+    __ bind(loop);
+    __ vsetvli(vl, cnt, Assembler::e8, Assembler::m4);
+    __ vle8_v(v4, obja);
+    __ vle8_v(v8, objb);
+    __ vmsne_vv(v0, v4, v8);
+    __ vfirst_m(idx, v0);
+    __ bgez(idx, mismatch);
+    __ add(obja, obja, vl);
+    __ add(objb, objb, vl);
+    __ add(pos, pos, vl);
+    __ sub(cnt, cnt, vl);
+    __ bnez(cnt, loop);
+    __ j(done);
+
+    __ bind(mismatch);
+    __ add(pos, pos, idx);
+    __ srl(result, pos, scale);
+
+    __ bind(done);
+    __ mv(x10, result);
+    __ ret();
+
+    return entry;
+  }
+
   // Arguments:
   //
   // Input:
@@ -4550,6 +4612,10 @@ class StubGenerator: public StubCodeGenerator {
     }
 #endif // COMPILER2
 
+    if (UseVectorizedMismatchIntrinsic) {
+      StubRoutines::_vectorizedMismatch = generate_vectorizedMismatch();
+    }
+
     generate_compare_long_strings();
 
     generate_string_indexof_stubs();
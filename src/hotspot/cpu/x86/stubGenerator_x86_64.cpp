@@ -4129,6 +4129,11 @@ void StubGenerator::generate_compiler_stubs() {
     StubRoutines::_sha512_implCompressMB = generate_sha512_implCompress(true, "sha512_implCompressMB");
   }
 
+  if (UseSHA3Intrinsics) {
+    StubRoutines::_sha3_implCompress = generate_sha3_implCompress(false, "sha3_implCompress");
+    StubRoutines::_sha3_implCompressMB = generate_sha3_implCompress(true, "sha3_implCompressMB");
+  }
+
   if (UseBASE64Intrinsics) {
     if(VM_Version::supports_avx2()) {
       StubRoutines::x86::_avx2_shuffle_base64 = base64_avx2_shuffle_addr();
@@ -392,6 +392,9 @@ class StubGenerator: public StubCodeGenerator {
   // Ghash single and multi block operations using AVX instructions
   address generate_avx_ghash_processBlocks();
 
+  // SHA3 single and multi block operations using AVX-512 instructions
+  address generate_sha3_implCompress(bool multi_block, const char *name);
+
   // ChaCha20 stubs and helper functions
   void generate_chacha_stubs();
   address generate_chacha20Block_avx();
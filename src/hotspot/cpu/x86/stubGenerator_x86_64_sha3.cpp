@@ -0,0 +1,277 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "macroAssembler_x86.hpp"
+#include "stubGenerator_x86_64.hpp"
+
+#define __ _masm->
+
+// The Keccak-f[1600] permutation below keeps one 64-bit lane of the state in
+// the low quadword of each of xmm0-xmm24 and uses xmm25-xmm31 as temporaries,
+// the same register allocation as the aarch64 SHA3 stub. The three input XOR,
+// the bit clear and XOR of the chi step and the rotates are done with the
+// AVX-512 vpternlogq and vprolq instructions on 128-bit vectors.
+
+ATTRIBUTE_ALIGNED(64) static const uint64_t sha3_round_consts[24] = {
+  0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808AULL,
+  0x8000000080008000ULL, 0x000000000000808BULL, 0x0000000080000001ULL,
+  0x8000000080008081ULL, 0x8000000000008009ULL, 0x000000000000008AULL,
+  0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000AULL,
+  0x000000008000808BULL, 0x800000000000008BULL, 0x8000000000008089ULL,
+  0x8000000000008003ULL, 0x8000000000008002ULL, 0x8000000000000080ULL,
+  0x000000000000800AULL, 0x800000008000000AULL, 0x8000000080008081ULL,
+  0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL
+};
+
+static XMMRegister lane(int i) {
+  return as_XMMRegister(i);
+}
+
+// d = a ^ b ^ c
+static void eor3(MacroAssembler* _masm, int d, int a, int b, int c) {
+  if (d != a) {
+    __ evmovdquq(lane(d), lane(a), Assembler::AVX_128bit);
+  }
+  __ vpternlogq(lane(d), 0x96, lane(b), lane(c), Assembler::AVX_128bit);
+}
+
+// d = a ^ rol(b, 1), clobbers xmm31
+static void rax1(MacroAssembler* _masm, int d, int a, int b) {
+  __ evprolq(xmm31, lane(b), 1, Assembler::AVX_128bit);
+  __ vpxorq(lane(d), lane(a), xmm31, Assembler::AVX_128bit);
+}
+
+// d = rol(a ^ b, shift)
+static void xar(MacroAssembler* _masm, int d, int a, int b, int shift) {
+  __ vpxorq(lane(d), lane(a), lane(b), Assembler::AVX_128bit);
+  __ evprolq(lane(d), lane(d), shift, Assembler::AVX_128bit);
+}
+
+// d = a ^ (b & ~c)
+static void bcax(MacroAssembler* _masm, int d, int a, int b, int c) {
+  if (d != a) {
+    assert(d != b && d != c, "must not overlap");
+    __ evmovdquq(lane(d), lane(a), Assembler::AVX_128bit);
+  }
+  __ vpternlogq(lane(d), 0xB4, lane(b), lane(c), Assembler::AVX_128bit);
+}
+
+// XOR the lanes [from, to) of the next block into the state.
+static void absorb(MacroAssembler* _masm, Register buf, int from, int to) {
+  for (int i = from; i < to; i++) {
+    __ movq(xmm25, Address(buf, i * 8));
+    __ vpxorq(lane(i), lane(i), xmm25, Assembler::AVX_128bit);
+  }
+}
+
+// Arguments:
+//
+// Inputs:
+//   c_rarg0   - byte[]  source+offset
+//   c_rarg1   - long[]  SHA3.state
+//   c_rarg2   - int     block_size
+//   c_rarg3   - int     offset
+//   c_rarg4   - int     limit
+//
+address StubGenerator::generate_sha3_implCompress(bool multi_block, const char *name) {
+  assert(VM_Version::supports_evex() && VM_Version::supports_avx512vl(), "");
+  __ align(CodeEntryAlignment);
+  StubCodeMark mark(this, "StubRoutines", name);
+  address start = __ pc();
+
+  const Register buf        = c_rarg0;
+  const Register state      = c_rarg1;
+  const Register block_size = c_rarg2;
+  const Register ofs        = c_rarg3;
+#ifndef _WIN64
+  const Register limit      = c_rarg4;
+#else
+  const Address limit_mem(rbp, 6 * wordSize); // limit is on stack on Win64
+  const Register limit      = r10;
+#endif
+  const Register round_consts = rax;
+  const Register rounds       = r11;
+
+  Label sha3_loop, rounds24_loop, absorbed;
+
+#ifdef _WIN64
+  const int xmm_size = wordSize * 2;
+  const int xmm_spill_size = xmm_size * 10;
+#endif
+
+  __ enter();
+
+#ifdef _WIN64
+  if (multi_block) {
+    __ movl(limit, limit_mem);
+  }
+  // xmm6-xmm15 are callee-saved on Win64
+  __ subptr(rsp, xmm_spill_size);
+  for (int i = 6; i <= 15; i++) {
+    __ movdqu(Address(rsp, (i - 6) * xmm_size), as_XMMRegister(i));
+  }
+#endif
+  // zero-extend the int argument, it is added to buf below
+  __ movl(block_size, block_size);
+
+  // load state
+  for (int i = 0; i < 25; i++) {
+    __ movq(lane(i), Address(state, i * 8));
+  }
+
+  __ BIND(sha3_loop);
+
+  // 24 keccak rounds
+  __ movl(rounds, 24);
+
+  // load round_constants base
+  __ lea(round_consts, ExternalAddress((address) sha3_round_consts));
+
+  // load input: block_size is 72 (SHA3-512), 104 (SHA3-384), 136 (SHA3-256 or SHAKE256),
+  // 144 (SHA3-224) or 168 (SHAKE128) bytes
+  absorb(_masm, buf, 0, 9);
+  __ cmpl(block_size, 72);
+  __ jcc(Assembler::equal, absorbed);
+  absorb(_masm, buf, 9, 13);
+  __ cmpl(block_size, 104);
+  __ jcc(Assembler::equal, absorbed);
+  absorb(_masm, buf, 13, 17);
+  __ cmpl(block_size, 136);
+  __ jcc(Assembler::equal, absorbed);
+  absorb(_masm, buf, 17, 18);
+  __ cmpl(block_size, 144);
+  __ jcc(Assembler::equal, absorbed);
+  absorb(_masm, buf, 18, 21);
+
+  __ BIND(absorbed);
+  __ align(OptoLoopAlignment);
+  __ BIND(rounds24_loop);
+
+  eor3(_masm, 29, 4, 9, 14);
+  eor3(_masm, 26, 1, 6, 11);
+  eor3(_masm, 28, 3, 8, 13);
+  eor3(_masm, 25, 0, 5, 10);
+  eor3(_masm, 27, 2, 7, 12);
+  eor3(_masm, 29, 29, 19, 24);
+  eor3(_masm, 26, 26, 16, 21);
+  eor3(_masm, 28, 28, 18, 23);
+  eor3(_masm, 25, 25, 15, 20);
+  eor3(_masm, 27, 27, 17, 22);
+
+  rax1(_masm, 30, 29, 26);
+  rax1(_masm, 26, 26, 28);
+  rax1(_masm, 28, 28, 25);
+  rax1(_masm, 25, 25, 27);
+  rax1(_masm, 27, 27, 29);
+
+  __ vpxorq(xmm0, xmm0, xmm30, Assembler::AVX_128bit);
+  xar(_masm, 29, 1,  25, 1);
+  xar(_masm, 1,  6,  25, 44);
+  xar(_masm, 6,  9,  28, 20);
+  xar(_masm, 9,  22, 26, 61);
+  xar(_masm, 22, 14, 28, 39);
+  xar(_masm, 14, 20, 30, 18);
+  xar(_masm, 31, 2,  26, 62);
+  xar(_masm, 2,  12, 26, 43);
+  xar(_masm, 12, 13, 27, 25);
+  xar(_masm, 13, 19, 28, 8);
+  xar(_masm, 19, 23, 27, 56);
+  xar(_masm, 23, 15, 30, 41);
+  xar(_masm, 15, 4,  28, 27);
+  xar(_masm, 28, 24, 28, 14);
+  xar(_masm, 24, 21, 25, 2);
+  xar(_masm, 8,  8,  27, 55);
+  xar(_masm, 4,  16, 25, 45);
+  xar(_masm, 16, 5,  30, 36);
+  xar(_masm, 5,  3,  27, 28);
+  xar(_masm, 27, 18, 27, 21);
+  xar(_masm, 3,  17, 26, 15);
+  xar(_masm, 25, 11, 25, 10);
+  xar(_masm, 26, 7,  26, 6);
+  xar(_masm, 30, 10, 30, 3);
+
+  bcax(_masm, 20, 31, 22, 8);
+  bcax(_masm, 21, 8,  23, 22);
+  bcax(_masm, 22, 22, 24, 23);
+  bcax(_masm, 23, 23, 31, 24);
+  bcax(_masm, 24, 24, 8,  31);
+
+  __ movq(xmm31, Address(round_consts, 0));
+  __ addptr(round_consts, 8);
+
+  bcax(_masm, 17, 25, 19, 3);
+  bcax(_masm, 18, 3,  15, 19);
+  bcax(_masm, 19, 19, 16, 15);
+  bcax(_masm, 15, 15, 25, 16);
+  bcax(_masm, 16, 16, 3,  25);
+
+  bcax(_masm, 10, 29, 12, 26);
+  bcax(_masm, 11, 26, 13, 12);
+  bcax(_masm, 12, 12, 14, 13);
+  bcax(_masm, 13, 13, 29, 14);
+  bcax(_masm, 14, 14, 26, 29);
+
+  bcax(_masm, 7, 30, 9,  4);
+  bcax(_masm, 8, 4,  5,  9);
+  bcax(_masm, 9, 9,  6,  5);
+  bcax(_masm, 5, 5,  30, 6);
+  bcax(_masm, 6, 6,  4,  30);
+
+  bcax(_masm, 3, 27, 0,  28);
+  bcax(_masm, 4, 28, 1,  0);
+  bcax(_masm, 0, 0,  2,  1);
+  bcax(_masm, 1, 1,  27, 2);
+  bcax(_masm, 2, 2,  28, 27);
+
+  __ vpxorq(xmm0, xmm0, xmm31, Assembler::AVX_128bit);
+
+  __ decrementl(rounds);
+  __ jcc(Assembler::notZero, rounds24_loop);
+
+  if (multi_block) {
+    __ addptr(buf, block_size);
+    __ addl(ofs, block_size);
+    __ cmpl(ofs, limit);
+    __ jcc(Assembler::lessEqual, sha3_loop);
+    __ movl(rax, ofs); // return ofs
+  }
+
+  // store state
+  for (int i = 0; i < 25; i++) {
+    __ movq(Address(state, i * 8), lane(i));
+  }
+
+#ifdef _WIN64
+  for (int i = 6; i <= 15; i++) {
+    __ movdqu(as_XMMRegister(i), Address(rsp, (i - 6) * xmm_size));
+  }
+  __ addptr(rsp, xmm_spill_size);
+#endif
+  __ vzeroupper();
+  __ leave();
+  __ ret(0);
+
+  return start;
+}
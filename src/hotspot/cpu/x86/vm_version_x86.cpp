@@ -1212,12 +1212,17 @@ void VM_Version::get_processor_features() {
     FLAG_SET_DEFAULT(UseSHA512Intrinsics, false);
   }
 
-  if (UseSHA3Intrinsics) {
+  // The SHA-3 stubs are not enabled by default, only with -XX:+UseSHA3Intrinsics.
+  bool supports_sha3 = false;
+#ifdef _LP64
+  supports_sha3 = UseSHA && supports_evex() && supports_avx512vl();
+#endif
+  if (UseSHA3Intrinsics && !supports_sha3) {
     warning("Intrinsics for SHA3-224, SHA3-256, SHA3-384 and SHA3-512 crypto hash functions not available on this CPU.");
     FLAG_SET_DEFAULT(UseSHA3Intrinsics, false);
   }
 
-  if (!(UseSHA1Intrinsics || UseSHA256Intrinsics || UseSHA512Intrinsics)) {
+  if (!(UseSHA1Intrinsics || UseSHA256Intrinsics || UseSHA512Intrinsics || UseSHA3Intrinsics)) {
     FLAG_SET_DEFAULT(UseSHA, false);
   }
 
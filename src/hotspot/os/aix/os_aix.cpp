@@ -265,6 +265,10 @@ julong os::available_memory() {
   return Aix::available_memory();
 }
 
+double os::memory_pressure() {
+  return -1.0;
+}
+
 julong os::Aix::available_memory() {
   // Avoid expensive API call here, as returned value will always be null.
   if (os::Aix::on_pase()) {
@@ -1868,6 +1872,10 @@ bool os::remove_stack_guard_pages(char* addr, size_t size) {
 void os::pd_realign_memory(char *addr, size_t bytes, size_t alignment_hint) {
 }
 
+size_t os::pd_pretouch_memory(void* first, void* last, size_t page_size) {
+  return page_size;
+}
+
 void os::pd_free_memory(char *addr, size_t bytes, size_t alignment_hint) {
 }
 
@@ -26,6 +26,9 @@
 #include "utilities/globalDefinitions.hpp"
 
 void ZNUMA::pd_initialize() {
+  // The memory domain backing an address cannot be queried here, so pages
+  // could not be attributed to their node. Without that, NUMA-aware page
+  // placement would only pretend to be enabled.
   _enabled = false;
 }
 
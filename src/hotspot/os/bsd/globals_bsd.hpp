@@ -41,6 +41,9 @@
                                                     \
   product(bool, UseSHM, false,                      \
           "Use SYSV shared memory for large pages") \
+                                                    \
+  product(bool, UseContainerSupport, true,          \
+          "Enable detection of jail and rctl resource limits") \
   AARCH64_ONLY(develop(bool, AssertWXAtThreadSync, false,               \
           "Conservatively check W^X thread state at possible safepoint" \
           "or handshake"))
@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/sysctl.h>
+#ifdef __FreeBSD__
+#include <sys/rctl.h>
+#endif
+#include "runtime/globals.hpp"
+#include "runtime/os.hpp"
+#include "logging/log.hpp"
+#include "os_bsd.hpp"
+#include "osContainer_bsd.hpp"
+
+bool  OSContainer::_is_initialized   = false;
+bool  OSContainer::_is_containerized = false;
+bool  OSContainer::_is_jailed        = false;
+
+#ifdef __FreeBSD__
+
+// Large enough for the limits of a heavily configured jail.
+static const size_t RCTL_BUFFER_SIZE = 8 * K;
+
+// Find the lowest enforced limit for 'resource' among the rctl rules that
+// apply to this process. Rules have the form
+//   subject:subject-id:resource:action=amount[/per]
+// If 'racct_subject' is not null it receives the subject whose usage is
+// accounted against the limit, e.g. "jail:name".
+static jlong rctl_limit(const char* resource, char* racct_subject, size_t subject_len) {
+  char filter[64];
+  char rules[RCTL_BUFFER_SIZE];
+  jio_snprintf(filter, sizeof(filter), "process:%d", getpid());
+  if (rctl_get_limits(filter, strlen(filter) + 1, rules, sizeof(rules)) != 0) {
+    log_debug(os, container)("rctl_get_limits failed: %s", os::strerror(errno));
+    return OSCONTAINER_ERROR;
+  }
+
+  jlong limit = -1;
+  char* saveptr = nullptr;
+  for (char* rule = strtok_r(rules, ",", &saveptr); rule != nullptr;
+       rule = strtok_r(nullptr, ",", &saveptr)) {
+    char subject[32];
+    char subject_id[64];
+    char res[32];
+    char action[32];
+    jlong amount;
+    char per[32] = "";
+    int matched = sscanf(rule, "%31[^:]:%63[^:]:%31[^:]:%31[^=]=" JLONG_FORMAT "/%31s",
+                         subject, subject_id, res, action, &amount, per);
+    if (matched < 5 || strcmp(res, resource) != 0) {
+      continue;
+    }
+    // log and devctl rules only report, they do not limit the process.
+    if (strcmp(action, "log") == 0 || strcmp(action, "devctl") == 0) {
+      continue;
+    }
+    if (limit == -1 || amount < limit) {
+      limit = amount;
+      if (racct_subject != nullptr) {
+        if (matched < 6) {
+          // Usage is accounted against the subject of the rule itself.
+          jio_snprintf(racct_subject, subject_len, "%s:%s", subject, subject_id);
+        } else if (strcmp(per, "user") == 0) {
+          jio_snprintf(racct_subject, subject_len, "user:%d", (int)getuid());
+        } else {
+          // Accounted per process, or per jail or login class containing
+          // this process; the process usage is the closest we can tell.
+          jio_snprintf(racct_subject, subject_len, "process:%d", getpid());
+        }
+      }
+    }
+  }
+  return limit;
+}
+
+// The last value read for a resource. Like CachedMetric on Linux, limits
+// are unlikely to change, but are re-read after a short grace time to
+// remain responsive to rule changes. Usage is cached for the same time, so
+// that frequent queries do not each pay for the rctl system calls.
+class CachedRctlValue {
+ private:
+  volatile jlong _value;
+  volatile jlong _next_check_counter;
+
+ public:
+  constexpr CachedRctlValue() : _value(-1), _next_check_counter(min_jlong) {}
+
+  bool should_check_value() const {
+    return os::elapsed_counter() > _next_check_counter;
+  }
+  jlong value() const { return _value; }
+  void set_value(jlong value, jlong timeout) {
+    _value = value;
+    _next_check_counter = os::elapsed_counter() + timeout;
+  }
+};
+
+static CachedRctlValue _memory_limit;
+static CachedRctlValue _memory_usage;
+static CachedRctlValue _cpu_limit;
+
+static jlong cached_rctl_limit(CachedRctlValue* cache, const char* resource) {
+  if (!cache->should_check_value()) {
+    jlong limit = cache->value();
+    log_trace(os, container)("rctl %s limit (cached): " JLONG_FORMAT, resource, limit);
+    return limit;
+  }
+  jlong limit = rctl_limit(resource, nullptr, 0);
+  cache->set_value(limit, OSCONTAINER_CACHE_TIMEOUT);
+  return limit;
+}
+
+// Read the current usage of 'resource' for 'subject' from racct.
+static jlong racct_usage(const char* subject, const char* resource) {
+  char usage[RCTL_BUFFER_SIZE];
+  if (rctl_get_racct(subject, strlen(subject) + 1, usage, sizeof(usage)) != 0) {
+    log_debug(os, container)("rctl_get_racct failed: %s", os::strerror(errno));
+    return OSCONTAINER_ERROR;
+  }
+  size_t len = strlen(resource);
+  char* saveptr = nullptr;
+  for (char* item = strtok_r(usage, ",", &saveptr); item != nullptr;
+       item = strtok_r(nullptr, ",", &saveptr)) {
+    if (strncmp(item, resource, len) == 0 && item[len] == '=') {
+      jlong value;
+      if (sscanf(item + len + 1, JLONG_FORMAT, &value) == 1) {
+        return value;
+      }
+    }
+  }
+  return OSCONTAINER_ERROR;
+}
+
+#endif // __FreeBSD__
+
+/* init
+ *
+ * Initialize the container support and determine if
+ * we are running in a jail or under rctl limits.
+ */
+void OSContainer::init() {
+  assert(!_is_initialized, "Initializing OSContainer more than once");
+
+  _is_initialized = true;
+  _is_containerized = false;
+
+  log_trace(os, container)("OSContainer::init: Initializing Container Support");
+  if (!UseContainerSupport) {
+    log_trace(os, container)("Container Support not enabled");
+    return;
+  }
+
+#ifdef __FreeBSD__
+  int jailed = 0;
+  size_t len = sizeof(jailed);
+  if (sysctlbyname("security.jail.jailed", &jailed, &len, nullptr, 0) == 0) {
+    _is_jailed = jailed != 0;
+  }
+
+  // rctl_get_limits fails with ENOSYS when resource accounting is
+  // disabled (kern.racct.enable=0), in which case no limits are enforced.
+  jlong mem_limit = cached_rctl_limit(&_memory_limit, "memoryuse");
+  jlong cpu_limit = cached_rctl_limit(&_cpu_limit, "pcpu");
+  if (mem_limit == OSCONTAINER_ERROR && cpu_limit == OSCONTAINER_ERROR && !_is_jailed) {
+    return;
+  }
+  if (mem_limit <= 0 && cpu_limit <= 0 && !_is_jailed) {
+    log_trace(os, container)("No rctl limits apply to this process");
+    return;
+  }
+
+  _is_containerized = true;
+  log_debug(os, container)("Detected %s, memory limit: " JLONG_FORMAT ", cpu limit: " JLONG_FORMAT "%%",
+                           container_type(), mem_limit, cpu_limit);
+#endif
+}
+
+const char * OSContainer::container_type() {
+  return _is_jailed ? "jail" : "rctl";
+}
+
+jlong OSContainer::memory_limit_in_bytes() {
+  assert(_is_containerized, "not containerized");
+#ifdef __FreeBSD__
+  return cached_rctl_limit(&_memory_limit, "memoryuse");
+#else
+  return OSCONTAINER_ERROR;
+#endif
+}
+
+jlong OSContainer::memory_usage_in_bytes() {
+  assert(_is_containerized, "not containerized");
+#ifdef __FreeBSD__
+  if (!_memory_usage.should_check_value()) {
+    jlong usage = _memory_usage.value();
+    log_trace(os, container)("rctl memoryuse usage (cached): " JLONG_FORMAT, usage);
+    return usage;
+  }
+  jlong usage = OSCONTAINER_ERROR;
+  // Only look for the accounting subject if there is a limit at all.
+  if (cached_rctl_limit(&_memory_limit, "memoryuse") > 0) {
+    char subject[128];
+    if (rctl_limit("memoryuse", subject, sizeof(subject)) > 0) {
+      usage = racct_usage(subject, "memoryuse");
+    }
+  }
+  _memory_usage.set_value(usage, OSCONTAINER_CACHE_TIMEOUT);
+  return usage;
+#else
+  return OSCONTAINER_ERROR;
+#endif
+}
+
+int OSContainer::cpu_limit_percent() {
+  assert(_is_containerized, "not containerized");
+#ifdef __FreeBSD__
+  jlong pcpu = cached_rctl_limit(&_cpu_limit, "pcpu");
+  return pcpu > 0 ? (int)MIN2(pcpu, (jlong)max_jint) : -1;
+#else
+  return -1;
+#endif
+}
+
+int OSContainer::active_processor_count() {
+  int pcpu = cpu_limit_percent();
+  if (pcpu <= 0) {
+    return -1;
+  }
+  // Round up, a limit of 150% allows two CPUs to be partially used.
+  return MAX2((pcpu + 99) / 100, 1);
+}
+
+void OSContainer::print_container_helper(outputStream* st, jlong j, const char* metrics) {
+  st->print("%s: ", metrics);
+  if (j > 0) {
+    if (j >= 1024) {
+      st->print_cr(UINT64_FORMAT " k", uint64_t(j) / K);
+    } else {
+      st->print_cr(UINT64_FORMAT, uint64_t(j));
+    }
+  } else {
+    st->print_cr("%s", j == OSCONTAINER_ERROR ? "not supported" : "unlimited");
+  }
+}
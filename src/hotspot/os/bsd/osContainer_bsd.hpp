@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef OS_BSD_OSCONTAINER_BSD_HPP
+#define OS_BSD_OSCONTAINER_BSD_HPP
+
+#include "memory/allStatic.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/ostream.hpp"
+
+#define OSCONTAINER_ERROR (-2)
+
+// 20ms timeout between re-reads of the rctl values, in elapsed_counter ticks
+#define OSCONTAINER_CACHE_TIMEOUT (NANOSECS_PER_SEC/50)
+
+// Resource limits of a FreeBSD jail or of rctl(8) rules that apply to
+// this process. Memory limits come from "memoryuse" rules, CPU limits
+// from "pcpu" rules; CPU affinity is handled by os::active_processor_count().
+class OSContainer: AllStatic {
+
+ private:
+  static bool   _is_initialized;
+  static bool   _is_containerized;
+  static bool   _is_jailed;
+
+ public:
+  static void init();
+  static void print_container_helper(outputStream* st, jlong j, const char* metrics);
+
+  static inline bool is_containerized();
+  static const char * container_type();
+
+  static jlong memory_limit_in_bytes();
+  static jlong memory_usage_in_bytes();
+
+  // Number of CPUs the pcpu limit allows, or -1 if unlimited.
+  static int active_processor_count();
+  // The pcpu limit in percent of a single CPU, or -1 if unlimited.
+  static int cpu_limit_percent();
+};
+
+inline bool OSContainer::is_containerized() {
+  return _is_containerized;
+}
+
+#endif // OS_BSD_OSCONTAINER_BSD_HPP
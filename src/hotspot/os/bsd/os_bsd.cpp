@@ -36,6 +36,7 @@
 #include "memory/allocation.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "os_bsd.inline.hpp"
+#include "osContainer_bsd.hpp"
 #include "os_posix.inline.hpp"
 #include "prims/jniFastGetField.hpp"
 #include "prims/jvm_misc.hpp"
@@ -106,6 +107,8 @@
 
 #ifdef __FreeBSD__
   #include <pthread_np.h>
+  #include <sched.h>
+  #include <sys/domainset.h>
   #include <sys/link_elf.h>
   #include <vm/vm_param.h>
 #endif
@@ -155,6 +158,8 @@ volatile uint64_t         os::Bsd::_max_abstime   = 0;
 int (*os::Bsd::_getcpuclockid)(pthread_t, clockid_t *) = &pthread_getcpuclockid;
 #endif
 pthread_t os::Bsd::_main_thread;
+GrowableArray<int>* os::Bsd::_cpu_to_node = nullptr;
+int os::Bsd::_numa_domain_count = 1;
 
 #if defined(__APPLE__) && defined(__x86_64__)
 static const int processor_id_unassigned = -1;
@@ -175,8 +180,22 @@ julong os::free_memory() {
   return Bsd::available_memory();
 }
 
+double os::memory_pressure() {
+  return -1.0;
+}
+
 // available here means free
 julong os::Bsd::available_memory() {
+  if (OSContainer::is_containerized()) {
+    jlong mem_limit = OSContainer::memory_limit_in_bytes();
+    jlong mem_usage;
+    if (mem_limit > 0 && (mem_usage = OSContainer::memory_usage_in_bytes()) > 0) {
+      julong avail_mem = mem_limit > mem_usage ? (julong)mem_limit - (julong)mem_usage : 0;
+      log_trace(os)("available container memory: " JULONG_FORMAT, avail_mem);
+      return avail_mem;
+    }
+  }
+
   uint64_t available = physical_memory() >> 2;
 #ifdef __APPLE__
   mach_msg_type_number_t count = HOST_VM_INFO64_COUNT;
@@ -229,6 +248,14 @@ void os::Bsd::print_uptime_info(outputStream* st) {
 }
 
 julong os::physical_memory() {
+  if (OSContainer::is_containerized()) {
+    jlong mem_limit;
+    if ((mem_limit = OSContainer::memory_limit_in_bytes()) > 0 &&
+        (julong)mem_limit < Bsd::physical_memory()) {
+      log_trace(os)("total container memory: " JLONG_FORMAT, mem_limit);
+      return mem_limit;
+    }
+  }
   return Bsd::physical_memory();
 }
 
@@ -1441,6 +1468,19 @@ void os::print_os_info(outputStream* st) {
   os::Posix::print_load_average(st);
   st->cr();
 
+  if (OSContainer::is_containerized()) {
+    st->print_cr("container (%s) information:", OSContainer::container_type());
+    OSContainer::print_container_helper(st, OSContainer::memory_limit_in_bytes(), "memory_limit_in_bytes");
+    OSContainer::print_container_helper(st, OSContainer::memory_usage_in_bytes(), "memory_usage_in_bytes");
+    int pcpu = OSContainer::cpu_limit_percent();
+    if (pcpu > 0) {
+      st->print_cr("cpu_limit: %d%%", pcpu);
+    } else {
+      st->print_cr("cpu_limit: unlimited");
+    }
+    st->cr();
+  }
+
   VM_Version::print_platform_virtualization_info(st);
 }
 
@@ -1740,10 +1780,19 @@ void os::pd_commit_memory_or_exit(char* addr, size_t size,
 void os::pd_realign_memory(char *addr, size_t bytes, size_t alignment_hint) {
 }
 
+size_t os::pd_pretouch_memory(void* first, void* last, size_t page_size) {
+  return page_size;
+}
+
 void os::pd_free_memory(char *addr, size_t bytes, size_t alignment_hint) {
   ::madvise(addr, bytes, MADV_DONTNEED);
 }
 
+// FreeBSD has no interface to bind an address range to a memory domain.
+// Instead the process runs with a first-touch domain policy (see numa_init()),
+// so pages are placed on the domain of the thread that first touches them.
+// MutableNUMASpace and G1NUMA hand out node-local memory to threads running
+// on that node, which makes first-touch placement equivalent to binding.
 void os::numa_make_global(char *addr, size_t bytes) {
 }
 
@@ -1753,29 +1802,122 @@ void os::numa_make_local(char *addr, size_t bytes, int lgrp_hint) {
 bool os::numa_topology_changed()   { return false; }
 
 size_t os::numa_get_groups_num() {
-  return 1;
+  return Bsd::numa_domain_count();
 }
 
 int os::numa_get_group_id() {
+  int cpu_id = Bsd::sched_getcpu();
+  if (cpu_id != -1) {
+    int lgrp_id = Bsd::get_node_by_cpu(cpu_id);
+    if (lgrp_id != -1) {
+      return lgrp_id;
+    }
+  }
   return 0;
 }
 
 size_t os::numa_get_leaf_groups(int *ids, size_t size) {
-  if (size > 0) {
-    ids[0] = 0;
-    return 1;
+  size_t n = MIN2((size_t)Bsd::numa_domain_count(), size);
+  for (size_t i = 0; i < n; i++) {
+    ids[i] = (int)i;
   }
-  return 0;
+  return n;
 }
 
 int os::numa_get_group_id_for_address(const void* address) {
-  return 0;
+  // The domain backing a page cannot be queried from user space.
+  return -1;
 }
 
 bool os::numa_get_group_ids_for_range(const void** addresses, int* lgrp_ids, size_t count) {
   return false;
 }
 
+int os::Bsd::sched_getcpu() {
+#if defined(__FreeBSD__) && __FreeBSD_version >= 1301000
+  return ::sched_getcpu();
+#else
+  return -1;
+#endif
+}
+
+int os::Bsd::get_node_by_cpu(int cpu_id) {
+  if (cpu_to_node() != nullptr && cpu_id >= 0 && cpu_id < cpu_to_node()->length()) {
+    return cpu_to_node()->at(cpu_id);
+  }
+  return -1;
+}
+
+void os::Bsd::rebuild_cpu_to_node_map() {
+#ifdef __FreeBSD__
+  int cpu_num = processor_count();
+  cpu_to_node()->clear();
+  cpu_to_node()->at_put_grow(cpu_num - 1, 0, 0);
+
+  for (int domain = 0; domain < _numa_domain_count; domain++) {
+    cpuset_t mask;
+    if (cpuset_getaffinity(CPU_LEVEL_WHICH, CPU_WHICH_DOMAIN, domain,
+                           sizeof(mask), &mask) != 0) {
+      continue;
+    }
+    for (int cpu = 0; cpu < cpu_num && cpu < CPU_SETSIZE; cpu++) {
+      if (CPU_ISSET(cpu, &mask)) {
+        cpu_to_node()->at_put(cpu, domain);
+      }
+    }
+  }
+#endif
+}
+
+bool os::Bsd::numa_init() {
+#ifdef __FreeBSD__
+  int ndomains = 0;
+  size_t len = sizeof(ndomains);
+  if (sysctlbyname("vm.ndomains", &ndomains, &len, nullptr, 0) != 0 || ndomains <= 1) {
+    return false;
+  }
+
+  // Only use the domains this process is allowed to allocate from. If the
+  // process has been restricted to a single domain there is nothing to gain.
+  domainset_t domains;
+  int policy;
+  if (cpuset_getdomain(CPU_LEVEL_WHICH, CPU_WHICH_PID, -1, sizeof(domains),
+                       &domains, &policy) != 0) {
+    log_info(os)("cpuset_getdomain failed: %s", os::strerror(errno));
+    return false;
+  }
+  int allowed = 0;
+  for (int domain = 0; domain < ndomains; domain++) {
+    if (DOMAINSET_ISSET(domain, &domains)) {
+      allowed++;
+    }
+  }
+  if (allowed != ndomains) {
+    log_info(os)("Process is restricted to %d of %d memory domains, disabling NUMA", allowed, ndomains);
+    return false;
+  }
+
+  // Place pages on the domain of the thread that first touches them. The
+  // policy is inherited by all threads created after this point.
+  if (policy != DOMAINSET_POLICY_FIRSTTOUCH &&
+      cpuset_setdomain(CPU_LEVEL_WHICH, CPU_WHICH_PID, -1, sizeof(domains),
+                       &domains, DOMAINSET_POLICY_FIRSTTOUCH) != 0) {
+    log_info(os)("cpuset_setdomain failed: %s", os::strerror(errno));
+    return false;
+  }
+
+  _numa_domain_count = ndomains;
+  _cpu_to_node = new (mtInternal) GrowableArray<int>(0, mtInternal);
+  rebuild_cpu_to_node_map();
+
+  log_info(os)("UseNUMA is enabled and invoked in 'first-touch' mode."
+               " Heap will be configured using %d NUMA memory domains", ndomains);
+  return true;
+#else
+  return false;
+#endif
+}
+
 char *os::scan_pages(char *start, char* end, page_info* page_expected, page_info* page_found) {
   return end;
 }
@@ -1809,8 +1951,19 @@ bool os::remove_stack_guard_pages(char* addr, size_t size) {
 // function returns null to indicate failure.
 static char* anon_mmap(char* requested_addr, size_t bytes, bool exec) {
   // MAP_FIXED is intentionally left out, to leave existing mappings intact.
-  const int flags = MAP_PRIVATE | MAP_NORESERVE | MAP_ANONYMOUS
+  int flags = MAP_PRIVATE | MAP_NORESERVE | MAP_ANONYMOUS
       MACOS_ONLY(| (exec ? MAP_JIT : 0));
+#ifdef MAP_ALIGNED_SUPER
+  // Let the kernel pick a superpage aligned address for reservations that
+  // can be backed by superpages. The large page size is 0 until
+  // os::large_page_init() has run, reservations made before that are
+  // not affected.
+  const size_t large_page_size = os::large_page_size();
+  if (UseLargePages && large_page_size != 0 &&
+      requested_addr == nullptr && bytes >= large_page_size) {
+    flags |= MAP_ALIGNED_SUPER;
+  }
+#endif
 
   // Map reserved/uncommitted pages PROT_NONE so we fail early if we
   // touch an uncommitted page. Otherwise, the read/write might
@@ -1880,7 +2033,85 @@ bool os::Bsd::hugetlbfs_sanity_check(bool warn, size_t page_size) {
 
 static size_t _large_page_size = 0;
 
+// On FreeBSD large pages are provided by transparent superpage promotion:
+// physically contiguous reservations backing a suitably aligned, fully
+// populated range are promoted to superpages by the pmap layer. There is
+// no pool to reserve from, so large pages can be committed and uncommitted
+// on demand like small pages and os::reserve_memory_special() is not used.
 void os::large_page_init() {
+  if (!UseLargePages) {
+    return;
+  }
+
+#ifdef __FreeBSD__
+  int pg_ps_enabled = 0;
+  size_t len = sizeof(pg_ps_enabled);
+  if (sysctlbyname("vm.pmap.pg_ps_enabled", &pg_ps_enabled, &len, nullptr, 0) != 0 ||
+      pg_ps_enabled == 0) {
+    if (!FLAG_IS_DEFAULT(UseLargePages)) {
+      log_warning(pagesize)("UseLargePages disabled, superpages are not enabled (vm.pmap.pg_ps_enabled=0).");
+    }
+    UseLargePages = false;
+    return;
+  }
+
+  size_t sizes[MAXPAGESIZES];
+  int n = getpagesizes(sizes, MAXPAGESIZES);
+  os::PageSizes all_large_pages;
+  for (int i = 0; i < n; i++) {
+    if (sizes[i] > os::vm_page_size()) {
+      all_large_pages.add(sizes[i]);
+    }
+  }
+  if (all_large_pages.smallest() == 0) {
+    if (!FLAG_IS_DEFAULT(UseLargePages)) {
+      log_warning(pagesize)("UseLargePages disabled, no superpage sizes are supported by the operating system.");
+    }
+    UseLargePages = false;
+    return;
+  }
+
+  // The smallest superpage size is the default large page size. Larger
+  // superpage sizes are only used when explicitly asked for with
+  // LargePageSizeInBytes.
+  const size_t default_large_page_size = all_large_pages.smallest();
+  if (FLAG_IS_DEFAULT(LargePageSizeInBytes) ||
+      LargePageSizeInBytes == 0 ||
+      LargePageSizeInBytes == default_large_page_size) {
+    _large_page_size = default_large_page_size;
+    log_info(pagesize)("Using the default large page size: " SIZE_FORMAT "%s",
+                       byte_size_in_exact_unit(_large_page_size),
+                       exact_unit_for_byte_size(_large_page_size));
+  } else if (all_large_pages.contains(LargePageSizeInBytes)) {
+    _large_page_size = LargePageSizeInBytes;
+    log_info(pagesize)("Overriding default large page size (" SIZE_FORMAT "%s) "
+                       "using LargePageSizeInBytes: " SIZE_FORMAT "%s",
+                       byte_size_in_exact_unit(default_large_page_size),
+                       exact_unit_for_byte_size(default_large_page_size),
+                       byte_size_in_exact_unit(_large_page_size),
+                       exact_unit_for_byte_size(_large_page_size));
+  } else {
+    _large_page_size = default_large_page_size;
+    log_info(pagesize)("LargePageSizeInBytes is not a valid large page size (" SIZE_FORMAT "%s) "
+                       "using the default large page size: " SIZE_FORMAT "%s",
+                       byte_size_in_exact_unit(LargePageSizeInBytes),
+                       exact_unit_for_byte_size(LargePageSizeInBytes),
+                       byte_size_in_exact_unit(_large_page_size),
+                       exact_unit_for_byte_size(_large_page_size));
+  }
+
+  // Populate _page_sizes with large page sizes less than or equal to
+  // _large_page_size.
+  for (size_t page_size = _large_page_size; page_size != 0;
+         page_size = all_large_pages.next_smaller(page_size)) {
+    _page_sizes.add(page_size);
+  }
+#else
+  if (!FLAG_IS_DEFAULT(UseLargePages)) {
+    log_warning(pagesize)("UseLargePages disabled, not supported on this operating system.");
+  }
+  UseLargePages = false;
+#endif
 }
 
 
@@ -1899,13 +2130,12 @@ size_t os::large_page_size() {
 }
 
 bool os::can_commit_large_page_memory() {
-  // Does not matter, we do not support huge pages.
-  return false;
+  // Superpages are promoted transparently, committing works as for small pages.
+  return UseLargePages;
 }
 
 bool os::can_execute_large_page_memory() {
-  // Does not matter, we do not support huge pages.
-  return false;
+  return UseLargePages;
 }
 
 char* os::pd_attempt_map_memory_to_file_at(char* requested_addr, size_t bytes, int file_desc) {
@@ -2086,6 +2316,10 @@ void os::init(void) {
   os::Posix::init();
 }
 
+void os::pd_init_container_support() {
+  OSContainer::init();
+}
+
 // To install functions for atexit system call
 extern "C" {
   static void perfMemory_exit_helper() {
@@ -2111,8 +2345,10 @@ jint os::init_2(void) {
     return JNI_ERR;
   }
 
-  // Not supported.
-  FLAG_SET_ERGO(UseNUMA, false);
+  if (UseNUMA && !Bsd::numa_init()) {
+    FLAG_SET_ERGO(UseNUMA, false);
+  }
+  // Interleaving of address ranges is not supported.
   FLAG_SET_ERGO(UseNUMAInterleaving, false);
 
   if (MaxFDLimit) {
@@ -2181,6 +2417,7 @@ int os::active_processor_count() {
     return ActiveProcessorCount;
   }
 
+  int active_cpus = _processor_count;
 #ifdef __FreeBSD__
   int online_cpus = 0;
   cpuset_t mask;
@@ -2188,14 +2425,24 @@ int os::active_processor_count() {
       &mask) == 0)
     for (u_int i = 0; i < sizeof(mask) / sizeof(long); i++)
       online_cpus += __builtin_popcountl(((long *)&mask)[i]);
-  if (online_cpus > 0 && online_cpus <= _processor_count)
-    return online_cpus;
-  online_cpus = sysconf(_SC_NPROCESSORS_ONLN);
-  if (online_cpus >= 1)
-    return online_cpus;
+  if (online_cpus > 0 && online_cpus <= _processor_count) {
+    active_cpus = online_cpus;
+  } else {
+    online_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if (online_cpus >= 1)
+      active_cpus = online_cpus;
+  }
 #endif
 
-  return _processor_count;
+  if (OSContainer::is_containerized()) {
+    int limit = OSContainer::active_processor_count();
+    if (limit > 0 && limit < active_cpus) {
+      log_trace(os)("active_processor_count: determined by rctl pcpu limit: %d", limit);
+      active_cpus = limit;
+    }
+  }
+
+  return active_cpus;
 }
 
 uint os::processor_id() {
@@ -77,43 +77,13 @@ class os::Bsd {
   // none present
 
  private:
-  typedef int (*sched_getcpu_func_t)(void);
-  typedef int (*numa_node_to_cpus_func_t)(int node, unsigned long *buffer, int bufferlen);
-  typedef int (*numa_max_node_func_t)(void);
-  typedef int (*numa_available_func_t)(void);
-  typedef int (*numa_tonode_memory_func_t)(void *start, size_t size, int node);
-  typedef void (*numa_interleave_memory_func_t)(void *start, size_t size, unsigned long *nodemask);
-
-  static sched_getcpu_func_t _sched_getcpu;
-  static numa_node_to_cpus_func_t _numa_node_to_cpus;
-  static numa_max_node_func_t _numa_max_node;
-  static numa_available_func_t _numa_available;
-  static numa_tonode_memory_func_t _numa_tonode_memory;
-  static numa_interleave_memory_func_t _numa_interleave_memory;
-  static unsigned long* _numa_all_nodes;
-
-  static void set_sched_getcpu(sched_getcpu_func_t func) { _sched_getcpu = func; }
-  static void set_numa_node_to_cpus(numa_node_to_cpus_func_t func) { _numa_node_to_cpus = func; }
-  static void set_numa_max_node(numa_max_node_func_t func) { _numa_max_node = func; }
-  static void set_numa_available(numa_available_func_t func) { _numa_available = func; }
-  static void set_numa_tonode_memory(numa_tonode_memory_func_t func) { _numa_tonode_memory = func; }
-  static void set_numa_interleave_memory(numa_interleave_memory_func_t func) { _numa_interleave_memory = func; }
-  static void set_numa_all_nodes(unsigned long* ptr) { _numa_all_nodes = ptr; }
+  static int _numa_domain_count;
+
+  static bool numa_init();
+
  public:
-  static int sched_getcpu()  { return _sched_getcpu != nullptr ? _sched_getcpu() : -1; }
-  static int numa_node_to_cpus(int node, unsigned long *buffer, int bufferlen) {
-    return _numa_node_to_cpus != nullptr ? _numa_node_to_cpus(node, buffer, bufferlen) : -1;
-  }
-  static int numa_max_node() { return _numa_max_node != nullptr ? _numa_max_node() : -1; }
-  static int numa_available() { return _numa_available != nullptr ? _numa_available() : -1; }
-  static int numa_tonode_memory(void *start, size_t size, int node) {
-    return _numa_tonode_memory != nullptr ? _numa_tonode_memory(start, size, node) : -1;
-  }
-  static void numa_interleave_memory(void *start, size_t size) {
-    if (_numa_interleave_memory != nullptr && _numa_all_nodes != nullptr) {
-      _numa_interleave_memory(start, size, _numa_all_nodes);
-    }
-  }
+  static int sched_getcpu();
+  static int numa_domain_count() { return _numa_domain_count; }
   static int get_node_by_cpu(int cpu_id);
 
   static void print_uptime_info(outputStream* st);
@@ -214,6 +214,11 @@ jlong CgroupV1Subsystem::memory_max_usage_in_bytes() {
   return memmaxusage;
 }
 
+double CgroupV1Subsystem::memory_pressure() {
+  // Pressure stall information is only exposed per cgroup by the unified hierarchy.
+  log_trace(os, container)("Memory Pressure is not supported.");
+  return OSCONTAINER_ERROR; // not supported
+}
 
 jlong CgroupV1Subsystem::kernel_memory_usage_in_bytes() {
   GET_CONTAINER_INFO(jlong, _memory->controller(), "/memory.kmem.usage_in_bytes",
@@ -139,6 +139,21 @@ jlong CgroupV2Subsystem::memory_max_usage_in_bytes() {
   return OSCONTAINER_ERROR; // not supported
 }
 
+/* memory_pressure
+ *
+ * The share of wall clock time, averaged over the last 10 seconds, in which
+ * at least one task in the cgroup was stalled waiting for memory (PSI "some").
+ *
+ * return:
+ *    memory pressure in percent
+ *    OSCONTAINER_ERROR for not supported
+ */
+double CgroupV2Subsystem::memory_pressure() {
+  GET_CONTAINER_INFO_LINE(double, _unified, "/memory.pressure", "some",
+                          "Memory Pressure is: %.2f", "avg10=%lf", pressure);
+  return pressure;
+}
+
 char* CgroupV2Subsystem::mem_soft_limit_val() {
   GET_CONTAINER_INFO_CPTR(cptr, _unified, "/memory.low",
                          "Memory Soft Limit is: %s", "%1023s", mem_soft_limit_str, 1024);
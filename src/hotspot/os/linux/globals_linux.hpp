@@ -79,6 +79,11 @@
   product(bool, DumpPerfMapAtExit, false, DIAGNOSTIC,                   \
           "Write map file for Linux perf tool at exit")                 \
                                                                         \
+  product(bool, WriteJitDump, false, DIAGNOSTIC,                        \
+          "Write a jitdump file for Linux perf inject to "              \
+          "/tmp/jit-<pid>.dump, with a record for each nmethod as it "  \
+          "is installed")                                               \
+                                                                        \
   product(intx, TimerSlack, -1, EXPERIMENTAL,                           \
           "Overrides the timer slack value to the given number of "     \
           "nanoseconds. Lower value provides more accurate "            \
@@ -95,6 +100,9 @@
           "thread stacks. When disabled, the absence of this mitigation"\
           "allows THPs to form in thread stacks.")                      \
                                                                         \
+  product(bool, UseMadvPopulateWrite, true, DIAGNOSTIC,                 \
+          "Use MADV_POPULATE_WRITE in os::pd_pretouch_memory.")         \
+                                                                        \
   develop(bool, DelayThreadStartALot, false,                            \
           "Artificially delay thread starts randomly for testing.")     \
                                                                         \
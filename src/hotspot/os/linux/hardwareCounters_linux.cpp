@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "logging/log.hpp"
+#include "os_linux.hpp"
+#include "utilities/hardwareCounters.hpp"
+
+#include <linux/perf_event.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+// Defined in kernel 3.14.
+#ifndef PERF_FLAG_FD_CLOEXEC
+#define PERF_FLAG_FD_CLOEXEC (1UL << 3)
+#endif
+
+static int perf_event_open(uint32_t type, uint64_t config, int group_fd) {
+  struct perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = type;
+  attr.config = config;
+  // The group is enabled at once through its leader.
+  attr.disabled = group_fd == -1 ? 1 : 0;
+  // Allowed with the default perf_event_paranoid setting of 2.
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  // This thread, on any CPU.
+  return (int)syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, PERF_FLAG_FD_CLOEXEC);
+}
+
+static uint64_t cache_miss_config(uint64_t cache) {
+  return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+}
+
+bool LinuxHardwareCounters::initialize() {
+  int fd = perf_event_open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, -1);
+  if (fd == -1) {
+    log_info(os)("perf_event_open for CPU cycles failed: %s", os::strerror(errno));
+    return false;
+  }
+  ::close(fd);
+  log_info(os)("Using perf_event_open hardware event counters");
+  return true;
+}
+
+bool LinuxHardwareCounters::start(int* fds) {
+  STATIC_ASSERT(HardwareCounterEventCount == 4);
+  // The cycles counter leads the group, so all events are scheduled together.
+  fds[HardwareCounterCycles] = perf_event_open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, -1);
+  if (fds[HardwareCounterCycles] == -1) {
+    return false;
+  }
+  int leader = fds[HardwareCounterCycles];
+  fds[HardwareCounterInstructions] = perf_event_open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, leader);
+  fds[HardwareCounterLLCMisses] = perf_event_open(PERF_TYPE_HW_CACHE, cache_miss_config(PERF_COUNT_HW_CACHE_LL), leader);
+  fds[HardwareCounterDTLBMisses] = perf_event_open(PERF_TYPE_HW_CACHE, cache_miss_config(PERF_COUNT_HW_CACHE_DTLB), leader);
+  if (ioctl(leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP) == -1 ||
+      ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP) == -1) {
+    stop(fds);
+    return false;
+  }
+  return true;
+}
+
+bool LinuxHardwareCounters::read(const int* fds, uint64_t* values) {
+  for (int i = 0; i < HardwareCounterEventCount; i++) {
+    values[i] = UINT64_MAX;
+    uint64_t value;
+    if (fds[i] != -1 && ::read(fds[i], &value, sizeof(value)) == (ssize_t)sizeof(value)) {
+      values[i] = value;
+    }
+  }
+  return values[HardwareCounterCycles] != UINT64_MAX;
+}
+
+void LinuxHardwareCounters::stop(int* fds) {
+  // Close the group members before the leader.
+  for (int i = HardwareCounterEventCount - 1; i >= 0; i--) {
+    if (fds[i] != -1) {
+      ::close(fds[i]);
+      fds[i] = -1;
+    }
+  }
+}
@@ -55,6 +55,7 @@ class OSContainer: AllStatic {
   static jlong memory_soft_limit_in_bytes();
   static jlong memory_usage_in_bytes();
   static jlong memory_max_usage_in_bytes();
+  static double memory_pressure();
 
   static int active_processor_count();
 
@@ -26,6 +26,7 @@
 // no precompiled headers
 #include "classfile/vmSymbols.hpp"
 #include "code/icBuffer.hpp"
+#include "code/jitDump.hpp"
 #include "code/vtableStubs.hpp"
 #include "compiler/compileBroker.hpp"
 #include "compiler/disassembler.hpp"
@@ -285,6 +286,28 @@ julong os::Linux::free_memory() {
   return free_mem;
 }
 
+double os::memory_pressure() {
+  if (OSContainer::is_containerized()) {
+    double pressure = OSContainer::memory_pressure();
+    if (pressure >= 0.0) {
+      log_trace(os)("container memory pressure: %.2f", pressure);
+      return pressure;
+    }
+  }
+
+  double pressure = -1.0;
+  FILE *fp = os::fopen("/proc/pressure/memory", "r");
+  if (fp != nullptr) {
+    // The first line holds the "some" averages.
+    if (fscanf(fp, "some avg10=%lf", &pressure) != 1) {
+      pressure = -1.0;
+    }
+    fclose(fp);
+  }
+  log_trace(os)("memory pressure: %.2f", pressure);
+  return pressure;
+}
+
 julong os::physical_memory() {
   jlong phys_mem = 0;
   if (OSContainer::is_containerized()) {
@@ -1983,6 +2006,8 @@ void os::print_os_info(outputStream* st) {
 
   os::Linux::print_uptime_info(st);
 
+  os::Linux::print_clocksource_info(st);
+
   // Print warning if unsafe chroot environment detected
   if (unsafe_chroot_detected) {
     st->print_cr("WARNING!! %s", unstable_chroot_error);
@@ -2286,6 +2311,25 @@ void os::Linux::print_uptime_info(outputStream* st) {
   }
 }
 
+// System.nanoTime() and os::elapsed_counter() use clock_gettime(CLOCK_MONOTONIC).
+// The vDSO can only serve it in user space if the kernel clock source can be read
+// there. With the listed clock sources every call is a system call.
+void os::Linux::print_clocksource_info(outputStream* st) {
+  FILE* fp = os::fopen("/sys/devices/system/clocksource/clocksource0/current_clocksource", "r");
+  if (fp == nullptr) {
+    return;
+  }
+  char buf[64];
+  if (fgets(buf, sizeof(buf), fp) != nullptr) {
+    buf[strcspn(buf, "\n")] = '\0';
+    const bool syscall = strcmp(buf, "hpet") == 0 || strcmp(buf, "acpi_pm") == 0 ||
+                         strcmp(buf, "jiffies") == 0;
+    st->print_cr("Clock source: %s%s", buf,
+                 syscall ? " (no vDSO support, reading time is a system call)" : "");
+  }
+  fclose(fp);
+}
+
 bool os::Linux::print_container_info(outputStream* st) {
   if (!OSContainer::is_containerized()) {
     st->print_cr("container information not found.");
@@ -2830,6 +2874,15 @@ void os::pd_commit_memory_or_exit(char* addr, size_t size, bool exec,
   #define MADV_HUGEPAGE 14
 #endif
 
+// Define MADV_POPULATE_WRITE here so we can build HotSpot on old systems.
+#define MADV_POPULATE_WRITE_value 23
+#ifndef MADV_POPULATE_WRITE
+  #define MADV_POPULATE_WRITE MADV_POPULATE_WRITE_value
+#else
+  // Sanity-check our assumed default value if we build with a new enough libc.
+  STATIC_ASSERT(MADV_POPULATE_WRITE == MADV_POPULATE_WRITE_value);
+#endif
+
 int os::Linux::commit_memory_impl(char* addr, size_t size,
                                   size_t alignment_hint, bool exec) {
   int err = os::Linux::commit_memory_impl(addr, size, exec);
@@ -2864,6 +2917,31 @@ void os::pd_realign_memory(char *addr, size_t bytes, size_t alignment_hint) {
   }
 }
 
+size_t os::pd_pretouch_memory(void* first, void* last, size_t page_size) {
+  const size_t len = pointer_delta(last, first, sizeof(char)) + page_size;
+  // Use madvise to pretouch on Linux when THP is used, and fall back to the
+  // common method if unsupported. THP can form right after madvise rather than
+  // being assembled later.
+  if (HugePages::thp_mode() == THPMode::always || UseTransparentHugePages) {
+    int err = 0;
+    if (UseMadvPopulateWrite &&
+        ::madvise(first, len, MADV_POPULATE_WRITE) == -1) {
+      err = errno;
+    }
+    if (!UseMadvPopulateWrite || err == EINVAL) { // Not to use or not supported
+      // When using THP we need to always pre-touch using small pages as the
+      // OS will initially always use small pages.
+      return os::vm_page_size();
+    } else if (err != 0) {
+      log_info(gc, os)("::madvise(" PTR_FORMAT ", " SIZE_FORMAT ", %d) failed; "
+                       "error='%s' (errno=%d)", p2i(first), len,
+                       MADV_POPULATE_WRITE, os::strerror(err), err);
+    }
+    return 0;
+  }
+  return page_size;
+}
+
 void os::pd_free_memory(char *addr, size_t bytes, size_t alignment_hint) {
   // This method works by doing an mmap over an existing mmaping and effectively discarding
   // the existing pages. However it won't work for SHM-based large pages that cannot be
@@ -4709,6 +4787,10 @@ jint os::init_2(void) {
     FLAG_SET_DEFAULT(UseCodeCacheFlushing, false);
   }
 
+  if (WriteJitDump) {
+    JitDump::initialize();
+  }
+
   // Override the timer slack value if needed. The adjustment for the main
   // thread will establish the setting for child threads, which would be
   // most threads in JDK/JVM.
@@ -99,6 +99,7 @@ class os::Linux {
   static void print_proc_sys_info(outputStream* st);
   static bool print_ld_preload_file(outputStream* st);
   static void print_uptime_info(outputStream* st);
+  static void print_clocksource_info(outputStream* st);
 
  public:
   struct CPUPerfTicks {
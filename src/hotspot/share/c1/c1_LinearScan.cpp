@@ -5035,12 +5035,18 @@ void LinearScanWalker::free_collect_inactive_fixed(Interval* cur) {
   }
 }
 
+// The inactive lists are sorted by current_from(), so the intervals after the
+// first one that starts at or after the end of cur cannot intersect cur. Stopping
+// there keeps the walk from becoming quadratic in the number of intervals for
+// very large methods, where most inactive intervals are far behind cur.
+
 void LinearScanWalker::free_collect_inactive_any(Interval* cur) {
   Interval* list = inactive_first(anyKind);
-  while (list != Interval::end()) {
+  while (list != Interval::end() && list->current_from() < cur->to()) {
     set_use_pos(list, list->current_intersects_at(cur), true);
     list = list->next();
   }
+  DEBUG_ONLY(check_no_intersection(list, cur);)
 }
 
 void LinearScanWalker::spill_exclude_active_fixed() {
@@ -5053,15 +5059,11 @@ void LinearScanWalker::spill_exclude_active_fixed() {
 
 void LinearScanWalker::spill_block_inactive_fixed(Interval* cur) {
   Interval* list = inactive_first(fixedKind);
-  while (list != Interval::end()) {
-    if (cur->to() > list->current_from()) {
-      set_block_pos(list, list->current_intersects_at(cur));
-    } else {
-      assert(list->current_intersects_at(cur) == -1, "invalid optimization: intervals intersect");
-    }
-
+  while (list != Interval::end() && list->current_from() < cur->to()) {
+    set_block_pos(list, list->current_intersects_at(cur));
     list = list->next();
   }
+  DEBUG_ONLY(check_no_intersection(list, cur);)
 }
 
 void LinearScanWalker::spill_collect_active_any() {
@@ -5074,14 +5076,27 @@ void LinearScanWalker::spill_collect_active_any() {
 
 void LinearScanWalker::spill_collect_inactive_any(Interval* cur) {
   Interval* list = inactive_first(anyKind);
-  while (list != Interval::end()) {
+  while (list != Interval::end() && list->current_from() < cur->to()) {
     if (list->current_intersects(cur)) {
       set_use_pos(list, MIN2(list->next_usage(loopEndMarker, _current_position), list->to()), false);
     }
     list = list->next();
   }
+  DEBUG_ONLY(check_no_intersection(list, cur);)
 }
 
+#ifdef ASSERT
+void LinearScanWalker::check_no_intersection(Interval* list, Interval* cur) {
+  int prev_from = -1;
+  while (list != Interval::end()) {
+    assert(list->current_from() >= prev_from, "inactive list must be sorted");
+    assert(list->current_intersects_at(cur) == -1, "invalid optimization: intervals intersect");
+    prev_from = list->current_from();
+    list = list->next();
+  }
+}
+#endif
+
 
 void LinearScanWalker::insert_move(int op_id, Interval* src_it, Interval* dst_it) {
   // output all moves here. When source and target are equal, the move is
@@ -755,6 +755,7 @@ class LinearScanWalker : public IntervalWalker {
   void spill_block_inactive_fixed(Interval* cur);
   void spill_collect_active_any();
   void spill_collect_inactive_any(Interval* cur);
+  DEBUG_ONLY(void check_no_intersection(Interval* list, Interval* cur);)
 
   void insert_move(int op_id, Interval* src_it, Interval* dst_it);
   int  find_optimal_split_pos(BlockBegin* min_block, BlockBegin* max_block, int max_split_pos);
@@ -34,17 +34,21 @@
 #include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionaryShared.hpp"
 #include "classfile/vmClasses.hpp"
+#include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/workerThread.hpp"
 #include "interpreter/abstractInterpreter.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/allStatic.hpp"
 #include "memory/memRegion.hpp"
 #include "memory/resourceArea.hpp"
+#include "memory/universe.hpp"
 #include "oops/instanceKlass.hpp"
 #include "oops/objArrayKlass.hpp"
 #include "oops/objArrayOop.inline.hpp"
 #include "oops/oopHandle.inline.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/globals_extension.hpp"
 #include "runtime/javaThread.hpp"
 #include "runtime/sharedRuntime.hpp"
@@ -112,9 +116,10 @@ class RelocateEmbeddedPointers : public BitMapClosure {
   ArchiveBuilder* _builder;
   address _buffered_obj;
   BitMap::idx_t _start_idx;
+  bool _parallel;
 public:
-  RelocateEmbeddedPointers(ArchiveBuilder* builder, address buffered_obj, BitMap::idx_t start_idx) :
-    _builder(builder), _buffered_obj(buffered_obj), _start_idx(start_idx) {}
+  RelocateEmbeddedPointers(ArchiveBuilder* builder, address buffered_obj, BitMap::idx_t start_idx, bool parallel) :
+    _builder(builder), _buffered_obj(buffered_obj), _start_idx(start_idx), _parallel(parallel) {}
 
   bool do_bit(BitMap::idx_t bit_offset) {
     size_t field_offset = size_t(bit_offset - _start_idx) * sizeof(address);
@@ -126,18 +131,22 @@ public:
     log_trace(cds)("Ref: [" PTR_FORMAT "] -> " PTR_FORMAT " => " PTR_FORMAT,
                    p2i(ptr_loc), p2i(old_p), p2i(new_p));
 
-    ArchivePtrMarker::set_and_mark_pointer(ptr_loc, new_p);
+    if (_parallel) {
+      ArchivePtrMarker::par_set_and_mark_pointer(ptr_loc, new_p);
+    } else {
+      ArchivePtrMarker::set_and_mark_pointer(ptr_loc, new_p);
+    }
     return true; // keep iterating the bitmap
   }
 };
 
-void ArchiveBuilder::SourceObjList::relocate(int i, ArchiveBuilder* builder) {
+void ArchiveBuilder::SourceObjList::relocate(int i, ArchiveBuilder* builder, bool parallel) {
   SourceObjInfo* src_info = objs()->at(i);
   assert(src_info->should_copy(), "must be");
   BitMap::idx_t start = BitMap::idx_t(src_info->ptrmap_start()); // inclusive
   BitMap::idx_t end = BitMap::idx_t(src_info->ptrmap_end());     // exclusive
 
-  RelocateEmbeddedPointers relocator(builder, src_info->buffered_addr(), start);
+  RelocateEmbeddedPointers relocator(builder, src_info->buffered_addr(), start, parallel);
   _ptrmap.iterate(&relocator, start, end);
 }
 
@@ -656,16 +665,62 @@ address ArchiveBuilder::get_source_addr(address buffered_addr) const {
   return *src_p;
 }
 
-void ArchiveBuilder::relocate_embedded_pointers(ArchiveBuilder::SourceObjList* src_objs) {
-  for (int i = 0; i < src_objs->objs()->length(); i++) {
-    src_objs->relocate(i, this);
+// All objects have been copied, so the buffer no longer changes size. Each
+// object's pointers are relocated independently of the others; the only
+// shared state written is the ArchivePtrMarker bitmap, which is presized
+// and updated with atomic bit operations.
+class ArchiveBuilder::RelocateEmbeddedPointersTask : public WorkerTask {
+  ArchiveBuilder* _builder;
+  SourceObjList* _src_objs;
+  volatile int _claimed;
+
+public:
+  static const int ChunkSize = 256;
+
+  RelocateEmbeddedPointersTask(ArchiveBuilder* builder, SourceObjList* src_objs) :
+    WorkerTask("Relocate Embedded Pointers"),
+    _builder(builder), _src_objs(src_objs), _claimed(0) {}
+
+  void work(uint worker_id) {
+    const int len = _src_objs->objs()->length();
+    for (;;) {
+      int start = Atomic::fetch_then_add(&_claimed, ChunkSize);
+      if (start >= len) {
+        return;
+      }
+      int end = MIN2(start + ChunkSize, len);
+      for (int i = start; i < end; i++) {
+        _src_objs->relocate(i, _builder, true /* parallel */);
+      }
+    }
+  }
+};
+
+void ArchiveBuilder::relocate_embedded_pointers(ArchiveBuilder::SourceObjList* src_objs, WorkerThreads* workers) {
+  const int len = src_objs->objs()->length();
+  if (workers != nullptr) {
+    RelocateEmbeddedPointersTask task(this, src_objs);
+    // The GC may be running with fewer active workers than it has, use all of them.
+    const uint num_workers = MIN2(workers->max_workers(),
+                                  (uint)(len / RelocateEmbeddedPointersTask::ChunkSize) + 1);
+    workers->run_task(&task, num_workers);
+  } else {
+    for (int i = 0; i < len; i++) {
+      src_objs->relocate(i, this);
+    }
   }
 }
 
 void ArchiveBuilder::relocate_metaspaceobj_embedded_pointers() {
   log_info(cds)("Relocating embedded pointers in core regions ... ");
-  relocate_embedded_pointers(&_rw_src_objs);
-  relocate_embedded_pointers(&_ro_src_objs);
+  WorkerThreads* workers = Universe::heap()->safepoint_workers();
+  if (workers != nullptr && workers->max_workers() > 1) {
+    ArchivePtrMarker::prepare_for_par_marking();
+  } else {
+    workers = nullptr;
+  }
+  relocate_embedded_pointers(&_rw_src_objs, workers);
+  relocate_embedded_pointers(&_ro_src_objs, workers);
 }
 
 void ArchiveBuilder::make_klasses_shareable() {
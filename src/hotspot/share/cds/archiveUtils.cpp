@@ -91,6 +91,34 @@ void ArchivePtrMarker::mark_pointer(address* ptr_loc) {
   }
 }
 
+void ArchivePtrMarker::prepare_for_par_marking() {
+  assert(_ptrmap != nullptr, "not initialized");
+  assert(!_compacted, "cannot mark anymore");
+  size_t needed = ptr_end() - ptr_base();
+  if (_ptrmap->size() < needed) {
+    _ptrmap->resize(needed);
+  }
+}
+
+// Same as mark_pointer(), but may be called by several threads at once after
+// prepare_for_par_marking(), as long as no new space is committed meanwhile.
+void ArchivePtrMarker::par_mark_pointer(address* ptr_loc) {
+  assert(_ptrmap != nullptr, "not initialized");
+  assert(!_compacted, "cannot mark anymore");
+
+  if (ptr_base() <= ptr_loc && ptr_loc < ptr_end()) {
+    address value = *ptr_loc;
+    assert(value != (address)ptr_base(), "don't point to the bottom of the archive");
+
+    if (value != nullptr) {
+      assert(uintx(ptr_loc) % sizeof(intptr_t) == 0, "pointers must be stored in aligned addresses");
+      size_t idx = ptr_loc - ptr_base();
+      assert(idx < _ptrmap->size(), "must have been prepared");
+      _ptrmap->par_set_bit(idx);
+    }
+  }
+}
+
 void ArchivePtrMarker::clear_pointer(address* ptr_loc) {
   assert(_ptrmap != nullptr, "not initialized");
   assert(!_compacted, "cannot clear anymore");
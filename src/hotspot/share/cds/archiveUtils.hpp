@@ -69,6 +69,17 @@ public:
     mark_pointer(ptr_loc);
   }
 
+  // Grow _ptrmap to cover all committed space, so that par_mark_pointer()
+  // never needs to resize it.
+  static void prepare_for_par_marking();
+  static void par_mark_pointer(address* ptr_loc);
+
+  template <typename T>
+  static void par_set_and_mark_pointer(T* ptr_loc, T ptr_value) {
+    *ptr_loc = ptr_value;
+    par_mark_pointer((address*)ptr_loc);
+  }
+
   static CHeapBitMap* ptrmap() {
     return _ptrmap;
   }
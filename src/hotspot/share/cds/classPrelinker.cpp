@@ -31,6 +31,7 @@
 #include "oops/constantPool.inline.hpp"
 #include "oops/instanceKlass.hpp"
 #include "oops/klass.inline.hpp"
+#include "oops/objArrayKlass.hpp"
 #include "runtime/handles.inline.hpp"
 
 ClassPrelinker::ClassesTable* ClassPrelinker::_processed_classes = nullptr;
@@ -106,8 +107,23 @@ bool ClassPrelinker::can_archive_resolved_klass(InstanceKlass* cp_holder, Klass*
       // ik is defined in this loader, so it's safe to archive the resolved klass reference.
       return true;
     }
-
-    // TODO -- allow objArray classes, too
+  } else if (resolved_klass->is_objArray_klass()) {
+    if (!DumpSharedSpaces) {
+      // The dynamic archive cannot update the array_klasses of a class in the
+      // base archive, so an array class copied into it may not be the one
+      // found at runtime.
+      return false;
+    }
+    Klass* elem = ObjArrayKlass::cast(resolved_klass)->bottom_klass();
+    if (elem->is_instance_klass()) {
+      // The array class is resolved in the same loader as its element class.
+      return can_archive_resolved_klass(cp_holder, InstanceKlass::cast(elem));
+    } else if (elem->is_typeArray_klass()) {
+      return true;
+    }
+  } else if (resolved_klass->is_typeArray_klass()) {
+    // Resolved the same way in every loader.
+    return true;
   }
 
   return false;
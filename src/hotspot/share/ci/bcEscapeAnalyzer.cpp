@@ -1486,7 +1486,7 @@ BCEscapeAnalyzer::BCEscapeAnalyzer(ciMethod* method, BCEscapeAnalyzer* parent)
 }
 
 void BCEscapeAnalyzer::copy_dependencies(Dependencies *deps) {
-  if (ciEnv::current()->jvmti_can_hotswap_or_post_breakpoint()) {
+  if (ciEnv::current()->should_record_evol_dependencies()) {
     // Also record evol dependencies so redefinition of the
     // callee will trigger recompilation.
     deps->assert_evol_method(method());
@@ -33,12 +33,15 @@
 // This class is used to determine the frequently called method
 // at some call site
 class ciCallProfile : StackObj {
+public:
+  // Max call site's morphism we care about, the largest TypeProfileWidth.
+  enum { MorphismLimit = 8 };
+
 private:
   // Fields are initialized directly by ciMethod::call_profile_at_bci.
   friend class ciMethod;
   friend class ciMethodHandle;
 
-  enum { MorphismLimit = 2 }; // Max call site's morphism we care about
   int  _limit;                // number of receivers have been determined
   int  _morphism;             // determined call site's morphism
   int  _count;                // # times has this call been executed
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "classfile/backgroundClassLinker.hpp"
+#include "classfile/symbolTable.hpp"
+#include "classfile/systemDictionary.hpp"
+#include "logging/log.hpp"
+#include "memory/resourceArea.hpp"
+#include "oops/instanceKlass.hpp"
+#include "oops/symbolHandle.hpp"
+#include "runtime/arguments.hpp"
+#include "runtime/handles.inline.hpp"
+#include "runtime/os.hpp"
+
+void BackgroundClassLinker::initialize() {
+  if (BackgroundLinkClassList == nullptr) {
+    return;
+  }
+  if (Arguments::is_dumping_archive()) {
+    // Classes loaded by the linker would end up in the archive, and the
+    // dump expects to be the only one loading classes.
+    log_info(class, init)("Background linking is disabled when dumping a CDS archive");
+    return;
+  }
+  EXCEPTION_MARK;
+
+  const char* name = "Background Class Linker";
+  Handle thread_oop = JavaThread::create_system_thread_object(name, CHECK);
+
+  BackgroundClassLinker* thread = new BackgroundClassLinker(&background_class_linker_entry);
+  JavaThread::vm_exit_on_osthread_failure(thread);
+
+  JavaThread::start_internal_daemon(THREAD, thread, thread_oop, MinPriority);
+}
+
+// Returns the class name at the start of a class list line, or nullptr for
+// lines that do not name a class of a built-in loader.
+static const char* class_name_of(char* line) {
+  if (line[0] == '#' || line[0] == '@' || line[0] == '\0') {
+    return nullptr;
+  }
+  if (strstr(line, " source:") != nullptr) {
+    // Loaded by a custom class loader.
+    return nullptr;
+  }
+  char* end = line + strcspn(line, " \t\r\n");
+  *end = '\0';
+  return line[0] != '\0' ? line : nullptr;
+}
+
+void BackgroundClassLinker::background_class_linker_entry(JavaThread* jt, TRAPS) {
+  FILE* stream = os::fopen(BackgroundLinkClassList, "rt");
+  if (stream == nullptr) {
+    log_warning(class, init)("Could not open class list %s for background linking", BackgroundLinkClassList);
+    return;
+  }
+
+  Handle loader(THREAD, SystemDictionary::java_system_loader());
+  int linked = 0;
+  int failed = 0;
+  char line[4096];
+  while (fgets(line, sizeof(line), stream) != nullptr) {
+    const char* class_name = class_name_of(line);
+    if (class_name == nullptr) {
+      continue;
+    }
+    HandleMark hm(THREAD);
+    ResourceMark rm(THREAD);
+    TempNewSymbol sym = SymbolTable::new_symbol(class_name);
+    Klass* k = SystemDictionary::resolve_or_null(sym, loader, Handle(), THREAD);
+    if (!HAS_PENDING_EXCEPTION && k != nullptr && k->is_instance_klass()) {
+      InstanceKlass::cast(k)->link_class(THREAD);
+    }
+    if (HAS_PENDING_EXCEPTION || k == nullptr) {
+      // The application gets the same error when it uses the class.
+      log_debug(class, init)("Background linking of %s failed", class_name);
+      CLEAR_PENDING_EXCEPTION;
+      failed++;
+    } else {
+      linked++;
+    }
+  }
+  fclose(stream);
+
+  log_info(class, init)("Background linking of %s done: %d classes linked, %d failed",
+                        BackgroundLinkClassList, linked, failed);
+}
@@ -312,6 +312,14 @@ InstanceKlass* Dictionary::find_class(Thread* current,
   return (entry != nullptr) ? entry->instance_klass() : nullptr;
 }
 
+InstanceKlass* Dictionary::find_class_unlocked(Thread* current,
+                                               Symbol* name) {
+  NoSafepointVerifier nsv;
+
+  DictionaryEntry* entry = get_entry(current, name);
+  return (entry != nullptr) ? entry->instance_klass() : nullptr;
+}
+
 void Dictionary::add_protection_domain(JavaThread* current,
                                        InstanceKlass* klass,
                                        Handle protection_domain) {
@@ -68,6 +68,10 @@ public:
   void add_klass(JavaThread* current, Symbol* class_name, InstanceKlass* obj);
 
   InstanceKlass* find_class(Thread* current, Symbol* name);
+  // Same as find_class, without holding the SystemDictionary_lock. Entries are
+  // only removed together with the whole Dictionary, so a class that is found is
+  // stable, but a class that is being added concurrently may not be found yet.
+  InstanceKlass* find_class_unlocked(Thread* current, Symbol* name);
 
   void classes_do(void f(InstanceKlass*));
   void all_entries_do(KlassClosure* closure);
@@ -156,20 +156,37 @@ class java_lang_String : AllStatic {
   // hash P(31) from Kernighan & Ritchie
   //
   // For this reason, THIS ALGORITHM MUST MATCH String.hashCode().
+  // The hash codes are computed as h = 31 * h + s[i], four elements at a time.
+  // That shortens the chain of dependent multiplications and lets the C++
+  // compiler vectorize the loop, without changing the result.
   static unsigned int hash_code(const jchar* s, int len) {
     unsigned int h = 0;
-    while (len-- > 0) {
-      h = 31*h + (unsigned int) *s;
-      s++;
+    int i = 0;
+    for (; i + 4 <= len; i += 4) {
+      h = (31*31*31*31) * h +
+          (31*31*31) * (unsigned int) s[i] +
+          (31*31)    * (unsigned int) s[i + 1] +
+          31         * (unsigned int) s[i + 2] +
+                       (unsigned int) s[i + 3];
+    }
+    for (; i < len; i++) {
+      h = 31*h + (unsigned int) s[i];
     }
     return h;
   }
 
   static unsigned int hash_code(const jbyte* s, int len) {
     unsigned int h = 0;
-    while (len-- > 0) {
-      h = 31*h + (((unsigned int) *s) & 0xFF);
-      s++;
+    int i = 0;
+    for (; i + 4 <= len; i += 4) {
+      h = (31*31*31*31) * h +
+          (31*31*31) * (((unsigned int) s[i])     & 0xFF) +
+          (31*31)    * (((unsigned int) s[i + 1]) & 0xFF) +
+          31         * (((unsigned int) s[i + 2]) & 0xFF) +
+                       (((unsigned int) s[i + 3]) & 0xFF);
+    }
+    for (; i < len; i++) {
+      h = 31*h + (((unsigned int) s[i]) & 0xFF);
     }
     return h;
   }
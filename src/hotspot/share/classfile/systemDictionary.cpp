@@ -615,8 +615,12 @@ InstanceKlass* SystemDictionary::resolve_instance_class_or_null(Symbol* name,
          name->as_C_string(),
          class_loader.is_null() ? "null" : class_loader->klass()->name()->as_C_string());
 
-  // Check again (after locking) if the class already exists in SystemDictionary
-  {
+  // Check again (after locking) if the class already exists in SystemDictionary.
+  // The thread that held the loader lock has often just defined the class, which
+  // can be seen without the SystemDictionary_lock. The placeholder table has to
+  // be checked under the lock, together with a second lookup.
+  loaded_class = dictionary->find_class_unlocked(THREAD, name);
+  if (loaded_class == nullptr) {
     MutexLocker mu(THREAD, SystemDictionary_lock);
     InstanceKlass* check = dictionary->find_class(THREAD, name);
     if (check != nullptr) {
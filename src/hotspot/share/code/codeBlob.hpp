@@ -46,7 +46,8 @@ enum class CodeBlobType {
   MethodProfiled      = 1,    // Execution level 2 and 3 (profiled) nmethods
   NonNMethod          = 2,    // Non-nmethods like Buffers, Adapters and Runtime Stubs
   All                 = 3,    // All types (No code cache segmentation)
-  NumTypes            = 4     // Number of CodeBlobTypes
+  MethodHot           = 4,    // Execution level 4 nmethods of hot methods (see HotCodeHeapSize)
+  NumTypes            = 5     // Number of CodeBlobTypes
 };
 
 // CodeBlob - superclass for all entries in the CodeCache.
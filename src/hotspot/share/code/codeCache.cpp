@@ -305,13 +305,29 @@ void CodeCache::initialize_heaps() {
         non_nmethod_size/K, min_code_cache_size/K));
   }
 
+  const size_t ps = page_size(false, 8);
+  // If large page support is enabled, align code heaps according to large
+  // page size to make sure that code cache is covered by large pages.
+  const size_t alignment = MAX2(ps, os::vm_allocation_granularity());
+
+  // The hot code heap is taken from the non-profiled code heap
+  size_t hot_size = 0;
+  if (heap_available(CodeBlobType::MethodHot)) {
+    hot_size = align_down(MIN2((size_t)HotCodeHeapSize, non_profiled_size / 2), alignment);
+    if (hot_size == 0) {
+      log_warning(codecache)("HotCodeHeapSize (" SIZE_FORMAT "K) is too small, disabling the hot code heap",
+                             HotCodeHeapSize/K);
+    }
+    non_profiled_size -= hot_size;
+    FLAG_SET_ERGO(HotCodeHeapSize, hot_size);
+  }
+
   // Verify sizes and update flag values
-  assert(non_profiled_size + profiled_size + non_nmethod_size == cache_size, "Invalid code heap sizes");
+  assert(non_profiled_size + profiled_size + non_nmethod_size + hot_size == cache_size, "Invalid code heap sizes");
   FLAG_SET_ERGO(NonNMethodCodeHeapSize, non_nmethod_size);
   FLAG_SET_ERGO(ProfiledCodeHeapSize, profiled_size);
   FLAG_SET_ERGO(NonProfiledCodeHeapSize, non_profiled_size);
 
-  const size_t ps = page_size(false, 8);
   // Print warning if using large pages but not able to use the size given
   if (UseLargePages) {
     const size_t lg_ps = page_size(false, 1);
@@ -322,9 +338,6 @@ void CodeCache::initialize_heaps() {
     }
   }
 
-  // If large page support is enabled, align code heaps according to large
-  // page size to make sure that code cache is covered by large pages.
-  const size_t alignment = MAX2(ps, os::vm_allocation_granularity());
   non_nmethod_size = align_up(non_nmethod_size, alignment);
   profiled_size    = align_down(profiled_size, alignment);
   non_profiled_size = align_down(non_profiled_size, alignment);
@@ -333,14 +346,22 @@ void CodeCache::initialize_heaps() {
   // parts for the individual heaps. The memory layout looks like this:
   // ---------- high -----------
   //    Non-profiled nmethods
+  //        Hot nmethods
   //         Non-nmethods
   //      Profiled nmethods
   // ---------- low ------------
+  // Hot nmethods are kept next to the stubs they call, and densely packed
+  // to reduce instruction TLB and cache misses.
   ReservedCodeSpace rs = reserve_heap_memory(cache_size, ps);
   ReservedSpace profiled_space      = rs.first_part(profiled_size);
   ReservedSpace rest                = rs.last_part(profiled_size);
   ReservedSpace non_method_space    = rest.first_part(non_nmethod_size);
   ReservedSpace non_profiled_space  = rest.last_part(non_nmethod_size);
+  ReservedSpace hot_space;
+  if (hot_size > 0) {
+    hot_space          = non_profiled_space.first_part(hot_size);
+    non_profiled_space = non_profiled_space.last_part(hot_size);
+  }
 
   // Register CodeHeaps with LSan as we sometimes embed pointers to malloc memory.
   LSAN_REGISTER_ROOT_REGION(rs.base(), rs.size());
@@ -351,6 +372,8 @@ void CodeCache::initialize_heaps() {
   add_heap(profiled_space, "CodeHeap 'profiled nmethods'", CodeBlobType::MethodProfiled);
   // Tier 1 and tier 4 (non-profiled) methods and native methods
   add_heap(non_profiled_space, "CodeHeap 'non-profiled nmethods'", CodeBlobType::MethodNonProfiled);
+  // Tier 4 methods with high invocation and backedge counts
+  add_heap(hot_space, "CodeHeap 'hot nmethods'", CodeBlobType::MethodHot);
 }
 
 size_t CodeCache::page_size(bool aligned, size_t min_pages) {
@@ -387,6 +410,9 @@ bool CodeCache::heap_available(CodeBlobType code_blob_type) {
   if (!SegmentedCodeCache) {
     // No segmentation: use a single code heap
     return (code_blob_type == CodeBlobType::All);
+  } else if (code_blob_type == CodeBlobType::MethodHot) {
+    // Only C2 code of hot methods, see HotCodeHeapSize
+    return HotCodeHeapSize > 0 && CompilerConfig::is_c2_or_jvmci_compiler_enabled();
   } else if (CompilerConfig::is_interpreter_only()) {
     // Interpreter only: we don't need any method code heaps
     return (code_blob_type == CodeBlobType::NonNMethod);
@@ -411,12 +437,25 @@ const char* CodeCache::get_code_heap_flag_name(CodeBlobType code_blob_type) {
   case CodeBlobType::MethodProfiled:
     return "ProfiledCodeHeapSize";
     break;
+  case CodeBlobType::MethodHot:
+    return "HotCodeHeapSize";
+    break;
   default:
     ShouldNotReachHere();
     return nullptr;
   }
 }
 
+CodeBlobType CodeCache::get_code_blob_type(Method* method, int comp_level) {
+  if (comp_level == CompLevel_full_optimization && heap_available(CodeBlobType::MethodHot)) {
+    int64_t count = (int64_t)method->invocation_count() + method->backedge_count();
+    if (count >= HotCodeHeapThreshold) {
+      return CodeBlobType::MethodHot;
+    }
+  }
+  return get_code_blob_type(comp_level);
+}
+
 int CodeCache::code_heap_compare(CodeHeap* const &lhs, CodeHeap* const &rhs) {
   if (lhs->code_blob_type() == rhs->code_blob_type()) {
     return (lhs > rhs) ? 1 : ((lhs < rhs) ? -1 : 0);
@@ -543,9 +582,13 @@ CodeBlob* CodeCache::allocate(int size, CodeBlobType code_blob_type, bool handle
       // Expansion failed
       if (SegmentedCodeCache) {
         // Fallback solution: Try to store code in another code heap.
+        // MethodHot -> MethodNonProfiled
         // NonNMethod -> MethodNonProfiled -> MethodProfiled (-> MethodNonProfiled)
         CodeBlobType type = code_blob_type;
         switch (type) {
+        case CodeBlobType::MethodHot:
+          type = CodeBlobType::MethodNonProfiled;
+          break;
         case CodeBlobType::NonNMethod:
           type = CodeBlobType::MethodNonProfiled;
           break;
@@ -266,16 +266,17 @@ class CodeCache : AllStatic {
   }
 
   static bool code_blob_type_accepts_compiled(CodeBlobType code_blob_type) {
-    bool result = code_blob_type == CodeBlobType::All || code_blob_type <= CodeBlobType::MethodProfiled;
+    bool result = code_blob_type == CodeBlobType::All || code_blob_type <= CodeBlobType::MethodProfiled ||
+                  code_blob_type == CodeBlobType::MethodHot;
     return result;
   }
 
   static bool code_blob_type_accepts_nmethod(CodeBlobType type) {
-    return type == CodeBlobType::All || type <= CodeBlobType::MethodProfiled;
+    return type == CodeBlobType::All || type <= CodeBlobType::MethodProfiled || type == CodeBlobType::MethodHot;
   }
 
   static bool code_blob_type_accepts_allocable(CodeBlobType type) {
-    return type <= CodeBlobType::All;
+    return type <= CodeBlobType::All || type == CodeBlobType::MethodHot;
   }
 
 
@@ -295,6 +296,10 @@ class CodeCache : AllStatic {
     return static_cast<CodeBlobType>(0);
   }
 
+  // Returns the CodeBlobType for code of the given method and compilation level,
+  // selecting the hot code heap for C2 code of frequently executed methods
+  static CodeBlobType get_code_blob_type(Method* method, int comp_level);
+
   static void verify_clean_inline_caches();
   static void verify_icholder_relocations();
 
@@ -0,0 +1,281 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "code/debugInfoRec.hpp"
+#include "code/jitDump.hpp"
+#include "code/nmethod.hpp"
+#include "code/pcDesc.hpp"
+#include "code/scopeDesc.hpp"
+#include "logging/log.hpp"
+#include "memory/resourceArea.hpp"
+#include "oops/instanceKlass.hpp"
+#include "oops/method.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/os.hpp"
+#include "utilities/growableArray.hpp"
+
+#ifdef LINUX
+
+#include <elf.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+// See tools/perf/util/jitdump.h in the Linux sources for the format.
+static const uint32_t JITDUMP_MAGIC = 0x4A695444; // "JiTD"
+static const uint32_t JITDUMP_VERSION = 1;
+
+enum JitDumpRecordType {
+  JIT_CODE_LOAD       = 0,
+  JIT_CODE_DEBUG_INFO = 2
+};
+
+struct JitDumpFileHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t total_size;
+  uint32_t elf_mach;
+  uint32_t pad1;
+  uint32_t pid;
+  uint64_t timestamp;
+  uint64_t flags;
+};
+
+struct JitDumpRecordHeader {
+  uint32_t id;
+  uint32_t total_size;
+  uint64_t timestamp;
+};
+
+// Followed by the NUL terminated name and the code.
+struct JitDumpCodeLoad {
+  JitDumpRecordHeader header;
+  uint32_t pid;
+  uint32_t tid;
+  uint64_t vma;
+  uint64_t code_addr;
+  uint64_t code_size;
+  uint64_t code_index;
+};
+
+// Followed by nr_entry entries.
+struct JitDumpDebugInfo {
+  JitDumpRecordHeader header;
+  uint64_t code_addr;
+  uint64_t nr_entry;
+};
+
+// Followed by the NUL terminated file name.
+struct JitDumpDebugEntry {
+  uint64_t addr;
+  int32_t lineno;
+  int32_t discrim;
+};
+
+static int _fd = -1;
+static volatile uint64_t _code_index = 0;
+
+static uint32_t elf_mach() {
+#if defined(AMD64)
+  return EM_X86_64;
+#elif defined(IA32)
+  return EM_386;
+#elif defined(AARCH64)
+  return EM_AARCH64;
+#elif defined(ARM)
+  return EM_ARM;
+#elif defined(PPC64)
+  return EM_PPC64;
+#elif defined(S390)
+  return EM_S390;
+#elif defined(RISCV)
+  return EM_RISCV;
+#else
+  return EM_NONE;
+#endif
+}
+
+// perf matches these against the samples, which it timestamps with
+// CLOCK_MONOTONIC when recording with -k mono.
+static uint64_t timestamp() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * NANOSECS_PER_SEC + (uint64_t)ts.tv_nsec;
+}
+
+static bool write_fully(const void* buf, size_t size) {
+  const char* p = (const char*)buf;
+  while (size > 0) {
+    ssize_t n = ::write(_fd, p, size);
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    p += n;
+    size -= (size_t)n;
+  }
+  return true;
+}
+
+void JitDump::initialize() {
+  assert(_fd == -1, "already initialized");
+  char fname[32];
+  jio_snprintf(fname, sizeof(fname), "/tmp/jit-%d.dump", os::current_process_id());
+  // /tmp is shared, do not follow a symbolic link planted there and keep
+  // the dump, which lists the compiled code of the process, private.
+  int fd = ::open(fname, O_CREAT | O_TRUNC | O_RDWR | O_APPEND | O_CLOEXEC | O_NOFOLLOW, 0600);
+  if (fd == -1) {
+    log_warning(codecache)("Failed to create %s for jitdump: %s", fname, os::strerror(errno));
+    return;
+  }
+  // perf finds the dump through an executable mapping of it in the
+  // recorded process, the mapping itself is never used.
+  void* marker = ::mmap(nullptr, os::vm_page_size(), PROT_READ | PROT_EXEC, MAP_PRIVATE, fd, 0);
+  if (marker == MAP_FAILED) {
+    log_warning(codecache)("Failed to map %s for jitdump: %s", fname, os::strerror(errno));
+    ::close(fd);
+    return;
+  }
+  JitDumpFileHeader header;
+  memset(&header, 0, sizeof(header));
+  header.magic = JITDUMP_MAGIC;
+  header.version = JITDUMP_VERSION;
+  header.total_size = sizeof(header);
+  header.elf_mach = elf_mach();
+  header.pid = (uint32_t)os::current_process_id();
+  header.timestamp = timestamp();
+  _fd = fd;
+  if (!write_fully(&header, sizeof(header))) {
+    log_warning(codecache)("Failed to write %s for jitdump: %s", fname, os::strerror(errno));
+    ::close(fd);
+    _fd = -1;
+    return;
+  }
+  log_info(codecache)("Writing jitdump to %s", fname);
+}
+
+struct JitDumpLine {
+  address pc;
+  int line;
+  const char* file;
+};
+
+static const char* source_file_name(Method* m) {
+  Symbol* name = m->method_holder()->source_file_name();
+  return name != nullptr ? name->as_C_string() : m->method_holder()->external_name();
+}
+
+static void append(u1* buf, size_t* pos, const void* data, size_t size) {
+  memcpy(buf + *pos, data, size);
+  *pos += size;
+}
+
+void JitDump::write_nmethod(nmethod* nm) {
+  if (_fd == -1) {
+    return;
+  }
+  ResourceMark rm;
+  const char* name = nm->method()->external_name();
+  const uint64_t now = timestamp();
+
+  // Line numbers of the innermost scope at each PcDesc.
+  GrowableArray<JitDumpLine> lines;
+  size_t debug_size = sizeof(JitDumpDebugInfo);
+  for (PcDesc* pd = nm->scopes_pcs_begin(); pd < nm->scopes_pcs_end(); pd++) {
+    if (pd->scope_decode_offset() == DebugInformationRecorder::serialized_null) {
+      continue;
+    }
+    address pc = pd->real_pc(nm);
+    if (pc < nm->code_begin() || pc >= nm->code_end()) {
+      continue;
+    }
+    ScopeDesc sd(nm, pd, true);
+    int line = sd.method()->line_number_from_bci(sd.bci());
+    if (line < 0) {
+      continue;
+    }
+    JitDumpLine l = { pc, line, source_file_name(sd.method()) };
+    lines.append(l);
+    debug_size += sizeof(JitDumpDebugEntry) + strlen(l.file) + 1;
+  }
+
+  const size_t code_size = nm->code_end() - nm->code_begin();
+  const size_t load_size = sizeof(JitDumpCodeLoad) + strlen(name) + 1 + code_size;
+  const size_t total = (lines.is_empty() ? 0 : debug_size) + load_size;
+  u1* buf = NEW_RESOURCE_ARRAY(u1, total);
+  size_t pos = 0;
+
+  // perf attaches the debug info record to the code load record that
+  // directly follows it, so both go out in a single write.
+  if (!lines.is_empty()) {
+    JitDumpDebugInfo info;
+    info.header.id = JIT_CODE_DEBUG_INFO;
+    info.header.total_size = (uint32_t)debug_size;
+    info.header.timestamp = now;
+    info.code_addr = (uint64_t)nm->code_begin();
+    info.nr_entry = (uint64_t)lines.length();
+    append(buf, &pos, &info, sizeof(info));
+    for (int i = 0; i < lines.length(); i++) {
+      JitDumpDebugEntry entry;
+      entry.addr = (uint64_t)lines.at(i).pc;
+      entry.lineno = lines.at(i).line;
+      entry.discrim = 0;
+      append(buf, &pos, &entry, sizeof(entry));
+      append(buf, &pos, lines.at(i).file, strlen(lines.at(i).file) + 1);
+    }
+  }
+
+  JitDumpCodeLoad load;
+  load.header.id = JIT_CODE_LOAD;
+  load.header.total_size = (uint32_t)load_size;
+  load.header.timestamp = now;
+  load.pid = (uint32_t)os::current_process_id();
+  load.tid = (uint32_t)os::current_thread_id();
+  load.vma = (uint64_t)nm->code_begin();
+  load.code_addr = (uint64_t)nm->code_begin();
+  load.code_size = (uint64_t)code_size;
+  load.code_index = Atomic::add(&_code_index, (uint64_t)1);
+  append(buf, &pos, &load, sizeof(load));
+  append(buf, &pos, name, strlen(name) + 1);
+  append(buf, &pos, nm->code_begin(), code_size);
+  assert(pos == total, "must be");
+
+  // O_APPEND makes a single write of the records atomic with respect to
+  // records written by other compiler threads.
+  ssize_t n;
+  do {
+    n = ::write(_fd, buf, total);
+  } while (n < 0 && errno == EINTR);
+  if (n != (ssize_t)total) {
+    log_debug(codecache)("Failed to write jitdump record for %s", name);
+  }
+}
+
+#endif // LINUX
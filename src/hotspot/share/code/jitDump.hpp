@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_CODE_JITDUMP_HPP
+#define SHARE_CODE_JITDUMP_HPP
+
+#include "memory/allStatic.hpp"
+
+class nmethod;
+
+// Writes /tmp/jit-<pid>.dump in the jitdump format read by "perf inject
+// --jit", with a code load record for each nmethod as it is installed,
+// preceded by the line numbers of its PcDescs, innermost inlined scope
+// first. The records carry CLOCK_MONOTONIC timestamps, so perf attributes
+// samples correctly even after code cache space is reused by later nmethods.
+// Record with "perf record -k mono". Linux only.
+class JitDump : AllStatic {
+ public:
+  static void initialize();
+  static void write_nmethod(nmethod* nm);
+};
+
+#endif // SHARE_CODE_JITDUMP_HPP
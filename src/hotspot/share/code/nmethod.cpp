@@ -28,6 +28,7 @@
 #include "code/compiledIC.hpp"
 #include "code/compiledMethod.inline.hpp"
 #include "code/dependencies.hpp"
+#include "code/jitDump.hpp"
 #include "code/nativeInst.hpp"
 #include "code/nmethod.hpp"
 #include "code/scopeDesc.hpp"
@@ -577,7 +578,7 @@ nmethod* nmethod::new_nmethod(const methodHandle& method,
   {
     MutexLocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
 
-    nm = new (nmethod_size, comp_level)
+    nm = new (nmethod_size, CodeCache::get_code_blob_type(method(), comp_level))
     nmethod(method(), compiler->type(), nmethod_size, compile_id, entry_bci, offsets,
             orig_pc_offset, debug_info, dependencies, code_buffer, frame_size,
             oop_maps,
@@ -748,8 +749,8 @@ nmethod::nmethod(
   }
 }
 
-void* nmethod::operator new(size_t size, int nmethod_size, int comp_level) throw () {
-  return CodeCache::allocate(nmethod_size, CodeCache::get_code_blob_type(comp_level));
+void* nmethod::operator new(size_t size, int nmethod_size, CodeBlobType code_blob_type) throw () {
+  return CodeCache::allocate(nmethod_size, code_blob_type);
 }
 
 void* nmethod::operator new(size_t size, int nmethod_size, bool allow_NonNMethod_space) throw () {
@@ -1447,7 +1448,8 @@ void nmethod::unlink() {
 void nmethod::purge(bool free_code_cache_data, bool unregister_nmethod) {
   assert(!free_code_cache_data, "must only call not freeing code cache data");
 
-  MutexLocker ml(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+  // The caller may hold the lock across purging many nmethods.
+  MutexLocker ml(CodeCache_lock->owned_by_self() ? nullptr : CodeCache_lock, Mutex::_no_safepoint_check_flag);
 
   // completely deallocate this method
   Events::log_nmethod_flush(Thread::current(), "flushing %s nmethod " INTPTR_FORMAT, is_osr_method() ? "osr" : "", p2i(this));
@@ -1523,6 +1525,12 @@ void nmethod::post_compiled_method(CompileTask* task) {
   // JVMTI -- compiled method notification (must be done outside lock)
   post_compiled_method_load_event();
 
+#ifdef LINUX
+  if (WriteJitDump) {
+    JitDump::write_nmethod(this);
+  }
+#endif
+
   if (CompilationLog::log() != nullptr) {
     CompilationLog::log()->log_nmethod(JavaThread::current(), this);
   }
@@ -624,6 +624,7 @@ CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue) {
   Method* max_method = nullptr;
 
   jlong t = nanos_to_millis(os::javaTimeNanos());
+  const jlong queue_t = os::elapsed_counter();
   // Iterate through the queue and find a method with a maximum rate.
   for (CompileTask* task = compile_queue->first(); task != nullptr;) {
     CompileTask* next_task = task->next();
@@ -645,15 +646,28 @@ CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue) {
       task = next_task;
       continue;
     }
+    // Under a compile storm tier 2 and 3 tasks can wait so long that the profile they
+    // would collect is no longer worth it. If the method is still hot it gets queued again.
+    if (TieredCompileTaskQueueDeadline > 0 && task->can_become_stale() &&
+        (task->comp_level() == CompLevel_limited_profile || task->comp_level() == CompLevel_full_profile) &&
+        queued_millis(queue_t, task) > TieredCompileTaskQueueDeadline && !is_old(mh)) {
+      if (PrintTieredEvents) {
+        print_event(REMOVE_FROM_QUEUE, method, method, task->osr_bci(), (CompLevel) task->comp_level());
+      }
+      method->clear_queued_for_compilation();
+      compile_queue->remove_and_mark_stale(task);
+      task = next_task;
+      continue;
+    }
     update_rate(t, mh);
-    if (max_task == nullptr || compare_methods(method, max_method)) {
+    if (max_task == nullptr || compare_tasks(queue_t, task, max_task)) {
       // Select a method with the highest rate
       max_task = task;
       max_method = method;
     }
 
     if (task->is_blocking()) {
-      if (max_blocking_task == nullptr || compare_methods(method, max_blocking_task->method())) {
+      if (max_blocking_task == nullptr || compare_tasks(queue_t, task, max_blocking_task)) {
         max_blocking_task = task;
       }
     }
@@ -891,6 +905,25 @@ bool CompilationPolicy::compare_methods(Method* x, Method* y) {
   return false;
 }
 
+jlong CompilationPolicy::queued_millis(jlong t, CompileTask* task) {
+  return (t - task->time_queued()) * MILLIUNITS / os::elapsed_frequency();
+}
+
+bool CompilationPolicy::compare_tasks(jlong t, CompileTask* x, CompileTask* y) {
+  if (TieredCompileTaskAging == 0) {
+    return compare_methods(x->method(), y->method());
+  }
+  Method* const xm = x->method();
+  Method* const ym = y->method();
+  if (xm->highest_comp_level() != ym->highest_comp_level()) {
+    // recompilation after deopt
+    return xm->highest_comp_level() > ym->highest_comp_level();
+  }
+  const double x_age = 1.0 + (double)queued_millis(t, x) / TieredCompileTaskAging;
+  const double y_age = 1.0 + (double)queued_millis(t, y) / TieredCompileTaskAging;
+  return weight(xm) * x_age > weight(ym) * y_age;
+}
+
 // Is method profiled enough?
 bool CompilationPolicy::is_method_profiled(const methodHandle& method) {
   MethodData* mdo = method->method_data();
@@ -205,6 +205,10 @@ class CompilationPolicy : AllStatic {
   inline static double weight(Method* method);
   // Apply heuristics and return true if x should be compiled before y
   inline static bool compare_methods(Method* x, Method* y);
+  // Milliseconds a task has been waiting in the queue at time t (elapsed counter ticks).
+  inline static jlong queued_millis(jlong t, CompileTask* task);
+  // Like compare_methods(), but ages the weights by the time the tasks have been queued.
+  inline static bool compare_tasks(jlong t, CompileTask* x, CompileTask* y);
   // Compute event rate for a given method. The rate is the number of event (invocations + backedges)
   // per millisecond.
   inline static void update_rate(jlong t, const methodHandle& method);
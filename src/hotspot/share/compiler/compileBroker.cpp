@@ -122,6 +122,7 @@
 bool CompileBroker::_initialized = false;
 volatile bool CompileBroker::_should_block = false;
 volatile int  CompileBroker::_print_compilation_warning = 0;
+volatile int  CompileBroker::_active_compilations = 0;
 volatile jint CompileBroker::_should_compile_new_jobs = run_compilation;
 
 // The installed compiler(s)
@@ -1009,22 +1010,61 @@ void CompileBroker::init_compiler_threads() {
 #endif // defined(ASSERT) && COMPILER2_OR_JVMCI
 }
 
-void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
+// The number of processors the compiler threads may use without taking them
+// away from the rest of the process. The active processor count is queried
+// again every time, so that changes of the container CPU quota are seen.
+int CompileBroker::idle_processors_for_compilation() {
+  double load;
+  if (os::loadavg(&load, 1) != 1) {
+    return max_jint;
+  }
+  // The load average is taken over the whole machine, scale it to the
+  // processors available to this process, as limited by a container.
+  const int active_processors = os::active_processor_count();
+  const double available_load = load * active_processors / os::processor_count();
+  // The load includes the compiler threads that are compiling. Idle
+  // compiler threads are blocked on their queue and do not add to it.
+  const int busy = MAX2((int)available_load - Atomic::load(&_active_compilations), 0);
+  return MAX2(active_processors - busy, 1);
+}
+
+void CompileBroker::possibly_add_compiler_threads(CompileTask* task, JavaThread* THREAD) {
 
   julong free_memory = os::free_memory();
   // If SegmentedCodeCache is off, both values refer to the single heap (with type CodeBlobType::All).
   size_t available_cc_np  = CodeCache::unallocated_capacity(CodeBlobType::MethodNonProfiled),
          available_cc_p   = CodeCache::unallocated_capacity(CodeBlobType::MethodProfiled);
 
+  // How long the task that was just compiled waited in its queue.
+  jlong queued_ms = 0;
+  if (CompilerThreadLatencyTarget > 0 && task->time_started() != 0) {
+    queued_ms = (task->time_started() - task->time_queued()) * MILLIUNITS / os::elapsed_frequency();
+  }
+  bool late_c1 = false;
+  bool late_c2 = false;
+  if (queued_ms > CompilerThreadLatencyTarget) {
+    late_c1 = task->compiler() == _compilers[0];
+    late_c2 = task->compiler() == _compilers[1];
+  }
+  int idle_processors = ThrottleCompilerThreadsOnLoad ? idle_processors_for_compilation() : 0;
+
   // Only do attempt to start additional threads if the lock is free.
   if (!CompileThread_lock->try_lock()) return;
 
   if (_c2_compile_queue != nullptr) {
     int old_c2_count = _compilers[1]->num_compiler_threads();
+    int wanted_c2 = _c2_compile_queue->size() / 2;
+    if (late_c2 && !_c2_compile_queue->is_empty()) {
+      wanted_c2 = MAX2(wanted_c2, old_c2_count + 1);
+    }
     int new_c2_count = MIN4(_c2_count,
-        _c2_compile_queue->size() / 2,
+        wanted_c2,
         (int)(free_memory / (200*M)),
         (int)(available_cc_np / (128*K)));
+    if (ThrottleCompilerThreadsOnLoad) {
+      int c1_count = _compilers[0] != nullptr ? _compilers[0]->num_compiler_threads() : 0;
+      new_c2_count = MIN2(new_c2_count, MAX2(old_c2_count, idle_processors - c1_count));
+    }
 
     for (int i = old_c2_count; i < new_c2_count; i++) {
 #if INCLUDE_JVMCI
@@ -1079,10 +1119,18 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
 
   if (_c1_compile_queue != nullptr) {
     int old_c1_count = _compilers[0]->num_compiler_threads();
+    int wanted_c1 = _c1_compile_queue->size() / 4;
+    if (late_c1 && !_c1_compile_queue->is_empty()) {
+      wanted_c1 = MAX2(wanted_c1, old_c1_count + 1);
+    }
     int new_c1_count = MIN4(_c1_count,
-        _c1_compile_queue->size() / 4,
+        wanted_c1,
         (int)(free_memory / (100*M)),
         (int)(available_cc_p / (128*K)));
+    if (ThrottleCompilerThreadsOnLoad) {
+      int c2_count = _compilers[1] != nullptr ? _compilers[1]->num_compiler_threads() : 0;
+      new_c1_count = MIN2(new_c1_count, MAX2(old_c1_count, idle_processors - c2_count));
+    }
 
     for (int i = old_c1_count; i < new_c1_count; i++) {
       JavaThread *ct = make_thread(compiler_t, compiler1_object(i), _c1_compile_queue, _compilers[0], THREAD);
@@ -1942,7 +1990,9 @@ void CompileBroker::compiler_thread_loop() {
       if (method()->number_of_breakpoints() == 0) {
         // Compile the method.
         if ((UseCompiler || AlwaysCompileLoopMethods) && CompileBroker::should_compile_new_jobs()) {
+          Atomic::inc(&_active_compilations);
           invoke_compiler_on_method(task);
+          Atomic::dec(&_active_compilations);
           thread->start_idle_timer();
         } else {
           // After compilation is disabled, remove remaining methods from queue
@@ -1954,7 +2004,7 @@ void CompileBroker::compiler_thread_loop() {
       }
 
       if (UseDynamicNumberOfCompilerThreads) {
-        possibly_add_compiler_threads(thread);
+        possibly_add_compiler_threads(task, thread);
         assert(!thread->has_pending_exception(), "should have been handled");
       }
     }
@@ -2100,6 +2150,8 @@ void CompileBroker::handle_compile_error(CompilerThread* thread, CompileTask* ta
 
 static void post_compilation_event(EventCompilation& event, CompileTask* task) {
   assert(task != nullptr, "invariant");
+  const jlong started = task->time_started() != 0 ? task->time_started() : os::elapsed_counter();
+  const jlong queue_time_ms = (started - task->time_queued()) * MILLIUNITS / os::elapsed_frequency();
   CompilerEvent::CompilationEvent::post(event,
                                         task->compile_id(),
                                         task->compiler()->type(),
@@ -2108,7 +2160,8 @@ static void post_compilation_event(EventCompilation& event, CompileTask* task) {
                                         task->is_success(),
                                         task->osr_bci() != CompileBroker::standard_entry_bci,
                                         task->nm_total_size(),
-                                        task->num_inlined_bytecodes());
+                                        task->num_inlined_bytecodes(),
+                                        queue_time_ms);
 }
 
 int DirectivesStack::_depth = 0;
@@ -227,6 +227,9 @@ class CompileBroker: AllStatic {
 
   static volatile int _print_compilation_warning;
 
+  // Number of compiler threads currently compiling a method
+  static volatile int _active_compilations;
+
   enum ThreadType {
     compiler_t,
     deoptimizer_t
@@ -235,7 +238,8 @@ class CompileBroker: AllStatic {
   static Handle create_thread_oop(const char* name, TRAPS);
   static JavaThread* make_thread(ThreadType type, jobject thread_oop, CompileQueue* queue, AbstractCompiler* comp, JavaThread* THREAD);
   static void init_compiler_threads();
-  static void possibly_add_compiler_threads(JavaThread* THREAD);
+  static int idle_processors_for_compilation();
+  static void possibly_add_compiler_threads(CompileTask* task, JavaThread* THREAD);
   static bool compilation_is_prohibited(const methodHandle& method, int osr_bci, int comp_level, bool excluded);
 
   static CompileTask* create_compile_task(CompileQueue*       queue,
@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "classfile/classLoaderDataGraph.hpp"
+#include "classfile/symbolTable.hpp"
+#include "compiler/compilePlan.hpp"
+#include "compiler/compiler_globals.hpp"
+#include "interpreter/invocationCounter.hpp"
+#include "logging/log.hpp"
+#include "memory/allocation.hpp"
+#include "memory/resourceArea.hpp"
+#include "oops/instanceKlass.hpp"
+#include "oops/method.hpp"
+#include "oops/methodCounters.hpp"
+#include "oops/symbol.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
+#include "utilities/ostream.hpp"
+#include "utilities/resourceHash.hpp"
+
+class CompilePlanEntry : public CHeapObj<mtCompiler> {
+ public:
+  Symbol* const _name;
+  Symbol* const _signature;
+  const int _level;
+  const uint _invocations;
+  const uint _backedges;
+  CompilePlanEntry* const _next;
+
+  CompilePlanEntry(Symbol* name, Symbol* signature, int level,
+                   uint invocations, uint backedges, CompilePlanEntry* next) :
+    _name(name), _signature(signature), _level(level),
+    _invocations(invocations), _backedges(backedges), _next(next) {}
+};
+
+// Class name -> planned methods. Only written during initialization.
+typedef ResourceHashtable<const Symbol*, CompilePlanEntry*, 1009,
+                          AnyObj::C_HEAP, mtCompiler, Symbol::compute_hash> CompilePlanTable;
+static CompilePlanTable* _table = nullptr;
+static int _entries = 0;
+
+// Do not let a seeded counter get close to setting the carry bit.
+static const uint max_seeded_count = InvocationCounter::count_limit / 4;
+
+static void parse_line(const char* line, int line_number) {
+  if (line[0] == '#' || line[0] == '\0') {
+    return;
+  }
+  int level;
+  uint invocations;
+  uint backedges;
+  char klass[1024];
+  char name[256];
+  char signature[1024];
+  if (sscanf(line, "%d %u %u %1023s %255s %1023s",
+             &level, &invocations, &backedges, klass, name, signature) != 6 ||
+      level <= CompLevel_none || level > CompLevel_full_optimization) {
+    log_warning(jit, compilation)("Ignoring malformed line %d of compile plan %s", line_number, CompilePlanFile);
+    return;
+  }
+  Symbol* const klass_name = SymbolTable::new_permanent_symbol(klass);
+  CompilePlanEntry** const head = _table->get(klass_name);
+  CompilePlanEntry* const entry =
+    new CompilePlanEntry(SymbolTable::new_permanent_symbol(name),
+                         SymbolTable::new_permanent_symbol(signature),
+                         level, invocations, backedges,
+                         head != nullptr ? *head : nullptr);
+  _table->put(klass_name, entry);
+  _entries++;
+}
+
+void CompilePlan::initialize() {
+  if (CompilePlanFile == nullptr) {
+    return;
+  }
+  FILE* stream = os::fopen(CompilePlanFile, "rt");
+  if (stream == nullptr) {
+    log_warning(jit, compilation)("Could not open compile plan %s", CompilePlanFile);
+    return;
+  }
+  _table = new (mtCompiler) CompilePlanTable();
+
+  char line[4096];
+  int line_number = 0;
+  while (fgets(line, sizeof(line), stream) != nullptr) {
+    line_number++;
+    size_t len = strlen(line);
+    if (len > 0 && line[len - 1] == '\n') {
+      line[--len] = '\0';
+    }
+    parse_line(line, line_number);
+  }
+  fclose(stream);
+
+  log_info(jit, compilation)("Loaded %d methods from compile plan %s", _entries, CompilePlanFile);
+}
+
+bool CompilePlan::is_enabled() {
+  return _table != nullptr;
+}
+
+void CompilePlan::apply(InstanceKlass* ik, TRAPS) {
+  if (_table == nullptr) {
+    return;
+  }
+  CompilePlanEntry** const head = _table->get(ik->name());
+  if (head == nullptr) {
+    return;
+  }
+  for (CompilePlanEntry* e = *head; e != nullptr; e = e->_next) {
+    Method* const m = ik->find_method(e->_name, e->_signature);
+    if (m == nullptr || m->is_abstract() || m->is_native()) {
+      continue;
+    }
+    MethodCounters* const mcs = m->get_method_counters(THREAD);
+    if (mcs == nullptr) {
+      // Out of metaspace, the method just warms up as usual.
+      continue;
+    }
+    mcs->invocation_counter()->set(MIN2(e->_invocations, max_seeded_count));
+    mcs->backedge_counter()->set(MIN2(e->_backedges, max_seeded_count));
+    if (log_is_enabled(Debug, jit, compilation)) {
+      ResourceMark rm(THREAD);
+      log_debug(jit, compilation)("Seeded counters of %s for level %d", m->name_and_sig_as_C_string(), e->_level);
+    }
+  }
+}
+
+static fileStream* _dump_stream = nullptr;
+static int _dumped = 0;
+
+static void dump_method(Method* m) {
+  const int level = m->highest_comp_level();
+  if (level <= CompLevel_none || m->is_native()) {
+    return;
+  }
+  ResourceMark rm;
+  _dump_stream->print_cr("%d %d %d %s %s %s", level, m->invocation_count(), m->backedge_count(),
+                         m->method_holder()->name()->as_C_string(),
+                         m->name()->as_C_string(),
+                         m->signature()->as_C_string());
+  _dumped++;
+}
+
+void CompilePlan::dump_at_exit() {
+  if (DumpCompilePlanFile == nullptr) {
+    return;
+  }
+  fileStream fs(DumpCompilePlanFile, "w");
+  if (!fs.is_open()) {
+    log_warning(jit, compilation)("Could not open compile plan %s for writing", DumpCompilePlanFile);
+    return;
+  }
+  fs.print_cr("# <level> <invocations> <backedges> <class> <method> <signature>");
+  _dump_stream = &fs;
+  {
+    MutexLocker ml(ClassLoaderDataGraph_lock);
+    ClassLoaderDataGraph::methods_do(dump_method);
+  }
+  _dump_stream = nullptr;
+
+  log_info(jit, compilation)("Wrote %d methods to compile plan %s", _dumped, DumpCompilePlanFile);
+}
+
+void compilePlan_init() {
+  CompilePlan::initialize();
+}
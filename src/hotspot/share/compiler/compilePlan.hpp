@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_COMPILER_COMPILEPLAN_HPP
+#define SHARE_COMPILER_COMPILEPLAN_HPP
+
+#include "memory/allStatic.hpp"
+#include "utilities/exceptions.hpp"
+
+class InstanceKlass;
+
+// A compile plan is a list of the methods a previous run compiled, with the
+// highest tier they reached and their invocation and backedge counts. It is
+// written at exit with -XX:DumpCompilePlanFile and read at startup with
+// -XX:CompilePlanFile. When a class in the plan is linked, the counters of its
+// planned methods are seeded with the recorded counts, so the first counter
+// overflow notification already asks CompilationPolicy to compile them,
+// instead of the methods spending their warm-up in the interpreter.
+//
+// Each line of the file is
+//   <level> <invocations> <backedges> <class> <method> <signature>
+// with the class name in internal form. Lines starting with '#' are ignored.
+class CompilePlan : AllStatic {
+ public:
+  static void initialize();
+  static bool is_enabled();
+
+  // Seeds the counters of the planned methods of ik.
+  static void apply(InstanceKlass* ik, TRAPS);
+
+  static void dump_at_exit();
+};
+
+#endif // SHARE_COMPILER_COMPILEPLAN_HPP
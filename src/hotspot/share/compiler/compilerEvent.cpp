@@ -134,7 +134,7 @@ static inline void commit(EventType& event) {
   }
  }
 
-void CompilerEvent::CompilationEvent::post(EventCompilation& event, int compile_id, CompilerType compiler_type, Method* method, int compile_level, bool success, bool is_osr, int code_size, int inlined_bytecodes) {
+void CompilerEvent::CompilationEvent::post(EventCompilation& event, int compile_id, CompilerType compiler_type, Method* method, int compile_level, bool success, bool is_osr, int code_size, int inlined_bytecodes, jlong queue_time_ms) {
   event.set_compileId(compile_id);
   event.set_compiler(compiler_type);
   event.set_method(method);
@@ -143,6 +143,7 @@ void CompilerEvent::CompilationEvent::post(EventCompilation& event, int compile_
   event.set_isOsr(is_osr);
   event.set_codeSize(code_size);
   event.set_inlinedBytes(inlined_bytecodes);
+  event.set_queueTime(queue_time_ms);
   commit(event);
 }
 
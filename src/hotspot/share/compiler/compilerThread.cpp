@@ -39,6 +39,9 @@ CompilerThread::CompilerThread(CompileQueue* queue,
   _counters = counters;
   _buffer_blob = nullptr;
   _compiler = nullptr;
+  _arena_bytes = 0;
+  _arena_limit_hit = nullptr;
+  _arena_limit = 0;
 
   // Compiler uses resource area for compilation, let's bias it to mtCompiler
   resource_area()->bias_to(mtCompiler);
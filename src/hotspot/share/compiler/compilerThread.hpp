@@ -54,6 +54,12 @@ class CompilerThread : public JavaThread {
   AbstractCompiler*     _compiler;
   TimeStamp             _idle_time;
 
+  // Net growth of the mtCompiler arenas resized by this thread.
+  ssize_t               _arena_bytes;
+  // Set to true once _arena_bytes exceeds _arena_limit, if not null.
+  bool*                 _arena_limit_hit;
+  ssize_t               _arena_limit;
+
  public:
 
   static CompilerThread* current() {
@@ -96,6 +102,19 @@ class CompilerThread : public JavaThread {
     _log = log;
   }
 
+  ssize_t arena_bytes() const                    { return _arena_bytes; }
+  void add_arena_bytes(ssize_t delta) {
+    _arena_bytes += delta;
+    if (_arena_limit_hit != nullptr && _arena_bytes > _arena_limit) {
+      *_arena_limit_hit = true;
+    }
+  }
+  // Sets *hit to true once the arenas grow past limit; a null hit removes the limit.
+  void set_arena_limit(ssize_t limit, bool* hit) {
+    _arena_limit = limit;
+    _arena_limit_hit = hit;
+  }
+
   void start_idle_timer()                        { _idle_time.update(); }
   jlong idle_time_millis() {
     return TimeHelper::counter_to_millis(_idle_time.ticks_since_update());
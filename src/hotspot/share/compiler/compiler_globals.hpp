@@ -248,6 +248,18 @@
           "given timeout in milliseconds")                                  \
           range(0, max_intx)                                                \
                                                                             \
+  product(intx, TieredCompileTaskQueueDeadline, 0, EXPERIMENTAL,            \
+          "Kill tier 2 and 3 compile tasks that have waited in the queue "  \
+          "for longer than this many milliseconds, unless the method is "   \
+          "old. 0 disables the deadline")                                   \
+          range(0, max_intx)                                                \
+                                                                            \
+  product(intx, TieredCompileTaskAging, 0, EXPERIMENTAL,                    \
+          "Add the weight of a compile task to itself for every this many " \
+          "milliseconds it has waited in the queue, so that tasks are not " \
+          "starved by a flood of newer ones. 0 disables aging")             \
+          range(0, max_intx)                                                \
+                                                                            \
   product(intx, TieredStopAtLevel, 4,                                       \
           "Stop at given compilation level")                                \
           range(0, 4)                                                       \
@@ -299,6 +311,14 @@
   product(ccstr, CompileCommandFile, nullptr,                               \
           "Read compiler commands from this file [.hotspot_compiler]")      \
                                                                             \
+  product(ccstr, DumpCompilePlanFile, nullptr, EXPERIMENTAL,                \
+          "Write the methods compiled by this run, with their highest "     \
+          "compilation level and counters, to this file at exit")           \
+                                                                            \
+  product(ccstr, CompilePlanFile, nullptr, EXPERIMENTAL,                    \
+          "Seed the counters of the methods in this compile plan, written " \
+          "by DumpCompilePlanFile, when their class is linked")             \
+                                                                            \
   product(ccstr, CompilerDirectivesFile, nullptr, DIAGNOSTIC,               \
           "Read compiler directives from this file")                        \
                                                                             \
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/epsilon/epsilonArenaDCmd.hpp"
+#include "gc/epsilon/epsilonHeap.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/vmOperation.hpp"
+#include "runtime/vmThread.hpp"
+#include "utilities/ostream.hpp"
+
+class VM_EpsilonArena : public VM_Operation {
+private:
+  const bool _reset;
+  outputStream* const _out;
+  bool _result;
+
+public:
+  VM_EpsilonArena(bool reset, outputStream* out) :
+    _reset(reset), _out(out), _result(false) {}
+
+  VMOp_Type type() const { return VMOp_EpsilonArena; }
+
+  void doit() {
+    EpsilonHeap* const heap = EpsilonHeap::heap();
+    if (_reset) {
+      _result = heap->arena_reset(_out);
+    } else {
+      heap->arena_mark(_out);
+      _result = true;
+    }
+  }
+
+  bool result() const { return _result; }
+};
+
+EpsilonArenaDCmd::EpsilonArenaDCmd(outputStream* output, bool heap) :
+  DCmdWithParser(output, heap),
+  _action("action", "mark: start an arena at the current heap top, "
+          "reset: release everything allocated since the mark", "STRING", true) {
+  _dcmdparser.add_dcmd_argument(&_action);
+}
+
+void EpsilonArenaDCmd::execute(DCmdSource source, TRAPS) {
+  if (!UseEpsilonGC || !EpsilonArenas) {
+    output()->print_cr("Arenas need -XX:+UseEpsilonGC and -XX:+EpsilonArenas");
+    return;
+  }
+
+  bool reset;
+  if (strcmp(_action.value(), "mark") == 0) {
+    reset = false;
+  } else if (strcmp(_action.value(), "reset") == 0) {
+    reset = true;
+  } else {
+    output()->print_cr("Unknown action: %s, expected mark or reset", _action.value());
+    return;
+  }
+
+  VM_EpsilonArena op(reset, output());
+  VMThread::execute(&op);
+}
@@ -24,20 +24,33 @@
  */
 
 #include "precompiled.hpp"
+#include "classfile/classLoaderData.hpp"
+#include "classfile/classLoaderDataGraph.hpp"
+#include "code/codeCache.hpp"
 #include "gc/epsilon/epsilonHeap.hpp"
 #include "gc/epsilon/epsilonInitLogger.hpp"
 #include "gc/epsilon/epsilonMemoryPool.hpp"
 #include "gc/epsilon/epsilonThreadLocalData.hpp"
 #include "gc/shared/gcArguments.hpp"
 #include "gc/shared/locationPrinter.inline.hpp"
+#include "gc/shared/oopStorage.inline.hpp"
+#include "gc/shared/oopStorageSet.hpp"
+#include "gc/shared/spaceDecorator.hpp"
 #include "logging/log.hpp"
 #include "memory/allocation.hpp"
 #include "memory/allocation.inline.hpp"
+#include "memory/iterator.inline.hpp"
 #include "memory/metaspaceUtils.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
+#include "oops/access.inline.hpp"
+#include "oops/compressedOops.inline.hpp"
+#include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/globals.hpp"
+#include "runtime/safepoint.hpp"
+#include "runtime/threads.hpp"
+#include "utilities/enumIterator.hpp"
 
 jint EpsilonHeap::initialize() {
   size_t align = HeapAlignment;
@@ -298,6 +311,104 @@ void EpsilonHeap::object_iterate(ObjectClosure *cl) {
   _space->object_iterate(cl);
 }
 
+// Counts the references into [_start, _end).
+class EpsilonArenaReferenceClosure : public BasicOopIterateClosure {
+private:
+  HeapWord* const _start;
+  HeapWord* const _end;
+  size_t _count;
+
+  template <class T>
+  void do_oop_work(T* p) {
+    T o = RawAccess<>::oop_load(p);
+    if (!CompressedOops::is_null(o)) {
+      HeapWord* const addr = cast_from_oop<HeapWord*>(CompressedOops::decode_not_null(o));
+      if (addr >= _start && addr < _end) {
+        _count++;
+      }
+    }
+  }
+
+public:
+  EpsilonArenaReferenceClosure(HeapWord* start, HeapWord* end) :
+    _start(start), _end(end), _count(0) {}
+
+  void do_oop(oop* p)       { do_oop_work(p); }
+  void do_oop(narrowOop* p) { do_oop_work(p); }
+
+  size_t count() const { return _count; }
+};
+
+size_t EpsilonHeap::count_arena_references(HeapWord* arena_start, HeapWord* arena_end) {
+  EpsilonArenaReferenceClosure cl(arena_start, arena_end);
+
+  // Roots. Weak roots count too: nothing would clear them after the reset.
+  Threads::oops_do(&cl, nullptr);
+  for (auto id : EnumRange<OopStorageSet::Id>()) {
+    OopStorageSet::storage(id)->oops_do(&cl);
+  }
+  CLDToOopClosure cld_cl(&cl, ClassLoaderData::_claim_none);
+  ClassLoaderDataGraph::cld_do(&cld_cl);
+  CodeBlobToOopClosure blobs(&cl, false /* fix_relocations */);
+  CodeCache::blobs_do(&blobs);
+
+  // Objects allocated before the mark
+  for (HeapWord* p = _space->bottom(); p < arena_start; ) {
+    oop obj = cast_to_oop(p);
+    obj->oop_iterate(&cl);
+    p += obj->size();
+  }
+
+  return cl.count();
+}
+
+void EpsilonHeap::arena_mark(outputStream* out) {
+  assert(SafepointSynchronize::is_at_safepoint(), "Must be at safepoint");
+
+  // Retire TLABs, so that everything allocated from now on is above the mark
+  ensure_parsability(true);
+
+  _arena_mark = _space->top();
+  log_info(gc)("Arena mark at " PTR_FORMAT ", " SIZE_FORMAT "%s used",
+               p2i(_arena_mark), byte_size_in_proper_unit(used()), proper_unit_for_byte_size(used()));
+  out->print_cr("Arena mark at " PTR_FORMAT, p2i(_arena_mark));
+}
+
+bool EpsilonHeap::arena_reset(outputStream* out) {
+  assert(SafepointSynchronize::is_at_safepoint(), "Must be at safepoint");
+
+  if (_arena_mark == nullptr) {
+    out->print_cr("No arena mark");
+    return false;
+  }
+
+  ensure_parsability(true);
+
+  HeapWord* const top = _space->top();
+  assert(_arena_mark <= top, "Arena mark above top");
+
+  // Always verify: a reference into the released memory would dangle into
+  // whatever is allocated there next.
+  const size_t references = count_arena_references(_arena_mark, top);
+  if (references > 0) {
+    log_warning(gc)("Arena reset refused: " SIZE_FORMAT " references into the arena", references);
+    out->print_cr("Arena reset refused: " SIZE_FORMAT " references into the arena", references);
+    return false;
+  }
+
+  const size_t released = pointer_delta(top, _arena_mark) * HeapWordSize;
+  if (ZapUnusedHeapArea) {
+    SpaceMangler::mangle_region(MemRegion(_arena_mark, top));
+  }
+  _space->set_top(_arena_mark);
+  _monitoring_support->update_counters();
+
+  log_info(gc)("Arena reset released " SIZE_FORMAT "%s",
+               byte_size_in_proper_unit(released), proper_unit_for_byte_size(released));
+  out->print_cr("Arena reset released " SIZE_FORMAT " bytes", released);
+  return true;
+}
+
 void EpsilonHeap::print_on(outputStream *st) const {
   st->print_cr("Epsilon Heap");
 
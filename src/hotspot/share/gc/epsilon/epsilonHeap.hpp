@@ -49,13 +49,15 @@ private:
   int64_t _decay_time_ns;
   volatile size_t _last_counter_update;
   volatile size_t _last_heap_print;
+  HeapWord* _arena_mark;
 
 public:
   static EpsilonHeap* heap();
 
   EpsilonHeap() :
           _memory_manager("Epsilon Heap"),
-          _space(nullptr) {};
+          _space(nullptr),
+          _arena_mark(nullptr) {};
 
   Name kind() const override {
     return CollectedHeap::Epsilon;
@@ -109,6 +111,14 @@ public:
   // Heap walking support
   void object_iterate(ObjectClosure* cl) override;
 
+  // Arenas, see EpsilonArenas. Both must be called at a safepoint.
+  // Starts a new arena at the current top of the heap.
+  void arena_mark(outputStream* out);
+  // Releases everything allocated since the arena mark, keeping the mark.
+  // Returns false, and keeps the heap unchanged, if there is no mark or the
+  // verification finds references into the arena.
+  bool arena_reset(outputStream* out);
+
   // Object pinning support: every object is implicitly pinned
   void pin_object(JavaThread* thread, oop obj) override { }
   void unpin_object(JavaThread* thread, oop obj) override { }
@@ -144,6 +154,8 @@ private:
   void print_heap_info(size_t used) const;
   void print_metaspace_info() const;
 
+  size_t count_arena_references(HeapWord* arena_start, HeapWord* arena_end);
+
 };
 
 #endif // SHARE_GC_EPSILON_EPSILONHEAP_HPP
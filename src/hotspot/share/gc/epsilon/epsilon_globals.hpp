@@ -86,7 +86,14 @@
   product(size_t, EpsilonMinHeapExpand, 128 * M, EXPERIMENTAL,              \
           "Min expansion step for heap. Larger value improves performance " \
           "at the potential expense of memory waste.")                      \
-          range(1, max_intx)
+          range(1, max_intx)                                                \
+                                                                            \
+  product(bool, EpsilonArenas, false, EXPERIMENTAL,                         \
+          "Allow the heap allocated after an arena mark to be released "    \
+          "with the GC.epsilon_arena diagnostic command. This is only "     \
+          "safe if nothing allocated before the mark, and no root, refers " \
+          "to the released objects. The reset walks the roots and the "     \
+          "heap below the mark first, and is refused otherwise.")
 
 // end of GC_EPSILON_FLAGS
 
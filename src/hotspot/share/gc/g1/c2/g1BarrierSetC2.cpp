@@ -300,38 +300,9 @@ void G1BarrierSetC2::pre_barrier(GraphKit* kit,
  * as part of the allocation in the case the allocated object is not located
  * in the nursery; this would happen for humongous objects.
  *
- * Returns true if the post barrier can be removed
+ * The check for that is shared with the other card table collectors, see
+ * CardTableBarrierSetC2::can_remove_post_barrier().
  */
-bool G1BarrierSetC2::g1_can_remove_post_barrier(GraphKit* kit,
-                                                PhaseValues* phase, Node* store,
-                                                Node* adr) const {
-  intptr_t      offset = 0;
-  Node*         base   = AddPNode::Ideal_base_and_offset(adr, phase, offset);
-  AllocateNode* alloc  = AllocateNode::Ideal_allocation(base, phase);
-
-  if (offset == Type::OffsetBot) {
-    return false; // cannot unalias unless there are precise offsets
-  }
-
-  if (alloc == nullptr) {
-     return false; // No allocation found
-  }
-
-  // Start search from Store node
-  Node* mem = store->in(MemNode::Control);
-  if (mem->is_Proj() && mem->in(0)->is_Initialize()) {
-
-    InitializeNode* st_init = mem->in(0)->as_Initialize();
-    AllocateNode*  st_alloc = st_init->allocation();
-
-    // Make sure we are looking at the same allocation
-    if (alloc == st_alloc) {
-      return true;
-    }
-  }
-
-  return false;
-}
 
 //
 // Update the card table and add card address to the queue
@@ -397,7 +368,7 @@ void G1BarrierSetC2::post_barrier(GraphKit* kit,
   }
 
   if (use_ReduceInitialCardMarks()
-      && g1_can_remove_post_barrier(kit, &kit->gvn(), oop_store, adr)) {
+      && can_remove_post_barrier(kit, &kit->gvn(), oop_store, adr)) {
     return;
   }
 
@@ -60,10 +60,6 @@ protected:
                                  BasicType bt,
                                  uint adr_idx) const;
 
-  bool g1_can_remove_post_barrier(GraphKit* kit,
-                                  PhaseValues* phase, Node* store,
-                                  Node* adr) const;
-
   void g1_mark_card(GraphKit* kit,
                     IdealKit& ideal,
                     Node* card_adr,
@@ -2184,12 +2184,22 @@ bool G1CollectedHeap::is_obj_dead_cond(const oop obj,
   return false; // keep some compilers happy
 }
 
+// Pinning only prevents the region containing the object from being moved, so
+// unlike the GCLocker it does not hold off garbage collections while a JNI
+// critical section is active.
 void G1CollectedHeap::pin_object(JavaThread* thread, oop obj) {
-  GCLocker::lock_critical(thread);
+  assert(obj != nullptr, "obj must not be null");
+  assert(!is_gc_active(), "must not pin objects during a GC pause");
+  assert(obj->is_typeArray(), "must be a primitive array");
+
+  heap_region_containing(obj)->increment_pinned_object_count();
 }
 
 void G1CollectedHeap::unpin_object(JavaThread* thread, oop obj) {
-  GCLocker::unlock_critical(thread);
+  assert(obj != nullptr, "obj must not be null");
+  assert(!is_gc_active(), "must not unpin objects during a GC pause");
+
+  heap_region_containing(obj)->decrement_pinned_object_count();
 }
 
 void G1CollectedHeap::print_heap_regions() const {
@@ -252,8 +252,11 @@ uint G1CollectionSetChooser::calculate_work_chunk_size(uint num_workers, uint nu
 }
 
 bool G1CollectionSetChooser::should_add(HeapRegion* hr) {
+  // Pinned regions can not be evacuated, do not spend time on them in mixed
+  // collections.
   return !hr->is_young() &&
          !hr->is_humongous() &&
+         !hr->has_pinned_objects() &&
          region_occupancy_low_enough_for_evac(hr->live_bytes()) &&
          hr->rem_set()->is_complete();
 }
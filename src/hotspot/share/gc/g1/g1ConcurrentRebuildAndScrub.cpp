@@ -145,6 +145,10 @@ class G1RebuildRSAndScrubTask : public WorkerTask {
       if (!_should_rebuild_remset) {
         // Not rebuilding, just step to next object.
         add_processed_words(obj_size);
+      } else if (obj->is_typeArray()) {
+        // Primitive arrays contain no references, so there is nothing to scan
+        // regardless of their size.
+        add_processed_words(1);
       } else if (obj_size > ProcessingYieldLimitInWords) {
         // Large object, needs to be chunked to avoid stalling safepoints.
         MemRegion mr(current, obj_size);
@@ -254,6 +258,14 @@ class G1RebuildRSAndScrubTask : public WorkerTask {
       assert(_bitmap->is_marked(humongous) || pb == hr->bottom(),
              "Humongous object not live");
 
+      if (humongous->is_typeArray()) {
+        // Humongous primitive arrays (typically large byte[] buffers) contain no
+        // references. Skip them instead of walking them chunk by chunk, so that
+        // the rebuild time does not grow with the amount of such buffers.
+        log_trace(gc, marking)("Rebuild skipped for humongous primitive array region: %u", hr->hrm_index());
+        return false;
+      }
+
       log_trace(gc, marking)("Rebuild for humongous region: " HR_FORMAT " pb: " PTR_FORMAT " TARS: " PTR_FORMAT,
                               HR_FORMAT_PARAMS(hr), p2i(pb), p2i(_cm->top_at_rebuild_start(hr->hrm_index())));
 
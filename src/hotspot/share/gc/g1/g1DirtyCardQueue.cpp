@@ -345,6 +345,9 @@ class G1RefineBufferedCards : public StackObj {
   const uint _worker_id;
   G1ConcurrentRefineStats* _stats;
   G1RemSet* const _g1rs;
+  // Cursor for batched refinement, see G1RefineBufferedCardsBatch.
+  size_t _first_clean;
+  size_t _next;
 
   static inline int compare_card(const CardTable::CardValue* p1,
                                  const CardTable::CardValue* p2) {
@@ -430,7 +433,9 @@ public:
     _node_buffer_size(node_buffer_size),
     _worker_id(worker_id),
     _stats(stats),
-    _g1rs(G1CollectedHeap::heap()->rem_set()) {}
+    _g1rs(G1CollectedHeap::heap()->rem_set()),
+    _first_clean(0),
+    _next(0) {}
 
   bool refine() {
     size_t first_clean_index = clean_cards();
@@ -450,6 +455,120 @@ public:
     sort_cards(first_clean_index);
     return refine_cleaned_cards(first_clean_index);
   }
+
+  // Batched refinement, in the steps of refine(). The caller issues the
+  // fence between clean() and sort() for the whole batch.
+
+  // Returns true if any cards are left to refine.
+  bool clean() {
+    _first_clean = clean_cards();
+    _next = _first_clean;
+    if (_first_clean == _node_buffer_size) {
+      _node->set_index(_first_clean);
+      return false;
+    }
+    return true;
+  }
+
+  void sort() {
+    sort_cards(_first_clean);
+  }
+
+  bool has_next() const {
+    return _next < _node_buffer_size;
+  }
+
+  CardTable::CardValue* peek() const {
+    assert(has_next(), "precondition");
+    return _node_buffer[_next];
+  }
+
+  void refine_next() {
+    assert(has_next(), "precondition");
+    _g1rs->refine_card_concurrently(_node_buffer[_next++], _worker_id);
+  }
+
+  // Ends batched refinement, redirtying the cards not refined because of
+  // a pending yield.
+  void finish() {
+    if (has_next()) {
+      redirty_unrefined_cards(_next);
+    }
+    _node->set_index(_next);
+    _stats->inc_refined_cards(_next - _first_clean);
+  }
+};
+
+// Refinement of the cards of several buffers at once. All buffers are
+// cleaned before any card is refined, so a card enqueued in more than one
+// of the buffers is refined only once. The cards are then refined in
+// decreasing address order across the buffers, by merging the sorted
+// buffers.
+class G1RefineBufferedCardsBatch : public StackObj {
+public:
+  // Upper bound of G1ConcRefinementBatchSize.
+  static const uint MaxBatchSize = 16;
+
+private:
+  alignas(G1RefineBufferedCards) uint8_t _storage[MaxBatchSize * sizeof(G1RefineBufferedCards)];
+  G1RefineBufferedCards* _cards[MaxBatchSize];
+  uint _count;
+
+  // Returns the buffer holding the card with the highest address, or
+  // nullptr if all cards have been refined.
+  G1RefineBufferedCards* next_buffer() const {
+    G1RefineBufferedCards* result = nullptr;
+    for (uint i = 0; i < _count; ++i) {
+      G1RefineBufferedCards* const cards = _cards[i];
+      if (cards->has_next() && (result == nullptr || cards->peek() > result->peek())) {
+        result = cards;
+      }
+    }
+    return result;
+  }
+
+public:
+  G1RefineBufferedCardsBatch(BufferNode* const* nodes,
+                             uint count,
+                             size_t node_buffer_size,
+                             uint worker_id,
+                             G1ConcurrentRefineStats* stats) :
+    _count(count) {
+    assert(count <= MaxBatchSize, "invariant");
+    for (uint i = 0; i < count; ++i) {
+      G1RefineBufferedCards* const storage =
+        reinterpret_cast<G1RefineBufferedCards*>(_storage) + i;
+      _cards[i] = ::new (storage) G1RefineBufferedCards(nodes[i], node_buffer_size, worker_id, stats);
+    }
+  }
+
+  bool refine() {
+    bool any_cards = false;
+    for (uint i = 0; i < _count; ++i) {
+      any_cards |= _cards[i]->clean();
+    }
+    if (!any_cards) {
+      return true;
+    }
+    // See G1RefineBufferedCards::refine().
+    OrderAccess::fence();
+    for (uint i = 0; i < _count; ++i) {
+      _cards[i]->sort();
+    }
+
+    bool result = true;
+    for (G1RefineBufferedCards* cards; (cards = next_buffer()) != nullptr; ) {
+      if (SuspendibleThreadSet::should_yield()) {
+        result = false;
+        break;
+      }
+      cards->refine_next();
+    }
+    for (uint i = 0; i < _count; ++i) {
+      _cards[i]->finish();
+    }
+    return result;
+  }
 };
 
 bool G1DirtyCardQueueSet::refine_buffer(BufferNode* node,
@@ -465,6 +584,17 @@ bool G1DirtyCardQueueSet::refine_buffer(BufferNode* node,
   return result;
 }
 
+bool G1DirtyCardQueueSet::refine_buffers(BufferNode* const* nodes,
+                                         uint count,
+                                         uint worker_id,
+                                         G1ConcurrentRefineStats* stats) {
+  Ticks start_time = Ticks::now();
+  G1RefineBufferedCardsBatch batch(nodes, count, buffer_size(), worker_id, stats);
+  bool result = batch.refine();
+  stats->inc_refinement_time(Ticks::now() - start_time);
+  return result;
+}
+
 void G1DirtyCardQueueSet::handle_refined_buffer(BufferNode* node,
                                                 bool fully_processed) {
   if (fully_processed) {
@@ -521,11 +651,33 @@ bool G1DirtyCardQueueSet::refine_completed_buffer_concurrently(uint worker_id,
   // Not enough cards to trigger processing.
   if (Atomic::load(&_num_cards) <= stop_at) return false;
 
-  BufferNode* node = get_completed_buffer();
-  if (node == nullptr) return false; // Didn't get a buffer to process.
+  if (G1ConcRefinementBatchSize == 1) {
+    BufferNode* node = get_completed_buffer();
+    if (node == nullptr) return false; // Didn't get a buffer to process.
 
-  bool fully_processed = refine_buffer(node, worker_id, stats);
-  handle_refined_buffer(node, fully_processed);
+    bool fully_processed = refine_buffer(node, worker_id, stats);
+    handle_refined_buffer(node, fully_processed);
+    return true;
+  }
+
+  // Take up to G1ConcRefinementBatchSize buffers, but not more than needed
+  // to get down to stop_at.
+  BufferNode* nodes[G1RefineBufferedCardsBatch::MaxBatchSize];
+  const uint max_count = MIN2(G1ConcRefinementBatchSize, G1RefineBufferedCardsBatch::MaxBatchSize);
+  uint count = 0;
+  do {
+    BufferNode* node = get_completed_buffer();
+    if (node == nullptr) break;
+    nodes[count++] = node;
+  } while (count < max_count && Atomic::load(&_num_cards) > stop_at);
+
+  if (count == 0) return false; // Didn't get a buffer to process.
+
+  refine_buffers(nodes, count, worker_id, stats);
+  for (uint i = 0; i < count; ++i) {
+    // After a yield request, some buffers may still have been finished.
+    handle_refined_buffer(nodes[i], nodes[i]->index() == buffer_size());
+  }
   return true;
 }
 
@@ -205,6 +205,14 @@ class G1DirtyCardQueueSet: public PtrQueueSet {
                      uint worker_id,
                      G1ConcurrentRefineStats* stats);
 
+  // Refine the cards in "count" buffers as one batch, in one sorted order.
+  // Like refine_buffer, stops processing if there is a pending yield
+  // request, returning false, and updates the index of every node.
+  bool refine_buffers(BufferNode* const* nodes,
+                      uint count,
+                      uint worker_id,
+                      G1ConcurrentRefineStats* stats);
+
   // Deal with buffer after a call to refine_buffer.  If fully processed,
   // deallocate the buffer.  Otherwise, record it as paused.
   void handle_refined_buffer(BufferNode* node, bool fully_processed);
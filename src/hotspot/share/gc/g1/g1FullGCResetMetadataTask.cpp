@@ -91,7 +91,9 @@ void G1FullGCResetMetadataTask::G1ResetMetadataClosure::reset_skip_compacting(He
     oop obj = cast_to_oop(hr->humongous_start_region()->bottom());
     assert(_collector->mark_bitmap()->is_marked(obj), "must be live");
   } else {
-    assert(_collector->live_words(region_index) > _collector->scope()->region_compaction_threshold(),
+    // Regions with pinned objects are not compacted whatever their liveness.
+    assert(hr->has_pinned_objects() ||
+           _collector->live_words(region_index) > _collector->scope()->region_compaction_threshold(),
            "should be quite full");
   }
 
@@ -99,7 +101,12 @@ void G1FullGCResetMetadataTask::G1ResetMetadataClosure::reset_skip_compacting(He
          "region %u compaction_top " PTR_FORMAT " must not be different from bottom " PTR_FORMAT,
          hr->hrm_index(), p2i(_collector->compaction_top(hr)), p2i(hr->bottom()));
 #endif
-  hr->reset_skip_compacting_after_full_gc();
+  // A region with pinned objects can be mostly garbage, so keep track of it.
+  size_t garbage_bytes = 0;
+  if (!hr->is_humongous()) {
+    garbage_bytes = hr->used() - _collector->live_words(hr->hrm_index()) * HeapWordSize;
+  }
+  hr->reset_skip_compacting_after_full_gc(garbage_bytes);
 }
 
 void G1FullGCResetMetadataTask::work(uint worker_id) {
@@ -295,11 +295,45 @@ void G1ParScanThreadState::dispatch_task(ScannerTask task) {
   }
 }
 
+template <class T>
+inline oop G1ParScanThreadState::referent(T* p) {
+  return RawAccess<IS_NOT_NULL>::oop_load(p);
+}
+
+inline void G1ParScanThreadState::prefetch_header(ScannerTask task) {
+  // Partial array tasks refer to an array whose header has been accessed
+  // when the task was created, there is nothing to gain for them.
+  if (task.is_narrow_oop_ptr()) {
+    Prefetch::write(referent(task.to_narrow_oop_ptr())->mark_addr(), 0);
+  } else if (task.is_oop_ptr()) {
+    Prefetch::write(referent(task.to_oop_ptr())->mark_addr(), 0);
+  }
+}
+
+inline void G1ParScanThreadState::prefetch_klass(ScannerTask task) {
+  // The object may already have been forwarded by another thread, but its
+  // klass stays valid in either copy. The header was prefetched earlier in
+  // the batch, so this load is not expected to miss.
+  if (task.is_narrow_oop_ptr()) {
+    Prefetch::read(referent(task.to_narrow_oop_ptr())->klass_raw(), 0);
+  } else if (task.is_oop_ptr()) {
+    Prefetch::read(referent(task.to_oop_ptr())->klass_raw(), 0);
+  }
+}
+
 // Process tasks until overflow queue is empty and local queue
 // contains no more than threshold entries.  NOINLINE to prevent
 // inlining into steal_and_trim_queue.
+//
+// Local tasks are taken in batches of G1EvacuationPrefetchBatchSize.
+// Prefetching the headers of the whole batch first, and the klass of the
+// next task while processing the current one, overlaps the cache misses on
+// the source objects instead of taking them one after the other.
 ATTRIBUTE_FLATTEN NOINLINE
 void G1ParScanThreadState::trim_queue_to_threshold(uint threshold) {
+  const uint batch_size = G1EvacuationPrefetchBatchSize;
+  assert(batch_size <= MaxPrefetchBatchSize, "invariant");
+  ScannerTask batch[MaxPrefetchBatchSize];
   ScannerTask task;
   do {
     while (_task_queue->pop_overflow(task)) {
@@ -307,9 +341,26 @@ void G1ParScanThreadState::trim_queue_to_threshold(uint threshold) {
         dispatch_task(task);
       }
     }
-    while (_task_queue->pop_local(task, threshold)) {
-      dispatch_task(task);
+    if (batch_size == 1) {
+      while (_task_queue->pop_local(task, threshold)) {
+        dispatch_task(task);
+      }
+      continue;
     }
+    uint n;
+    do {
+      n = 0;
+      while (n < batch_size && _task_queue->pop_local(batch[n], threshold)) {
+        prefetch_header(batch[n]);
+        n++;
+      }
+      for (uint i = 0; i < n; i++) {
+        if (i + 1 < n) {
+          prefetch_klass(batch[i + 1]);
+        }
+        dispatch_task(batch[i]);
+      }
+    } while (n > 0);
   } while (!_task_queue->overflow_empty());
 }
 
@@ -459,6 +510,13 @@ oop G1ParScanThreadState::do_copy_to_survivor_space(G1HeapRegionAttr const regio
   uint age = 0;
   G1HeapRegionAttr dest_attr = next_region_attr(region_attr, old_mark, age);
   HeapRegion* const from_region = _g1h->heap_region_containing(old);
+
+  // Objects in regions with pinned objects must stay in place, so fail their
+  // evacuation. This retains the region as an old region.
+  if (from_region->has_pinned_objects()) {
+    return handle_evacuation_failure_par(old, old_mark, word_sz);
+  }
+
   uint node_index = from_region->node_index();
 
   HeapWord* obj_ptr = _plab_allocator->plab_allocate(dest_attr, word_sz, node_index);
@@ -182,6 +182,16 @@ private:
 
   void dispatch_task(ScannerTask task);
 
+  // Maximum value of G1EvacuationPrefetchBatchSize.
+  static const uint MaxPrefetchBatchSize = 64;
+
+  // Software pipelining of task processing: the header of the object
+  // referenced by a task is prefetched when the task is taken from the
+  // queue, and its klass just before the task is processed.
+  template <class T> static oop referent(T* p);
+  static void prefetch_header(ScannerTask task);
+  static void prefetch_klass(ScannerTask task);
+
   // Tries to allocate word_sz in the PLAB of the next "generation" after trying to
   // allocate into dest. Previous_plab_refill_failed indicates whether previous
   // PLAB refill for the original (source) object failed.
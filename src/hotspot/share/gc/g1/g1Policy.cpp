@@ -1441,6 +1441,11 @@ double G1Policy::select_candidates_from_marking(G1CollectionCandidateList* marki
       break;
     }
     HeapRegion* hr = *iter;
+    if (hr->has_pinned_objects()) {
+      // Pinned since the candidates were chosen. Evacuation would fail, keep
+      // it as a candidate for a later mixed collection.
+      continue;
+    }
     double predicted_time_ms = predict_region_total_time_ms(hr, false);
     time_remaining_ms = MAX2(time_remaining_ms - predicted_time_ms, 0.0);
     // Add regions to old set until we reach the minimum amount
@@ -572,6 +572,18 @@ class G1ScanHRForRegionClosure : public HeapRegionClosure {
         i_card++;
       }
 
+      // Skip blocks of words without dirty cards at once, as for
+      // CardTable::find_first_non_clean_card().
+      const size_t block_size = G1CardTable::clean_card_block_size;
+      while (pointer_delta(_end_card, i_card, sizeof(CardValue)) >= block_size) {
+        const Word* const words = reinterpret_cast<Word*>(i_card);
+        const Word block_value = words[0] & words[1] & words[2] & words[3];
+        if ((~block_value & ExpandedToScanMask) != 0) {
+          break;
+        }
+        i_card += block_size;
+      }
+
       for (/* empty */; i_card < _end_card; i_card += sizeof(Word)) {
         Word word_value = *reinterpret_cast<Word*>(i_card);
         bool has_dirty_cards_in_word = (~word_value & ExpandedToScanMask) != 0;
@@ -300,6 +300,12 @@ class G1PrepareEvacuationTask : public WorkerTask {
     bool humongous_region_is_candidate(HeapRegion* region) const {
       assert(region->is_starts_humongous(), "Must start a humongous object");
 
+      // A pinned humongous object must not be freed while native code
+      // accesses it.
+      if (region->has_pinned_objects()) {
+        return false;
+      }
+
       oop obj = cast_to_oop(region->bottom());
 
       // Dead objects cannot be eager reclaim candidates. Due to class
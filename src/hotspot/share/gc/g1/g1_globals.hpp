@@ -144,6 +144,13 @@
                "percent.")                                                  \
                range(0.001, 100.0)                                          \
                                                                             \
+  product(uint, G1EvacuationPrefetchBatchSize, 8, EXPERIMENTAL,             \
+               "The number of task queue entries popped at once during "    \
+               "evacuation, prefetching the headers and klasses of the "    \
+               "referenced objects before copying them. 1 disables "        \
+               "batching.")                                                 \
+               range(1, 64)                                                 \
+                                                                            \
   product(size_t, G1SATBBufferSize, 1*K,                                    \
           "Number of entries in an SATB log buffer.")                       \
           range(1, max_uintx)                                               \
@@ -178,6 +185,13 @@
           "Control whether concurrent refinement is performed. "            \
           "Disabling effectively ignores G1RSetUpdatingPauseTimePercent")   \
                                                                             \
+  product(uint, G1ConcRefinementBatchSize, 4, EXPERIMENTAL,                 \
+          "Number of completed buffers a concurrent refinement thread "     \
+          "takes at once. The cards of all buffers in a batch are cleaned " \
+          "first, dropping duplicates, and then refined in one sorted "     \
+          "order. 1 refines buffer by buffer.")                             \
+          range(1, 16)                                                      \
+                                                                            \
   develop(uint, G1RemSetArrayOfCardsEntriesBase, 8,                         \
           "Maximum number of entries per region in the Array of Cards "     \
           "card set container per MB of a heap region.")                    \
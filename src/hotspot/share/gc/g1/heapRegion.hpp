@@ -178,7 +178,7 @@ public:
   // Update heap region that has been compacted to be consistent after Full GC.
   void reset_compacted_after_full_gc(HeapWord* new_top);
   // Update skip-compacting heap region to be consistent after Full GC.
-  void reset_skip_compacting_after_full_gc();
+  void reset_skip_compacting_after_full_gc(size_t garbage_bytes);
 
   // All allocated blocks are occupied by objects in a HeapRegion.
   bool block_is_obj(const HeapWord* p, HeapWord* pb) const;
@@ -260,6 +260,9 @@ private:
   // NUMA node.
   uint _node_index;
 
+  // Number of objects in this region pinned through JNI critical sections.
+  volatile size_t _pinned_object_count;
+
   void report_region_type_change(G1HeapRegionTraceType::Type to);
 
   template <class Closure, bool in_gc_pause>
@@ -565,6 +568,13 @@ public:
   uint node_index() const { return _node_index; }
   void set_node_index(uint node_index) { _node_index = node_index; }
 
+  // Objects in a region with pinned objects must not move: evacuating from
+  // such a region fails, and Full GC does not compact it.
+  inline size_t pinned_count() const;
+  inline bool has_pinned_objects() const;
+  inline void increment_pinned_object_count();
+  inline void decrement_pinned_object_count();
+
   // Verify that the entries on the code root list for this
   // region are live and include at least one pointer into this region.
   // Returns whether there has been a failure.
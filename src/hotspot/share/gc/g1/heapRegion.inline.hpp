@@ -196,10 +196,27 @@ inline void HeapRegion::reset_compacted_after_full_gc(HeapWord* new_top) {
   reset_after_full_gc_common();
 }
 
-inline void HeapRegion::reset_skip_compacting_after_full_gc() {
+inline size_t HeapRegion::pinned_count() const {
+  return Atomic::load(&_pinned_object_count);
+}
+
+inline bool HeapRegion::has_pinned_objects() const {
+  return pinned_count() > 0;
+}
+
+inline void HeapRegion::increment_pinned_object_count() {
+  Atomic::add(&_pinned_object_count, (size_t)1, memory_order_relaxed);
+}
+
+inline void HeapRegion::decrement_pinned_object_count() {
+  assert(has_pinned_objects(), "unbalanced unpin in region %u", hrm_index());
+  Atomic::sub(&_pinned_object_count, (size_t)1, memory_order_relaxed);
+}
+
+inline void HeapRegion::reset_skip_compacting_after_full_gc(size_t garbage_bytes) {
   assert(!is_free(), "must be");
 
-  _garbage_bytes = 0;
+  _garbage_bytes = garbage_bytes;
 
   reset_top_at_mark_start();
 
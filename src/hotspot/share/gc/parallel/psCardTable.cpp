@@ -187,12 +187,8 @@ public:
 
   const CardValue* find_first_dirty_card(const CardValue* const start,
                                          const CardValue* const end) {
-    for (const CardValue* i = start; i < end; ++i) {
-      if (is_dirty(i)) {
-        return i;
-      }
-    }
-    return end;
+    assert(start >= _table && end <= &_table[PSCardTable::num_cards_in_stripe], "out of bounds");
+    return PSCardTable::find_first_non_clean_card(start, end);
   }
 
   const CardValue* find_first_clean_card(const CardValue* const start,
@@ -2205,19 +2205,77 @@ public:
   }
 };
 
+// Min-heap of the worker ids keyed by the load assigned to them, so that the
+// least loaded worker is found in constant time and updated in log(workers).
+class LeastLoadedWorker : public StackObj {
+  const uint _num_workers;
+  uint* const _heap;
+  size_t* const _load;
+
+  bool less(uint i, uint j) const {
+    return _load[_heap[i]] < _load[_heap[j]];
+  }
+
+  void sift_down(uint i) {
+    while (true) {
+      const uint left = 2 * i + 1;
+      const uint right = left + 1;
+      uint least = i;
+      if (left < _num_workers && less(left, least)) {
+        least = left;
+      }
+      if (right < _num_workers && less(right, least)) {
+        least = right;
+      }
+      if (least == i) {
+        return;
+      }
+      swap(_heap[i], _heap[least]);
+      i = least;
+    }
+  }
+
+public:
+  LeastLoadedWorker(uint num_workers) :
+    _num_workers(num_workers),
+    _heap(NEW_C_HEAP_ARRAY(uint, num_workers, mtGC)),
+    _load(NEW_C_HEAP_ARRAY(size_t, num_workers, mtGC)) {
+    for (uint i = 0; i < num_workers; ++i) {
+      _heap[i] = i;
+      _load[i] = 0;
+    }
+  }
+
+  ~LeastLoadedWorker() {
+    FREE_C_HEAP_ARRAY(uint, _heap);
+    FREE_C_HEAP_ARRAY(size_t, _load);
+  }
+
+  uint worker_id() const { return _heap[0]; }
+
+  // Adds load to the least loaded worker.
+  void add_load(size_t load) {
+    _load[_heap[0]] += load;
+    sift_down(0);
+  }
+};
+
 void PSParallelCompact::prepare_region_draining_tasks(uint parallel_gc_threads)
 {
   GCTraceTime(Trace, gc, phases) tm("Drain Task Setup", &_gc_timer);
 
-  // Find the threads that are active
-  uint worker_id = 0;
-
   // Find all regions that are available (can be filled immediately) and
   // distribute them to the thread stacks.  The iteration is done in reverse
   // order (high to low) so the regions will be removed in ascending order.
+  //
+  // Each region goes to the thread with the least live data assigned so far,
+  // so that the initial stacks are balanced by the amount of copying rather
+  // than by the number of regions.
 
   const ParallelCompactData& sd = PSParallelCompact::summary_data();
 
+  LeastLoadedWorker workers(parallel_gc_threads);
+
   // id + 1 is used to test termination so unsigned  can
   // be used with an old_space_id == 0.
   FillableRegionLogger region_logger;
@@ -2231,15 +2289,14 @@ void PSParallelCompact::prepare_region_draining_tasks(uint parallel_gc_threads)
 
     for (size_t cur = end_region - 1; cur + 1 > beg_region; --cur) {
       if (sd.region(cur)->claim_unsafe()) {
-        ParCompactionManager* cm = ParCompactionManager::gc_thread_compaction_manager(worker_id);
+        ParCompactionManager* cm = ParCompactionManager::gc_thread_compaction_manager(workers.worker_id());
         bool result = sd.region(cur)->mark_normal();
         assert(result, "Must succeed at this point.");
         cm->region_stack()->push(cur);
         region_logger.handle(cur);
-        // Assign regions to tasks in round-robin fashion.
-        if (++worker_id == parallel_gc_threads) {
-          worker_id = 0;
-        }
+        // Count every region as at least one word, so that regions without
+        // live data are still spread out.
+        workers.add_load(sd.region(cur)->data_size() + 1);
       }
     }
     region_logger.print_line();
@@ -2313,39 +2370,34 @@ void PSParallelCompact::enqueue_dense_prefix_tasks(TaskQueue& task_queue,
     // Is there dense prefix work?
     size_t total_dense_prefix_regions =
       region_index_end_dense_prefix - region_index_start;
-    // How many regions of the dense prefix should be given to
-    // each thread?
     if (total_dense_prefix_regions > 0) {
-      uint tasks_for_dense_prefix = 1;
-      if (total_dense_prefix_regions <=
-          (parallel_gc_threads * PAR_OLD_DENSE_PREFIX_OVER_PARTITIONING)) {
-        // Don't over partition.  This assumes that
-        // PAR_OLD_DENSE_PREFIX_OVER_PARTITIONING is a small integer value
-        // so there are not many regions to process.
-        tasks_for_dense_prefix = parallel_gc_threads;
-      } else {
-        // Over partition
-        tasks_for_dense_prefix = parallel_gc_threads *
-          PAR_OLD_DENSE_PREFIX_OVER_PARTITIONING;
+      // Split the dense prefix into tasks of about the same amount of live
+      // data, since that is what updating costs. Splitting by region count
+      // leaves threads idle when the live data is skewed. Every region is
+      // also given a weight of one word, so that a dense prefix with hardly
+      // any live data is still split.
+      const uint tasks_for_dense_prefix = parallel_gc_threads *
+        PAR_OLD_DENSE_PREFIX_OVER_PARTITIONING;
+      size_t total_weight = 0;
+      for (size_t cur = region_index_start; cur < region_index_end_dense_prefix; ++cur) {
+        total_weight += sd.region(cur)->data_size() + 1;
       }
-      size_t regions_per_thread = total_dense_prefix_regions /
-        tasks_for_dense_prefix;
-      // Give each thread at least 1 region.
-      if (regions_per_thread == 0) {
-        regions_per_thread = 1;
-      }
-
-      for (uint k = 0; k < tasks_for_dense_prefix; k++) {
-        if (region_index_start >= region_index_end_dense_prefix) {
-          break;
+      // Rounded up, so that at most tasks_for_dense_prefix tasks are pushed.
+      const size_t weight_per_task =
+        (total_weight + tasks_for_dense_prefix - 1) / tasks_for_dense_prefix;
+
+      size_t weight = 0;
+      for (size_t cur = region_index_start; cur < region_index_end_dense_prefix; ++cur) {
+        weight += sd.region(cur)->data_size() + 1;
+        if (weight >= weight_per_task) {
+          // region_index_end is not processed
+          const size_t region_index_end = cur + 1;
+          task_queue.push(UpdateDensePrefixTask(SpaceId(space_id),
+                                                region_index_start,
+                                                region_index_end));
+          region_index_start = region_index_end;
+          weight = 0;
         }
-        // region_index_end is not processed
-        size_t region_index_end = MIN2(region_index_start + regions_per_thread,
-                                       region_index_end_dense_prefix);
-        task_queue.push(UpdateDensePrefixTask(SpaceId(space_id),
-                                              region_index_start,
-                                              region_index_end));
-        region_index_start = region_index_end;
       }
     }
     // This gets any part of the dense prefix that did not
@@ -48,10 +48,6 @@ ClearNoncleanCardWrapper::ClearNoncleanCardWrapper(
     _dirty_card_closure(dirty_card_closure), _ct(ct) {
 }
 
-bool ClearNoncleanCardWrapper::is_word_aligned(CardTable::CardValue* entry) {
-  return (((intptr_t)entry) & (BytesPerWord-1)) == 0;
-}
-
 // The regions are visited in *decreasing* address order.
 // This order aids with imprecise card marking, where a dirty
 // card may cause scanning, and summarization marking, of objects
@@ -78,15 +74,9 @@ void ClearNoncleanCardWrapper::do_MemRegion(MemRegion mr) {
         _dirty_card_closure->do_MemRegion(mrd);
       }
 
-      // fast forward through potential continuous whole-word range of clean cards beginning at a word-boundary
-      if (is_word_aligned(cur_entry)) {
-        CardValue* cur_row = cur_entry - BytesPerWord;
-        while (cur_row >= limit && *((intptr_t*)cur_row) ==  CardTableRS::clean_card_row_val()) {
-          cur_row -= BytesPerWord;
-        }
-        cur_entry = cur_row + BytesPerWord;
-        cur_hw = _ct->addr_for(cur_entry);
-      }
+      // fast forward through the run of clean cards before this one
+      cur_entry -= CardTable::count_clean_cards_before(limit, cur_entry);
+      cur_hw = _ct->addr_for(cur_entry);
 
       // Reset the dirty window, while continuing to look
       // for the next dirty card that will start a
@@ -46,6 +46,49 @@ Node* CardTableBarrierSetC2::byte_map_base_node(GraphKit* kit) const {
    }
 }
 
+/*
+ * The post barrier of a store can be removed if the store is into an object
+ * allocated with no safepoint in between, found by looking for the
+ * InitializeNode of that allocation as the store's control. Such an object
+ * is in the young generation, or the slow-path allocation already took the
+ * compensating steps in CardTableBarrierSet::on_slowpath_allocation_exit.
+ *
+ * This catches stores just_allocated_object() misses, such as stores into
+ * an object allocated before the most recent allocation.
+ *
+ * Returns true if the post barrier can be removed
+ */
+bool CardTableBarrierSetC2::can_remove_post_barrier(GraphKit* kit,
+                                                    PhaseValues* phase, Node* store,
+                                                    Node* adr) const {
+  intptr_t      offset = 0;
+  Node*         base   = AddPNode::Ideal_base_and_offset(adr, phase, offset);
+  AllocateNode* alloc  = AllocateNode::Ideal_allocation(base, phase);
+
+  if (offset == Type::OffsetBot) {
+    return false; // cannot unalias unless there are precise offsets
+  }
+
+  if (alloc == nullptr) {
+     return false; // No allocation found
+  }
+
+  // Start search from Store node
+  Node* mem = store->in(MemNode::Control);
+  if (mem->is_Proj() && mem->in(0)->is_Initialize()) {
+
+    InitializeNode* st_init = mem->in(0)->as_Initialize();
+    AllocateNode*  st_alloc = st_init->allocation();
+
+    // Make sure we are looking at the same allocation
+    if (alloc == st_alloc) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
 // vanilla post barrier
 // Insert a write-barrier store.  This is to let generational GC work; we have
 // to flag all oop-stores before the next GC point.
@@ -76,6 +119,11 @@ void CardTableBarrierSetC2::post_barrier(GraphKit* kit,
     return;
   }
 
+  if (use_ReduceInitialCardMarks()
+      && can_remove_post_barrier(kit, &kit->gvn(), oop_store, adr)) {
+    return;
+  }
+
   if (!use_precise) {
     // All card marks for a (non-array) instance are in one place:
     adr = obj;
@@ -41,6 +41,10 @@ protected:
 
   Node* byte_map_base_node(GraphKit* kit) const;
 
+  bool can_remove_post_barrier(GraphKit* kit,
+                               PhaseValues* phase, Node* store,
+                               Node* adr) const;
+
 public:
   virtual void clone(GraphKit* kit, Node* src, Node* dst, Node* size, bool is_array) const;
   virtual bool is_gc_barrier_node(Node* node) const;
@@ -198,6 +198,69 @@ public:
   static constexpr CardValue dirty_card_val()          { return dirty_card; }
   static intptr_t clean_card_row_val()   { return clean_card_row; }
 
+  // Searching for runs of clean cards. Word aligned blocks of
+  // clean_card_block_size cards are tested at once, without data dependent
+  // branches inside a block, which compilers turn into vector loads and
+  // compares on platforms that have them. The searches never read outside
+  // of [start, end).
+  static const size_t clean_card_block_size = 4 * sizeof(intptr_t);
+
+  static bool is_clean_card_block(const CardValue* block) {
+    assert(is_aligned(block, sizeof(intptr_t)), "precondition");
+    const intptr_t* const words = reinterpret_cast<const intptr_t*>(block);
+    return (words[0] & words[1] & words[2] & words[3]) == clean_card_row;
+  }
+
+  // Returns the first card in [start, end) that is not clean, or end if
+  // all cards are clean.
+  static const CardValue* find_first_non_clean_card(const CardValue* start,
+                                                    const CardValue* end) {
+    const CardValue* cur = start;
+    for (; cur < end && !is_aligned(cur, sizeof(intptr_t)); ++cur) {
+      if (*cur != clean_card) {
+        return cur;
+      }
+    }
+    while (pointer_delta(end, cur, sizeof(CardValue)) >= clean_card_block_size &&
+           is_clean_card_block(cur)) {
+      cur += clean_card_block_size;
+    }
+    while (pointer_delta(end, cur, sizeof(CardValue)) >= sizeof(intptr_t) &&
+           *reinterpret_cast<const intptr_t*>(cur) == clean_card_row) {
+      cur += sizeof(intptr_t);
+    }
+    for (; cur < end; ++cur) {
+      if (*cur != clean_card) {
+        return cur;
+      }
+    }
+    return end;
+  }
+
+  // Returns the number of consecutive clean cards immediately before end,
+  // not counting any card before start.
+  static size_t count_clean_cards_before(const CardValue* start,
+                                         const CardValue* end) {
+    const CardValue* cur = end;
+    for (; cur > start && !is_aligned(cur, sizeof(intptr_t)); --cur) {
+      if (cur[-1] != clean_card) {
+        return pointer_delta(end, cur, sizeof(CardValue));
+      }
+    }
+    while (pointer_delta(cur, start, sizeof(CardValue)) >= clean_card_block_size &&
+           is_clean_card_block(cur - clean_card_block_size)) {
+      cur -= clean_card_block_size;
+    }
+    while (pointer_delta(cur, start, sizeof(CardValue)) >= sizeof(intptr_t) &&
+           *(reinterpret_cast<const intptr_t*>(cur) - 1) == clean_card_row) {
+      cur -= sizeof(intptr_t);
+    }
+    while (cur > start && cur[-1] == clean_card) {
+      --cur;
+    }
+    return pointer_delta(end, cur, sizeof(CardValue));
+  }
+
   // Initialize card size
   static void initialize_card_size();
 
@@ -112,11 +112,16 @@ void ClassUnloadingContext::purge_nmethods() {
 
   size_t freed_memory = 0;
 
-  for (uint i = 0; i < _num_nmethod_unlink_workers; ++i) {
-    NMethodSet* set = _unlinked_nmethods[i];
-    for (nmethod* nm : *set) {
-      freed_memory += nm->size();
-      nm->purge(false /* free_code_cache_data */, _unregister_nmethods_during_purge);
+  {
+    // Unless the lock should be taken per nmethod, take it once for all of
+    // them. nmethod::purge() then does not take it again.
+    MutexLocker ml(_lock_codeblob_free_separately ? nullptr : CodeCache_lock, Mutex::_no_safepoint_check_flag);
+    for (uint i = 0; i < _num_nmethod_unlink_workers; ++i) {
+      NMethodSet* set = _unlinked_nmethods[i];
+      for (nmethod* nm : *set) {
+        freed_memory += nm->size();
+        nm->purge(false /* free_code_cache_data */, _unregister_nmethods_during_purge);
+      }
     }
   }
 
@@ -53,9 +53,9 @@ public:
   // unregister_nmethods_during_purge determines whether unloaded nmethods should
   //     be unregistered from the garbage collector during purge. If not, ,the caller
   //     is responsible to do that later.
-  // lock_codeblob_free_separately determines whether freeing the code blobs takes
-  //     the CodeCache_lock during the whole operation (=false) or per code blob
-  //     free operation (=true).
+  // lock_codeblob_free_separately determines whether purging the nmethods and
+  //     freeing the code blobs take the CodeCache_lock during the whole operation
+  //     (=false) or per nmethod purge and code blob free operation (=true).
   ClassUnloadingContext(uint num_nmethod_unlink_workers,
                         bool unregister_nmethods_during_purge,
                         bool lock_codeblob_free_separately);
@@ -45,6 +45,8 @@ void GCTraceTimeLoggerImpl::log_start(Ticks start) {
   if (_log_heap_usage) {
     _heap_usage_before = Universe::heap()->used();
   }
+
+  _hw_counters.start();
 }
 
 void GCTraceTimeLoggerImpl::log_end(Ticks end) {
@@ -66,7 +68,10 @@ void GCTraceTimeLoggerImpl::log_end(Ticks end) {
     out.print(" " SIZE_FORMAT "M->" SIZE_FORMAT "M("  SIZE_FORMAT "M)", used_before_m, used_m, capacity_m);
   }
 
-  out.print_cr(" %.3fms", duration_in_ms);
+  out.print(" %.3fms", duration_in_ms);
+  _hw_counters.print_on(&out);
+  _hw_counters.stop();
+  out.cr();
 }
 
 GCTraceCPUTime::GCTraceCPUTime(GCTracer* tracer) :
@@ -30,6 +30,7 @@
 #include "logging/logHandle.hpp"
 #include "logging/logStream.hpp"
 #include "memory/allocation.hpp"
+#include "utilities/hardwareCounters.hpp"
 #include "utilities/ticks.hpp"
 
 class GCTracer;
@@ -93,6 +94,8 @@ class GCTraceTimeLoggerImpl : public TimespanCallback {
   size_t _heap_usage_before;
   Ticks  _start;
 
+  HardwareCounters _hw_counters;
+
   void log_start(Ticks start);
   void log_end(Ticks end);
 
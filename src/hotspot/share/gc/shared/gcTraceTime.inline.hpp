@@ -92,7 +92,8 @@ inline GCTraceTimeLoggerImpl::GCTraceTimeLoggerImpl(
         _out_start(out_start),
         _out_end(out_end),
         _heap_usage_before(SIZE_MAX),
-        _start() {}
+        _start(),
+        _hw_counters() {}
 
 inline void GCTraceTimeLoggerImpl::at_start(Ticks start) {
   if (_enabled) {
@@ -40,6 +40,7 @@
 #include "runtime/atomic.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/safepointMechanism.inline.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalCounter.hpp"
 #include "utilities/globalDefinitions.hpp"
@@ -103,7 +104,11 @@ StringDedup::StorageUse* StringDedup::Processor::storage_for_requests() {
 
 void StringDedup::Processor::yield() const {
   assert(Thread::current() == _thread, "precondition");
-  ThreadBlockInVM tbivm(_thread);
+  // This is called for every request, so only pay for the thread state
+  // transitions when there is a safepoint or handshake to block for.
+  if (SafepointMechanism::should_process(_thread)) {
+    ThreadBlockInVM tbivm(_thread);
+  }
 }
 
 void StringDedup::Processor::cleanup_table(bool grow_only, bool force) const {
@@ -32,6 +32,7 @@
 #include "runtime/java.hpp"
 #include "runtime/os.hpp"
 #include "runtime/safepoint.hpp"
+#include "utilities/hardwareCounters.hpp"
 
 WorkerTaskDispatcher::WorkerTaskDispatcher() :
     _task(nullptr),
@@ -177,6 +178,7 @@ void WorkerThreads::clear_indirect_states() {
 }
 
 void WorkerThreads::run_task(WorkerTask* task) {
+  HardwareCounters::note_worker_task();
   set_indirect_states();
   _dispatcher.coordinator_distribute_task(task, _active_workers);
   clear_indirect_states();
@@ -31,12 +31,14 @@
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
 #include "runtime/orderAccess.hpp"
+#include "runtime/os.hpp"
 
 ShenandoahFreeSet::ShenandoahFreeSet(ShenandoahHeap* heap, size_t max_regions) :
   _heap(heap),
   _mutator_free_bitmap(max_regions, mtGC),
   _collector_free_bitmap(max_regions, mtGC),
-  _max(max_regions)
+  _max(max_regions),
+  _numa_local(UseNUMA && ShenandoahNUMALocalAllocation && os::numa_get_groups_num() > 1)
 {
   clear_internal();
 }
@@ -61,6 +63,21 @@ bool ShenandoahFreeSet::is_collector_free(size_t idx) const {
   return _collector_free_bitmap.at(idx);
 }
 
+// Whether try_allocate_in would succeed for this request, without side effects.
+bool ShenandoahFreeSet::can_allocate_in(ShenandoahHeapRegion* r, ShenandoahAllocRequest& req) const {
+  size_t free;
+  if (r->is_trash()) {
+    if (_heap->is_concurrent_weak_root_in_progress()) {
+      return false;
+    }
+    free = ShenandoahHeapRegion::region_size_bytes();
+  } else {
+    free = r->free();
+  }
+  free = align_down(free >> LogHeapWordSize, MinObjAlignment);
+  return free >= (req.is_lab_alloc() ? req.min_size() : req.size());
+}
+
 HeapWord* ShenandoahFreeSet::allocate_single(ShenandoahAllocRequest& req, bool& in_new_region) {
   // Scan the bitmap looking for a first fit.
   //
@@ -78,15 +95,38 @@ HeapWord* ShenandoahFreeSet::allocate_single(ShenandoahAllocRequest& req, bool&
     case ShenandoahAllocRequest::_alloc_tlab:
     case ShenandoahAllocRequest::_alloc_shared: {
 
-      // Try to allocate in the mutator view
+      // Try to allocate in the mutator view. With _numa_local, regions on
+      // other nodes are skipped, and the first of them that fits is only
+      // used if no region on the node of the allocating thread does. Regions
+      // whose node is not known yet count as local: their memory has not been
+      // touched, and will be placed on the node of the thread that touches it
+      // first.
+      const int numa_node = _numa_local ? os::numa_get_group_id() : -1;
+      ShenandoahHeapRegion* remote = nullptr;
       for (size_t idx = _mutator_leftmost; idx <= _mutator_rightmost; idx++) {
         if (is_mutator_free(idx)) {
-          HeapWord* result = try_allocate_in(_heap->get_region(idx), req, in_new_region);
+          ShenandoahHeapRegion* r = _heap->get_region(idx);
+          if (_numa_local) {
+            const int region_node = r->numa_node();
+            if (region_node >= 0 && region_node != numa_node) {
+              if (remote == nullptr && can_allocate_in(r, req)) {
+                remote = r;
+              }
+              continue;
+            }
+          }
+          HeapWord* result = try_allocate_in(r, req, in_new_region);
           if (result != nullptr) {
             return result;
           }
         }
       }
+      if (remote != nullptr && is_mutator_free(remote->index())) {
+        HeapWord* result = try_allocate_in(remote, req, in_new_region);
+        if (result != nullptr) {
+          return result;
+        }
+      }
 
       // There is no recovery. Mutator does not touch collector view at all.
       break;
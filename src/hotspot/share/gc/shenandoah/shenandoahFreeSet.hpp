@@ -43,6 +43,10 @@ private:
   size_t _capacity;
   size_t _used;
 
+  // Whether mutator allocations prefer regions on the node of the
+  // allocating thread, see ShenandoahNUMALocalAllocation
+  const bool _numa_local;
+
   void assert_bounds() const NOT_DEBUG_RETURN;
 
   bool is_mutator_free(size_t idx) const;
@@ -50,6 +54,7 @@ private:
 
   HeapWord* try_allocate_in(ShenandoahHeapRegion* region, ShenandoahAllocRequest& req, bool& in_new_region);
   HeapWord* allocate_single(ShenandoahAllocRequest& req, bool& in_new_region);
+  bool can_allocate_in(ShenandoahHeapRegion* region, ShenandoahAllocRequest& req) const;
   HeapWord* allocate_contiguous(ShenandoahAllocRequest& req);
 
   void flip_to_gc(ShenandoahHeapRegion* r);
@@ -24,6 +24,7 @@
  */
 
 #include "precompiled.hpp"
+#include "cds/archiveHeapWriter.hpp"
 #include "memory/allocation.hpp"
 #include "memory/universe.hpp"
 
@@ -895,6 +896,80 @@ HeapWord* ShenandoahHeap::mem_allocate(size_t size,
   return allocate_memory(req);
 }
 
+HeapWord* ShenandoahHeap::allocate_loaded_archive_space(size_t size) {
+#if INCLUDE_CDS_JAVA_HEAP
+  // CDS wants a contiguous memory range to load a bunch of objects into.
+  // This bypasses the normal allocation paths, and requires a bit of
+  // massaging to keep the GC invariants intact.
+  ShenandoahAllocRequest req = ShenandoahAllocRequest::for_shared(size);
+
+  // Easy case: a single regular region, no further adjustments needed.
+  if (size <= ShenandoahHeapRegion::humongous_threshold_words()) {
+    return allocate_memory(req);
+  }
+
+  // Hard case: the request would be allocated as humongous. The archived
+  // objects have to look like a regular allocation to the rest of the GC.
+  // CDS guarantees that no object straddles a MIN_GC_REGION_ALIGNMENT
+  // boundary, which is only enough when regions are at least that large.
+  if (ShenandoahHeapRegion::region_size_bytes() < ArchiveHeapWriter::MIN_GC_REGION_ALIGNMENT) {
+    return nullptr;
+  }
+
+  HeapWord* mem = allocate_memory(req);
+  if (mem == nullptr) {
+    return nullptr;
+  }
+  size_t start_idx = heap_region_index_containing(mem);
+  size_t num_regions = ShenandoahHeapRegion::required_regions(size * HeapWordSize);
+
+  // Flip humongous -> regular.
+  {
+    ShenandoahHeapLocker locker(lock());
+    for (size_t c = start_idx; c < start_idx + num_regions; c++) {
+      get_region(c)->make_regular_bypass();
+    }
+  }
+
+  return mem;
+#else
+  assert(false, "Archive heap loader should not be available, should not be here");
+  return nullptr;
+#endif // INCLUDE_CDS_JAVA_HEAP
+}
+
+void ShenandoahHeap::complete_loaded_archive_space(MemRegion archive_space) {
+  // Nothing to do here, except checking that the heap looks fine.
+#ifdef ASSERT
+  HeapWord* start = archive_space.start();
+  HeapWord* end = archive_space.end();
+
+  // No unclaimed space between the objects, and every object is in
+  // a region of the right kind.
+  HeapWord* cur = start;
+  while (cur < end) {
+    oop obj = cast_to_oop(cur);
+    shenandoah_assert_in_correct_region(nullptr, obj);
+    cur += obj->size();
+  }
+
+  assert(cur == end,
+         "Archive space should be fully used: " PTR_FORMAT " " PTR_FORMAT,
+         p2i(cur), p2i(end));
+
+  ShenandoahHeapRegion* begin_reg = heap_region_containing(start);
+  ShenandoahHeapRegion* end_reg = heap_region_containing(end - 1);
+  assert(begin_reg->is_regular(), "Must be");
+  assert(end_reg->is_regular(), "Must be");
+  assert(begin_reg->bottom() == start,
+         "Must be aligned: " PTR_FORMAT " " PTR_FORMAT,
+         p2i(begin_reg->bottom()), p2i(start));
+  assert(end_reg->top() == end,
+         "Must be aligned: " PTR_FORMAT " " PTR_FORMAT,
+         p2i(end_reg->top()), p2i(end));
+#endif
+}
+
 MetaWord* ShenandoahHeap::satisfy_failed_metadata_allocation(ClassLoaderData* loader_data,
                                                              size_t size,
                                                              Metaspace::MetadataType mdtype) {
@@ -549,6 +549,12 @@ public:
   void tlabs_retire(bool resize);
   void gclabs_retire(bool resize);
 
+// ---------- CDS archive support
+
+  bool can_load_archived_objects() const override { return UseCompressedOops; }
+  HeapWord* allocate_loaded_archive_space(size_t size) override;
+  void complete_loaded_archive_space(MemRegion archive_space) override;
+
 // ---------- Marking support
 //
 private:
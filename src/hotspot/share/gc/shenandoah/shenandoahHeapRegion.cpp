@@ -68,7 +68,8 @@ ShenandoahHeapRegion::ShenandoahHeapRegion(HeapWord* start, size_t index, bool c
   _gclab_allocs(0),
   _live_data(0),
   _critical_pins(0),
-  _update_watermark(start) {
+  _update_watermark(start),
+  _numa_node(NUMA_NODE_UNRESOLVED) {
 
   assert(Universe::on_page_boundary(_bottom) && Universe::on_page_boundary(_end),
          "invalid space boundaries");
@@ -102,8 +103,10 @@ void ShenandoahHeapRegion::make_regular_allocation() {
 
 void ShenandoahHeapRegion::make_regular_bypass() {
   shenandoah_assert_heaplocked();
-  assert (ShenandoahHeap::heap()->is_full_gc_in_progress() || ShenandoahHeap::heap()->is_degenerated_gc_in_progress(),
-          "only for full or degen GC");
+  assert (!Universe::is_fully_initialized() ||
+          ShenandoahHeap::heap()->is_full_gc_in_progress() ||
+          ShenandoahHeap::heap()->is_degenerated_gc_in_progress(),
+          "Only for STW GC or when Universe is initializing (CDS)");
 
   switch (_state) {
     case _empty_uncommitted:
@@ -641,6 +644,16 @@ void ShenandoahHeapRegion::do_uncommit() {
     report_java_out_of_memory("Unable to uncommit bitmaps for region");
   }
   heap->decrease_committed(ShenandoahHeapRegion::region_size_bytes());
+  _numa_node = NUMA_NODE_UNRESOLVED;
+}
+
+int ShenandoahHeapRegion::numa_node() {
+  // Free set scans see the same empty regions over and over, so do not look
+  // them up again until they are allocated in.
+  if (_numa_node == NUMA_NODE_UNRESOLVED || (_numa_node < 0 && !is_empty())) {
+    _numa_node = os::numa_get_group_id_for_address(bottom());
+  }
+  return _numa_node;
 }
 
 void ShenandoahHeapRegion::set_state(RegionState to) {
@@ -246,6 +246,11 @@ private:
 
   HeapWord* volatile _update_watermark;
 
+  // NUMA node of the region memory, -1 if not known, or NUMA_NODE_UNRESOLVED
+  // if it was not looked up yet
+  static const int NUMA_NODE_UNRESOLVED = -2;
+  int _numa_node;
+
 public:
   ShenandoahHeapRegion(HeapWord* start, size_t index, bool committed);
 
@@ -388,6 +393,12 @@ public:
   inline void set_update_watermark(HeapWord* w);
   inline void set_update_watermark_at_safepoint(HeapWord* w);
 
+  // NUMA node the region memory is on, or -1 if it is not known, for example
+  // because the memory has not been touched yet. Looked up lazily, and
+  // forgotten when the region is uncommitted. An empty region caches the
+  // unknown result too, its memory is only touched once it is allocated in.
+  int numa_node();
+
 private:
   void do_commit();
   void do_uncommit();
@@ -235,6 +235,11 @@
           "reserve/waste is incorrect, at the risk that application "       \
           "runs out of memory too early.")                                  \
                                                                             \
+  product(bool, ShenandoahNUMALocalAllocation, true, EXPERIMENTAL,          \
+          "With UseNUMA on a multi-node machine, let mutator allocations "  \
+          "prefer free regions whose memory is on the node of the "         \
+          "allocating thread.")                                             \
+                                                                            \
   product(bool, ShenandoahPacing, true, EXPERIMENTAL,                       \
           "Pace application allocations to give GC chance to start "        \
           "and complete before allocation failure is reached.")             \
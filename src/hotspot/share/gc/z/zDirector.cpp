@@ -32,6 +32,9 @@
 #include "gc/z/zLock.inline.hpp"
 #include "gc/z/zStat.hpp"
 #include "logging/log.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/os.hpp"
+#include "utilities/align.hpp"
 
 ZDirector* ZDirector::_director;
 
@@ -848,6 +851,73 @@ bool ZDirector::wait_for_tick() {
   return true;
 }
 
+// Adaptive soft max heap
+
+static size_t _adaptive_soft_max_heap_size = 0;
+static double _memory_pressure = -1.0;
+static double _memory_pressure_sampled_at = -1.0;
+
+static double sample_memory_pressure() {
+  // The kernel updates the pressure averages every two seconds, so there
+  // is no point in reading them on every decision tick.
+  const double now = os::elapsedTime();
+  if (now - _memory_pressure_sampled_at >= 1.0) {
+    _memory_pressure = os::memory_pressure();
+    _memory_pressure_sampled_at = now;
+  }
+  return _memory_pressure;
+}
+
+static void adjust_soft_max_heap(const ZDirectorStats& stats) {
+  if (!stats._old_stats._cycle._is_time_trustable) {
+    // Not enough history to forecast
+    return;
+  }
+
+  // The heap needed is the live set of both generations, as seen at the
+  // end of their last marking, plus room for what the mutators are forecast
+  // to allocate while a young collection runs and for the requested interval
+  // between collections. Like the allocation rate rules, the forecast uses
+  // the moving average of the allocation rate times the spike tolerance
+  // plus ~3.3 sigma.
+  const size_t live = stats._young_stats._stat_heap._live_at_mark_end + stats._old_stats._stat_heap._live_at_mark_end;
+
+  const ZStatMutatorAllocRateStats alloc_rate_stats = stats._mutator_alloc_rate;
+  const double max_alloc_rate = (alloc_rate_stats._avg * ZAllocationSpikeTolerance) + (alloc_rate_stats._sd * one_in_1000);
+
+  const double serial_gc_time = stats._young_stats._cycle._avg_serial_time + (stats._young_stats._cycle._sd_serial_time * one_in_1000);
+  const double parallelizable_gc_time = stats._young_stats._cycle._avg_parallelizable_time + (stats._young_stats._cycle._sd_parallelizable_time * one_in_1000);
+  const double gc_duration = serial_gc_time + (parallelizable_gc_time / ZYoungGCThreads);
+
+  // When the machine or container is short of memory, tasks stall on
+  // reclaim. Then leave room only for what is allocated during a young
+  // collection, and give the rest of the interval headroom back.
+  const double pressure = sample_memory_pressure();
+  const double interval = pressure > ZAdaptiveSoftMaxHeapPressure ? 0.0 : ZAdaptiveSoftMaxHeapInterval;
+
+  const double allocated = max_alloc_rate * (gc_duration + interval);
+  const size_t headroom = (size_t)MIN2(allocated, (double)MaxHeapSize) + ZHeuristics::relocation_headroom();
+
+  const size_t upper = MIN2(Atomic::load(&SoftMaxHeapSize), MaxHeapSize);
+  const size_t lower = MIN2(MinHeapSize, upper);
+  const size_t target = clamp(align_up(live + MIN2(headroom, upper), ZGranuleSize), lower, upper);
+
+  // Grow at once, to stay ahead of allocation stalls. Shrink at once too,
+  // but only when the target dropped noticeably, to not uncommit memory
+  // for every small dip in the allocation rate.
+  const size_t current = _adaptive_soft_max_heap_size;
+  if (current != 0 && target < current && target > current - current / 10) {
+    return;
+  }
+
+  if (target != current) {
+    log_debug(gc, director)("Adaptive Soft Max Heap: " SIZE_FORMAT "M, Live: " SIZE_FORMAT "M, MaxAllocRate: %.1fMB/s, GCDuration: %.3fs, MemoryPressure: %.2f%%",
+                            target / M, live / M, max_alloc_rate / M, gc_duration, pressure);
+    _adaptive_soft_max_heap_size = target;
+    ZHeap::heap()->set_adaptive_soft_max_capacity(target);
+  }
+}
+
 static ZDirectorHeapStats sample_heap_stats() {
   const ZHeap* const heap = ZHeap::heap();
   const ZCollectedHeap* const collected_heap = ZCollectedHeap::heap();
@@ -905,6 +975,9 @@ void ZDirector::run_thread() {
   // Main loop
   while (wait_for_tick()) {
     ZDirectorStats stats = sample_stats();
+    if (ZAdaptiveSoftMaxHeap) {
+      adjust_soft_max_heap(stats);
+    }
     if (!start_gc(stats)) {
       adjust_gc(stats);
     }
@@ -110,6 +110,10 @@ size_t ZHeap::soft_max_capacity() const {
   return _page_allocator.soft_max_capacity();
 }
 
+void ZHeap::set_adaptive_soft_max_capacity(size_t capacity) {
+  _page_allocator.set_adaptive_soft_max_capacity(capacity);
+}
+
 size_t ZHeap::capacity() const {
   return _page_allocator.capacity();
 }
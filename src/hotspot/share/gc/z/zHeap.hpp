@@ -71,6 +71,7 @@ public:
   size_t min_capacity() const;
   size_t max_capacity() const;
   size_t soft_max_capacity() const;
+  void set_adaptive_soft_max_capacity(size_t capacity);
   size_t capacity() const;
   size_t used() const;
   size_t used_generation(ZGenerationId id) const;
@@ -189,6 +189,7 @@ ZPageAllocator::ZPageAllocator(size_t min_capacity,
     _initial_capacity(initial_capacity),
     _max_capacity(max_capacity),
     _current_max_capacity(max_capacity),
+    _adaptive_soft_max_capacity(max_capacity),
     _capacity(0),
     _claimed(0),
     _used(0),
@@ -296,7 +297,18 @@ size_t ZPageAllocator::soft_max_capacity() const {
   // Note that SoftMaxHeapSize is a manageable flag
   const size_t soft_max_capacity = Atomic::load(&SoftMaxHeapSize);
   const size_t current_max_capacity = Atomic::load(&_current_max_capacity);
-  return MIN2(soft_max_capacity, current_max_capacity);
+  const size_t adaptive_soft_max_capacity = Atomic::load(&_adaptive_soft_max_capacity);
+  return MIN3(soft_max_capacity, current_max_capacity, adaptive_soft_max_capacity);
+}
+
+void ZPageAllocator::set_adaptive_soft_max_capacity(size_t capacity) {
+  assert(ZAdaptiveSoftMaxHeap, "Should be enabled");
+
+  const size_t old_capacity = Atomic::xchg(&_adaptive_soft_max_capacity, capacity);
+  if (capacity < old_capacity && capacity < Atomic::load(&_capacity)) {
+    // Let the uncommitter return the memory above the new target
+    _uncommitter->wake();
+  }
 }
 
 size_t ZPageAllocator::capacity() const {
@@ -874,10 +886,16 @@ size_t ZPageAllocator::uncommit(uint64_t* timeout) {
     const size_t retain = MAX2(_used, _min_capacity);
     const size_t release = _capacity - retain;
     const size_t limit = MIN2(align_up(_current_max_capacity >> 7, ZGranuleSize), 256 * M);
-    const size_t flush = MIN2(release, limit);
+
+    // Memory committed above the adaptive soft max capacity is not expected
+    // to be needed again soon, and is uncommitted without delay.
+    const size_t expedite_retain = MAX2(retain, Atomic::load(&_adaptive_soft_max_capacity));
+    const size_t expedite_release = _capacity - MIN2(_capacity, expedite_retain);
+    const bool expedite = ZAdaptiveSoftMaxHeap && expedite_release > 0;
+    const size_t flush = MIN2(expedite ? expedite_release : release, limit);
 
     // Flush pages to uncommit
-    flushed = _cache.flush_for_uncommit(flush, &pages, timeout);
+    flushed = _cache.flush_for_uncommit(flush, &pages, timeout, expedite);
     if (flushed == 0) {
       // Nothing flushed
       return 0;
@@ -72,6 +72,7 @@ private:
   const size_t               _initial_capacity;
   const size_t               _max_capacity;
   volatile size_t            _current_max_capacity;
+  volatile size_t            _adaptive_soft_max_capacity;
   volatile size_t            _capacity;
   volatile size_t            _claimed;
   volatile size_t            _used;
@@ -137,6 +138,7 @@ public:
   size_t min_capacity() const;
   size_t max_capacity() const;
   size_t soft_max_capacity() const;
+  void set_adaptive_soft_max_capacity(size_t capacity);
   size_t capacity() const;
   size_t used() const;
   size_t used_generation(ZGenerationId id) const;
@@ -278,19 +278,21 @@ class ZPageCacheFlushForUncommitClosure : public ZPageCacheFlushClosure {
 private:
   const uint64_t _now;
   uint64_t*      _timeout;
+  const bool     _expedite;
 
 public:
-  ZPageCacheFlushForUncommitClosure(size_t requested, uint64_t now, uint64_t* timeout)
+  ZPageCacheFlushForUncommitClosure(size_t requested, uint64_t now, uint64_t* timeout, bool expedite)
     : ZPageCacheFlushClosure(requested),
       _now(now),
-      _timeout(timeout) {
+      _timeout(timeout),
+      _expedite(expedite) {
     // Set initial timeout
     *_timeout = ZUncommitDelay;
   }
 
   virtual bool do_page(const ZPage* page) {
     const uint64_t expires = page->last_used() + ZUncommitDelay;
-    if (expires > _now) {
+    if (!_expedite && expires > _now) {
       // Don't flush page, record shortest non-expired timeout
       *_timeout = MIN2(*_timeout, expires - _now);
       return false;
@@ -307,10 +309,10 @@ public:
   }
 };
 
-size_t ZPageCache::flush_for_uncommit(size_t requested, ZList<ZPage>* to, uint64_t* timeout) {
+size_t ZPageCache::flush_for_uncommit(size_t requested, ZList<ZPage>* to, uint64_t* timeout, bool expedite) {
   const uint64_t now = os::elapsedTime();
   const uint64_t expires = _last_commit + ZUncommitDelay;
-  if (expires > now) {
+  if (!expedite && expires > now) {
     // Delay uncommit, set next timeout
     *timeout = expires - now;
     return 0;
@@ -322,7 +324,7 @@ size_t ZPageCache::flush_for_uncommit(size_t requested, ZList<ZPage>* to, uint64
     return 0;
   }
 
-  ZPageCacheFlushForUncommitClosure cl(requested, now, timeout);
+  ZPageCacheFlushForUncommitClosure cl(requested, now, timeout, expedite);
   flush(&cl, to);
 
   return cl._flushed;
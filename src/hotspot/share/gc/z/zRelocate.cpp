@@ -34,6 +34,7 @@
 #include "gc/z/zHeap.inline.hpp"
 #include "gc/z/zIndexDistributor.inline.hpp"
 #include "gc/z/zIterator.inline.hpp"
+#include "gc/z/zNUMA.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageAge.hpp"
 #include "gc/z/zRelocate.hpp"
@@ -46,6 +47,7 @@
 #include "gc/z/zVerify.hpp"
 #include "gc/z/zWorkers.hpp"
 #include "prims/jvmtiTagMap.hpp"
+#include "memory/allocation.hpp"
 #include "runtime/atomic.hpp"
 #include "utilities/debug.hpp"
 
@@ -1084,9 +1086,93 @@ public:
   }
 };
 
+// The relocation set grouped by the NUMA node of the pages. Workers first
+// claim pages on the node they are currently running on, which makes both
+// the reads of the from-objects and, since target pages are allocated from
+// the page cache of the current node, the writes of the to-objects node
+// local. When a node runs out of pages, its workers help the other nodes.
+class ZRelocateNUMAIterator : public CHeapObj<mtGC> {
+private:
+  const uint32_t   _count;
+  ZForwarding**    _forwardings;
+  size_t*          _start;
+  size_t*          _end;
+  volatile size_t* _next;
+
+  bool next_on_node(uint32_t numa_id, ZForwarding** forwarding) {
+    if (Atomic::load(&_next[numa_id]) >= _end[numa_id]) {
+      return false;
+    }
+
+    const size_t index = Atomic::fetch_then_add(&_next[numa_id], (size_t)1);
+    if (index >= _end[numa_id]) {
+      return false;
+    }
+
+    *forwarding = _forwardings[index];
+    return true;
+  }
+
+public:
+  ZRelocateNUMAIterator(ZRelocationSet* relocation_set)
+    : _count(ZNUMA::count()),
+      _forwardings(nullptr),
+      _start(NEW_C_HEAP_ARRAY(size_t, _count, mtGC)),
+      _end(NEW_C_HEAP_ARRAY(size_t, _count, mtGC)),
+      _next(NEW_C_HEAP_ARRAY(size_t, _count, mtGC)) {
+    // Counting sort, which keeps the original order within each node
+    for (uint32_t i = 0; i < _count; i++) {
+      _end[i] = 0;
+    }
+
+    size_t nforwardings = 0;
+    ZRelocationSetIterator count_iter(relocation_set);
+    for (ZForwarding* forwarding; count_iter.next(&forwarding);) {
+      _end[forwarding->page()->numa_id()]++;
+      nforwardings++;
+    }
+
+    size_t start = 0;
+    for (uint32_t i = 0; i < _count; i++) {
+      _start[i] = start;
+      _next[i] = start;
+      start += _end[i];
+      _end[i] = _start[i];
+    }
+
+    _forwardings = NEW_C_HEAP_ARRAY(ZForwarding*, MAX2(nforwardings, (size_t)1), mtGC);
+
+    ZRelocationSetIterator fill_iter(relocation_set);
+    for (ZForwarding* forwarding; fill_iter.next(&forwarding);) {
+      _forwardings[_end[forwarding->page()->numa_id()]++] = forwarding;
+    }
+  }
+
+  ~ZRelocateNUMAIterator() {
+    FREE_C_HEAP_ARRAY(ZForwarding*, _forwardings);
+    FREE_C_HEAP_ARRAY(size_t, _start);
+    FREE_C_HEAP_ARRAY(size_t, _end);
+    FREE_C_HEAP_ARRAY(size_t, _next);
+  }
+
+  bool next(ZForwarding** forwarding) {
+    const uint32_t local_id = ZNUMA::id();
+
+    for (uint32_t i = 0; i < _count; i++) {
+      const uint32_t numa_id = (local_id + i) % _count;
+      if (next_on_node(numa_id, forwarding)) {
+        return true;
+      }
+    }
+
+    return false;
+  }
+};
+
 class ZRelocateTask : public ZRestartableTask {
 private:
   ZRelocationSetParallelIterator _iter;
+  ZRelocateNUMAIterator*         _numa_iter;
   ZGeneration* const             _generation;
   ZRelocateQueue* const          _queue;
   ZRelocateSmallAllocator        _small_allocator;
@@ -1096,12 +1182,15 @@ public:
   ZRelocateTask(ZRelocationSet* relocation_set, ZRelocateQueue* queue)
     : ZRestartableTask("ZRelocateTask"),
       _iter(relocation_set),
+      _numa_iter(ZNUMA::count() > 1 ? new ZRelocateNUMAIterator(relocation_set) : nullptr),
       _generation(relocation_set->generation()),
       _queue(queue),
       _small_allocator(_generation),
       _medium_allocator(_generation) {}
 
   ~ZRelocateTask() {
+    delete _numa_iter;
+
     _generation->stat_relocation()->at_relocate_end(_small_allocator.in_place_count(), _medium_allocator.in_place_count());
 
     // Signal that we're not using the queue anymore. Used mostly for asserts.
@@ -1139,7 +1228,7 @@ public:
     const auto do_forwarding_one_from_iter = [&]() {
       ZForwarding* forwarding;
 
-      if (_iter.next(&forwarding)) {
+      if (_numa_iter != nullptr ? _numa_iter->next(&forwarding) : _iter.next(&forwarding)) {
         claim_and_do_forwarding(forwarding);
         return true;
       }
@@ -27,6 +27,7 @@
 #include "gc/z/zForwarding.inline.hpp"
 #include "gc/z/zForwardingAllocator.inline.hpp"
 #include "gc/z/zGeneration.inline.hpp"
+#include "gc/z/zNUMA.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageAllocator.hpp"
 #include "gc/z/zRelocationSet.inline.hpp"
@@ -54,6 +55,12 @@ private:
 
     page->log_msg(" (relocation selected)");
 
+    if (ZNUMA::is_enabled()) {
+      // Look up, and cache, the NUMA node of the page while installing
+      // in parallel. It is used to group the relocation work by node.
+      page->numa_id();
+    }
+
     _forwardings[index] = forwarding;
 
     if (forwarding->is_promotion()) {
@@ -47,6 +47,24 @@
   product(bool, ZCollectionIntervalOnly, false,                             \
           "Only use timers for GC heuristics")                              \
                                                                             \
+  product(bool, ZAdaptiveSoftMaxHeap, false, EXPERIMENTAL,                  \
+          "Adjust the soft max heap size to the heap needed by the live "   \
+          "set and the forecast allocation rate, and uncommit memory "      \
+          "above it without waiting for ZUncommitDelay")                    \
+                                                                            \
+  product(double, ZAdaptiveSoftMaxHeapInterval, 1.0, EXPERIMENTAL,          \
+          "Time in seconds of forecast allocation, in addition to the "     \
+          "duration of a young collection, that the adaptive soft max "     \
+          "heap size leaves room for")                                      \
+          range(0.0, 3600.0)                                                \
+                                                                            \
+  product(double, ZAdaptiveSoftMaxHeapPressure, 10.0, EXPERIMENTAL,         \
+          "Memory pressure, in percent of time in which tasks stalled "     \
+          "waiting for memory, above which the adaptive soft max heap "     \
+          "size drops the ZAdaptiveSoftMaxHeapInterval headroom. Only "     \
+          "known on Linux with pressure stall information")                 \
+          range(0.0, 100.0)                                                 \
+                                                                            \
   product(bool, ZBufferStoreBarriers, true, DIAGNOSTIC,                     \
           "Buffer store barriers")                                          \
                                                                             \
@@ -437,10 +437,14 @@ void InterpreterOopMap::resource_copy(OopMapCacheEntry* from) {
 inline unsigned int OopMapCache::hash_value_for(const methodHandle& method, int bci) const {
   // We use method->code_size() rather than method->identity_hash() below since
   // the mark may not be present if a pointer to the method is already reversed.
-  return   ((unsigned int) bci)
-         ^ ((unsigned int) method->max_locals()         << 2)
-         ^ ((unsigned int) method->code_size()          << 4)
-         ^ ((unsigned int) method->size_of_parameters() << 6);
+  unsigned int hash = ((unsigned int) bci)
+                    ^ ((unsigned int) method->max_locals()         << 2)
+                    ^ ((unsigned int) method->code_size()          << 4)
+                    ^ ((unsigned int) method->size_of_parameters() << 6);
+  // Only the low bits select a slot. Fold the high bits in, otherwise the
+  // parameter size and most of the code size would not count and methods of
+  // the same class at the same bcis would keep evicting each other.
+  return hash ^ (hash >> 5) ^ (hash >> 10) ^ (hash >> 15);
 }
 
 OopMapCacheEntry* volatile OopMapCache::_old_entries = nullptr;
@@ -64,6 +64,9 @@
 #include "osContainer_linux.hpp"
 #include "os_linux.hpp"
 #endif
+#ifdef BSD
+#include "osContainer_bsd.hpp"
+#endif
 
 #define NO_TRANSITION(result_type, header) extern "C" { result_type JNICALL header {
 #define NO_TRANSITION_END } }
@@ -118,6 +121,9 @@ NO_TRANSITION(void, jfr_set_enabled(JNIEnv* env, jobject jvm, jlong event_type_i
     } else {
       LeakProfiler::stop();
     }
+  } else if (EventCPUTimeSample::eventId == event_type_id) {
+    ThreadInVMfromNative transition(JavaThread::thread_from_jni_environment(env));
+    JfrThreadSampling::set_cpu_time_sample_period(JNI_TRUE == enabled ? JfrOptionSet::cpu_sample_period() : 0);
   }
 NO_TRANSITION_END
 
@@ -389,7 +395,7 @@ JVM_ENTRY_NO_ENV(jboolean, jfr_is_class_instrumented(JNIEnv* env, jobject jvm, j
 JVM_END
 
 JVM_ENTRY_NO_ENV(jboolean, jfr_is_containerized(JNIEnv* env, jobject jvm))
-#ifdef LINUX
+#if defined(LINUX) || defined(BSD)
   return OSContainer::is_containerized();
 #else
   return false;
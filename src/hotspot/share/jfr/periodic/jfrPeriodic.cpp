@@ -44,6 +44,8 @@
 #include "jfr/periodic/jfrNativeMemoryEvent.hpp"
 #include "jfr/periodic/jfrNetworkUtilization.hpp"
 #include "jfr/recorder/jfrRecorder.hpp"
+#include "jfr/support/jfrMonitorContentionSummary.hpp"
+#include "jfr/support/jfrObjectAllocationSummary.hpp"
 #include "jfr/utilities/jfrThreadIterator.hpp"
 #include "jfr/utilities/jfrTime.hpp"
 #include "jfrfiles/jfrPeriodic.hpp"
@@ -708,6 +710,14 @@ TRACE_REQUEST_FUNC(ShenandoahHeapRegionInformation) {
 #endif
 }
 
+TRACE_REQUEST_FUNC(ObjectAllocationSummary) {
+  JfrObjectAllocationSummary::send_events();
+}
+
+TRACE_REQUEST_FUNC(JavaMonitorContentionSummary) {
+  JfrMonitorContentionSummary::send_events();
+}
+
 TRACE_REQUEST_FUNC(FinalizerStatistics) {
 #if INCLUDE_MANAGEMENT
   JfrFinalizerStatisticsEvent::generate_events();
@@ -0,0 +1,294 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "jfr/periodic/sampling/jfrCPUTimer.hpp"
+#include "jfr/support/jfrThreadLocal.hpp"
+#include "logging/log.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/javaThread.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
+#include "runtime/osThread.hpp"
+#include "runtime/threadSMR.hpp"
+
+#if defined(LINUX) || defined(__FreeBSD__)
+
+#include <errno.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/time.h>
+#include <time.h>
+
+#ifdef LINUX
+// Not all C libraries expose the thread id member of struct sigevent by this name.
+#ifndef sigev_notify_thread_id
+#define sigev_notify_thread_id _sigev_un._tid
+#endif
+#endif
+
+static const int CPU_TIMER_SIGNAL = SIGPROF;
+
+// Period in nanoseconds of CPU time, 0 if stopped.
+static volatile int64_t _period_nanos = 0;
+static bool _handler_installed = false;
+
+static bool is_sampled(const JavaThread* jt) {
+  assert(jt != nullptr, "invariant");
+  return !jt->is_Compiler_thread() && !jt->is_hidden_from_external_view();
+}
+
+// Async-signal-safe: no locks, no allocation.
+static void handle_cpu_timer_signal(int sig, siginfo_t* info, void* ucontext) {
+  const int saved_errno = errno;
+  Thread* const t = Thread::current_or_null_safe();
+  if (t != nullptr && t->is_Java_thread()) {
+    u4 expirations = 1;
+#ifdef LINUX
+    if (info != nullptr && info->si_code == SI_TIMER && info->si_overrun > 0) {
+      expirations += (u4)info->si_overrun;
+    }
+#endif
+    JavaThread::cast(t)->jfr_thread_local()->add_cpu_time_expirations(expirations);
+  }
+  errno = saved_errno;
+}
+
+static bool install_signal_handler() {
+  assert_lock_strong(JfrCPUTimer_lock);
+  if (_handler_installed) {
+    return true;
+  }
+  struct sigaction old_act;
+  if (sigaction(CPU_TIMER_SIGNAL, nullptr, &old_act) != 0) {
+    return false;
+  }
+  const void* const old_handler = (old_act.sa_flags & SA_SIGINFO) != 0 ?
+    (const void*)old_act.sa_sigaction : (const void*)old_act.sa_handler;
+  if (old_handler != (const void*)SIG_DFL && old_handler != (const void*)SIG_IGN) {
+    // Someone else, for example a profiling agent, owns the signal.
+    log_warning(jfr)("SIGPROF already has a handler installed, CPU time sampling is disabled");
+    return false;
+  }
+  struct sigaction act;
+  memset(&act, 0, sizeof(act));
+  sigemptyset(&act.sa_mask);
+  act.sa_flags = SA_SIGINFO | SA_RESTART;
+  act.sa_sigaction = handle_cpu_timer_signal;
+  if (sigaction(CPU_TIMER_SIGNAL, &act, nullptr) != 0) {
+    log_warning(jfr)("Failed to install SIGPROF handler for CPU time sampling: %s", os::strerror(errno));
+    return false;
+  }
+  _handler_installed = true;
+  return true;
+}
+
+#ifdef LINUX
+
+static void to_timespec(int64_t nanos, struct timespec* ts) {
+  ts->tv_sec = (time_t)(nanos / NANOSECS_PER_SEC);
+  ts->tv_nsec = (long)(nanos % NANOSECS_PER_SEC);
+}
+
+static bool arm_timer(timer_t timer, int64_t period_nanos) {
+  struct itimerspec its;
+  to_timespec(period_nanos, &its.it_value);
+  to_timespec(period_nanos, &its.it_interval);
+  return timer_settime(timer, 0, &its, nullptr) == 0;
+}
+
+static void create_timer(JavaThread* jt, int64_t period_nanos) {
+  assert_lock_strong(JfrCPUTimer_lock);
+  JfrThreadLocal* const tl = jt->jfr_thread_local();
+  if (tl->is_dead() || !is_sampled(jt)) {
+    return;
+  }
+  void* const existing = tl->cpu_timer();
+  if (existing != nullptr) {
+    // The period changed.
+    arm_timer((timer_t)existing, period_nanos);
+    return;
+  }
+  OSThread* const os_thread = jt->osthread();
+  if (os_thread == nullptr) {
+    return;
+  }
+  clockid_t clock;
+  if (pthread_getcpuclockid(os_thread->pthread_id(), &clock) != 0) {
+    return;
+  }
+  struct sigevent sev;
+  memset(&sev, 0, sizeof(sev));
+  sev.sigev_notify = SIGEV_THREAD_ID;
+  sev.sigev_signo = CPU_TIMER_SIGNAL;
+  sev.sigev_notify_thread_id = (pid_t)os_thread->thread_id();
+  timer_t timer;
+  if (timer_create(clock, &sev, &timer) != 0) {
+    log_debug(jfr)("Failed to create CPU timer for thread " UINTX_FORMAT ": %s",
+                   (uintx)os_thread->thread_id(), os::strerror(errno));
+    return;
+  }
+  if (!arm_timer(timer, period_nanos)) {
+    timer_delete(timer);
+    return;
+  }
+  tl->set_cpu_timer((void*)timer);
+}
+
+static void delete_timer(JavaThread* jt) {
+  assert_lock_strong(JfrCPUTimer_lock);
+  JfrThreadLocal* const tl = jt->jfr_thread_local();
+  void* const timer = tl->cpu_timer();
+  if (timer != nullptr) {
+    timer_delete((timer_t)timer);
+    tl->set_cpu_timer(nullptr);
+  }
+}
+
+static bool start_timers(int64_t period_nanos) {
+  ThreadsListHandle tlh;
+  for (uint i = 0; i < tlh.list()->length(); i++) {
+    create_timer(tlh.list()->thread_at(i), period_nanos);
+  }
+  return true;
+}
+
+static void stop_timers() {
+  ThreadsListHandle tlh;
+  for (uint i = 0; i < tlh.list()->length(); i++) {
+    delete_timer(tlh.list()->thread_at(i));
+  }
+}
+
+#else // __FreeBSD__
+
+static bool set_process_timer(int64_t period_nanos) {
+  struct itimerval itv;
+  const int64_t micros = period_nanos == 0 ? 0 : MAX2<int64_t>(period_nanos / 1000, 1);
+  itv.it_value.tv_sec = (time_t)(micros / 1000000);
+  itv.it_value.tv_usec = (suseconds_t)(micros % 1000000);
+  itv.it_interval = itv.it_value;
+  return setitimer(ITIMER_PROF, &itv, nullptr) == 0;
+}
+
+// ITIMER_PROF accounts for the CPU time of the whole process. FreeBSD delivers
+// the signal to the thread that was running, so each expiration still stands
+// for the period of CPU time consumed by the thread that receives it.
+static bool start_timers(int64_t period_nanos) {
+  if (!set_process_timer(period_nanos)) {
+    log_warning(jfr)("Failed to start ITIMER_PROF for CPU time sampling: %s", os::strerror(errno));
+    return false;
+  }
+  return true;
+}
+
+static void stop_timers() {
+  set_process_timer(0);
+}
+
+#endif // LINUX
+
+bool JfrCPUTimer::is_supported() {
+  return true;
+}
+
+bool JfrCPUTimer::start(int64_t period_nanos) {
+  assert(period_nanos > 0, "invariant");
+  MutexLocker ml(JfrCPUTimer_lock, Mutex::_no_safepoint_check_flag);
+  if (!install_signal_handler()) {
+    return false;
+  }
+  Atomic::store(&_period_nanos, period_nanos);
+  if (!start_timers(period_nanos)) {
+    Atomic::store(&_period_nanos, (int64_t)0);
+    return false;
+  }
+  log_debug(jfr)("Started CPU timers with a period of " INT64_FORMAT " ns", period_nanos);
+  return true;
+}
+
+void JfrCPUTimer::stop() {
+  MutexLocker ml(JfrCPUTimer_lock, Mutex::_no_safepoint_check_flag);
+  if (Atomic::load(&_period_nanos) == 0) {
+    return;
+  }
+  Atomic::store(&_period_nanos, (int64_t)0);
+  stop_timers();
+  log_debug(jfr)("Stopped CPU timers");
+}
+
+bool JfrCPUTimer::is_started() {
+  return Atomic::load(&_period_nanos) > 0;
+}
+
+int64_t JfrCPUTimer::period() {
+  return Atomic::load(&_period_nanos);
+}
+
+void JfrCPUTimer::on_thread_start(JavaThread* jt) {
+#ifdef LINUX
+  if (is_started()) {
+    MutexLocker ml(JfrCPUTimer_lock, Mutex::_no_safepoint_check_flag);
+    const int64_t period_nanos = Atomic::load(&_period_nanos);
+    if (period_nanos > 0) {
+      create_timer(jt, period_nanos);
+    }
+  }
+#endif
+}
+
+void JfrCPUTimer::on_thread_exit(JavaThread* jt) {
+#ifdef LINUX
+  if (jt->jfr_thread_local()->cpu_timer() != nullptr) {
+    MutexLocker ml(JfrCPUTimer_lock, Mutex::_no_safepoint_check_flag);
+    delete_timer(jt);
+  }
+#endif
+}
+
+#else // defined(LINUX) || defined(__FreeBSD__)
+
+bool JfrCPUTimer::is_supported() {
+  return false;
+}
+
+bool JfrCPUTimer::start(int64_t period_nanos) {
+  return false;
+}
+
+void JfrCPUTimer::stop() {}
+
+bool JfrCPUTimer::is_started() {
+  return false;
+}
+
+int64_t JfrCPUTimer::period() {
+  return 0;
+}
+
+void JfrCPUTimer::on_thread_start(JavaThread* jt) {}
+
+void JfrCPUTimer::on_thread_exit(JavaThread* jt) {}
+
+#endif // defined(LINUX) || defined(__FreeBSD__)
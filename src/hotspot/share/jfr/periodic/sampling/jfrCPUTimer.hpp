@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_JFR_PERIODIC_SAMPLING_JFRCPUTIMER_HPP
+#define SHARE_JFR_PERIODIC_SAMPLING_JFRCPUTIMER_HPP
+
+#include "memory/allStatic.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class JavaThread;
+
+//
+// Timers that expire each time a Java thread has consumed a given amount of CPU time.
+//
+// On Linux every sampled thread gets a timer_create(2) timer on its thread CPU-time
+// clock, signalling the thread itself. On FreeBSD a single ITIMER_PROF interval timer
+// is used, whose signal is delivered to the thread that was running when the timer
+// expired. The signal handler only counts the expirations in the JfrThreadLocal of
+// the running thread, the stack traces are taken by the JfrThreadSampler.
+//
+class JfrCPUTimer : AllStatic {
+ public:
+  static bool is_supported();
+  static bool start(int64_t period_nanos);
+  static void stop();
+  static bool is_started();
+  static int64_t period();
+
+  // Hooks
+  static void on_thread_start(JavaThread* jt);
+  static void on_thread_exit(JavaThread* jt);
+};
+
+#endif // SHARE_JFR_PERIODIC_SAMPLING_JFRCPUTIMER_HPP
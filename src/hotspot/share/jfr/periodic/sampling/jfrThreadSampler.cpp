@@ -26,6 +26,7 @@
 #include "jfr/jfrEvents.hpp"
 #include "jfr/recorder/jfrRecorder.hpp"
 #include "jfr/periodic/sampling/jfrCallTrace.hpp"
+#include "jfr/periodic/sampling/jfrCPUTimer.hpp"
 #include "jfr/periodic/sampling/jfrThreadSampler.hpp"
 #include "jfr/recorder/checkpoint/types/traceid/jfrTraceIdLoadBarrier.inline.hpp"
 #include "jfr/recorder/service/jfrOptionSet.hpp"
@@ -50,7 +51,8 @@
 enum JfrSampleType {
   NO_SAMPLE = 0,
   JAVA_SAMPLE = 1,
-  NATIVE_SAMPLE = 2
+  NATIVE_SAMPLE = 2,
+  CPU_TIME_SAMPLE = 3
 };
 
 static bool thread_state_in_java(JavaThread* thread) {
@@ -101,36 +103,51 @@ static bool thread_state_in_native(JavaThread* thread) {
 
 class JfrThreadSampleClosure {
  public:
-  JfrThreadSampleClosure(EventExecutionSample* events, EventNativeMethodSample* events_native);
+  JfrThreadSampleClosure(EventExecutionSample* events, EventNativeMethodSample* events_native,
+                         EventCPUTimeSample* events_cpu_time = nullptr);
   ~JfrThreadSampleClosure() {}
   EventExecutionSample* next_event() { return &_events[_added_java++]; }
   EventNativeMethodSample* next_event_native() { return &_events_native[_added_native++]; }
+  EventCPUTimeSample* next_event_cpu_time() { return &_events_cpu_time[_added_cpu_time++]; }
   void commit_events(JfrSampleType type);
   bool do_sample_thread(JavaThread* thread, JfrStackFrame* frames, u4 max_frames, JfrSampleType type);
   uint java_entries() { return _added_java; }
   uint native_entries() { return _added_native; }
+  uint cpu_time_entries() { return _added_cpu_time; }
 
  private:
-  bool sample_thread_in_java(JavaThread* thread, JfrStackFrame* frames, u4 max_frames);
-  bool sample_thread_in_native(JavaThread* thread, JfrStackFrame* frames, u4 max_frames);
+  bool sample_thread_in_java(JavaThread* thread, JfrStackFrame* frames, u4 max_frames, JfrSampleType type);
+  bool sample_thread_in_native(JavaThread* thread, JfrStackFrame* frames, u4 max_frames, JfrSampleType type);
+  bool sample_thread_cpu_time(JavaThread* thread, JfrStackFrame* frames, u4 max_frames);
   EventExecutionSample* _events;
   EventNativeMethodSample* _events_native;
+  EventCPUTimeSample* _events_cpu_time;
   Thread* _self;
   uint _added_java;
   uint _added_native;
+  uint _added_cpu_time;
 };
 
+// The remaining fields of the event are set once the sampled thread has been resumed.
+static void write_cpu_time_event(JfrThreadSampleClosure& closure, JavaThread* jt, oop thread_oop) {
+  EventCPUTimeSample *ev = closure.next_event_cpu_time();
+  ev->set_sampledThread(JfrThreadLocal::thread_id(jt));
+  ev->set_state(static_cast<u8>(java_lang_Thread::get_thread_status(thread_oop)));
+}
+
 class OSThreadSampler : public SuspendedThreadTask {
  public:
   OSThreadSampler(JavaThread* thread,
                   JfrThreadSampleClosure& closure,
                   JfrStackFrame *frames,
-                  u4 max_frames) : SuspendedThreadTask((Thread*)thread),
+                  u4 max_frames,
+                  JfrSampleType type) : SuspendedThreadTask((Thread*)thread),
     _success(false),
     _thread_oop(thread->threadObj()),
     _stacktrace(frames, max_frames),
     _closure(closure),
-    _suspend_time() {}
+    _suspend_time(),
+    _type(type) {}
 
   void take_sample();
   void do_task(const SuspendedThreadTaskContext& context);
@@ -144,6 +161,7 @@ class OSThreadSampler : public SuspendedThreadTask {
   JfrStackTrace _stacktrace;
   JfrThreadSampleClosure& _closure;
   JfrTicks _suspend_time;
+  JfrSampleType _type;
 };
 
 class OSThreadSamplerCallback : public CrashProtectionCallback {
@@ -196,6 +214,10 @@ void OSThreadSampler::protected_task(const SuspendedThreadTaskContext& context)
       * here since it would allocate memory using malloc. Doing so while
       * the stopped thread is inside malloc would deadlock. */
       _success = true;
+      if (CPU_TIME_SAMPLE == _type) {
+        write_cpu_time_event(_closure, jt, _thread_oop);
+        return;
+      }
       EventExecutionSample *ev = _closure.next_event();
       ev->set_starttime(_suspend_time);
       ev->set_endtime(_suspend_time); // fake to not take an end time
@@ -211,8 +233,10 @@ void OSThreadSampler::take_sample() {
 
 class JfrNativeSamplerCallback : public CrashProtectionCallback {
  public:
-  JfrNativeSamplerCallback(JfrThreadSampleClosure& closure, JavaThread* jt, JfrStackFrame* frames, u4 max_frames) :
-    _closure(closure), _jt(jt), _thread_oop(jt->threadObj()), _stacktrace(frames, max_frames), _success(false) {
+  JfrNativeSamplerCallback(JfrThreadSampleClosure& closure, JavaThread* jt, JfrStackFrame* frames, u4 max_frames,
+                           JfrSampleType type) :
+    _closure(closure), _jt(jt), _thread_oop(jt->threadObj()), _stacktrace(frames, max_frames), _success(false),
+    _type(type) {
   }
   virtual void call();
   bool success() { return _success; }
@@ -224,6 +248,7 @@ class JfrNativeSamplerCallback : public CrashProtectionCallback {
   oop _thread_oop;
   JfrStackTrace _stacktrace;
   bool _success;
+  JfrSampleType _type;
 };
 
 static void write_native_event(JfrThreadSampleClosure& closure, JavaThread* jt, oop thread_oop) {
@@ -252,17 +277,21 @@ void JfrNativeSamplerCallback::call() {
   topframe = first_java_frame;
   _success = _stacktrace.record_async(_jt, topframe);
   if (_success) {
-    write_native_event(_closure, _jt, _thread_oop);
+    if (CPU_TIME_SAMPLE == _type) {
+      write_cpu_time_event(_closure, _jt, _thread_oop);
+    } else {
+      write_native_event(_closure, _jt, _thread_oop);
+    }
   }
 }
 
-bool JfrThreadSampleClosure::sample_thread_in_java(JavaThread* thread, JfrStackFrame* frames, u4 max_frames) {
+bool JfrThreadSampleClosure::sample_thread_in_java(JavaThread* thread, JfrStackFrame* frames, u4 max_frames, JfrSampleType type) {
   // Process the oops in the thread head before calling into code that wants to
   // stack walk over Loom continuations. The stack walking code will otherwise
   // skip frames in stack chunks on the Java heap.
   StackWatermarkSet::start_processing(thread, StackWatermarkKind::gc);
 
-  OSThreadSampler sampler(thread, *this, frames, max_frames);
+  OSThreadSampler sampler(thread, *this, frames, max_frames, type);
   sampler.take_sample();
   /* We don't want to allocate any memory using malloc/etc while the thread
   * is stopped, so everything is stored in stack allocated memory until this
@@ -272,20 +301,23 @@ bool JfrThreadSampleClosure::sample_thread_in_java(JavaThread* thread, JfrStackF
   if (!sampler.success()) {
     return false;
   }
-  EventExecutionSample *event = &_events[_added_java - 1];
   traceid id = JfrStackTraceRepository::add(sampler.stacktrace());
   assert(id != 0, "Stacktrace id should not be 0");
-  event->set_stackTrace(id);
+  if (CPU_TIME_SAMPLE == type) {
+    _events_cpu_time[_added_cpu_time - 1].set_stackTrace(id);
+  } else {
+    _events[_added_java - 1].set_stackTrace(id);
+  }
   return true;
 }
 
-bool JfrThreadSampleClosure::sample_thread_in_native(JavaThread* thread, JfrStackFrame* frames, u4 max_frames) {
+bool JfrThreadSampleClosure::sample_thread_in_native(JavaThread* thread, JfrStackFrame* frames, u4 max_frames, JfrSampleType type) {
   // Process the oops in the thread head before calling into code that wants to
   // stack walk over Loom continuations. The stack walking code will otherwise
   // skip frames in stack chunks on the Java heap.
   StackWatermarkSet::start_processing(thread, StackWatermarkKind::gc);
 
-  JfrNativeSamplerCallback cb(*this, thread, frames, max_frames);
+  JfrNativeSamplerCallback cb(*this, thread, frames, max_frames, type);
   if (JfrOptionSet::sample_protection()) {
     ThreadCrashProtection crash_protection;
     if (!crash_protection.call(cb)) {
@@ -297,18 +329,52 @@ bool JfrThreadSampleClosure::sample_thread_in_native(JavaThread* thread, JfrStac
   if (!cb.success()) {
     return false;
   }
-  EventNativeMethodSample *event = &_events_native[_added_native - 1];
   traceid id = JfrStackTraceRepository::add(cb.stacktrace());
   assert(id != 0, "Stacktrace id should not be 0");
-  event->set_stackTrace(id);
+  if (CPU_TIME_SAMPLE == type) {
+    _events_cpu_time[_added_cpu_time - 1].set_stackTrace(id);
+  } else {
+    _events_native[_added_native - 1].set_stackTrace(id);
+  }
   return true;
 }
 
+// Samples a thread whose CPU timer expired since it was last visited. The stack trace is taken
+// now, on behalf of all pending expirations, which the event reports as its weight.
+bool JfrThreadSampleClosure::sample_thread_cpu_time(JavaThread* thread, JfrStackFrame* frames, u4 max_frames) {
+  bool ret = false;
+  if (thread_state_in_java(thread)) {
+    ret = sample_thread_in_java(thread, frames, max_frames, CPU_TIME_SAMPLE);
+  } else if (thread_state_in_native(thread)) {
+    ret = sample_thread_in_native(thread, frames, max_frames, CPU_TIME_SAMPLE);
+  }
+  // Expirations that could not be attributed to a stack trace are dropped,
+  // rather than being charged to whatever the thread runs next.
+  JfrTicks first_expiration;
+  const u4 expirations = thread->jfr_thread_local()->take_cpu_time_expirations(&first_expiration);
+  if (ret) {
+    EventCPUTimeSample* event = &_events_cpu_time[_added_cpu_time - 1];
+    event->set_starttime(first_expiration);
+    event->set_endtime(first_expiration); // fake to not take an end time
+    event->set_samplingPeriod(JfrCPUTimer::period());
+    event->set_samples(MAX2<u4>(expirations, 1));
+  }
+  return ret;
+}
+
 static const uint MAX_NR_OF_JAVA_SAMPLES = 5;
 static const uint MAX_NR_OF_NATIVE_SAMPLES = 1;
+static const uint MAX_NR_OF_CPU_TIME_SAMPLES = 32;
 
 void JfrThreadSampleClosure::commit_events(JfrSampleType type) {
-  if (JAVA_SAMPLE == type) {
+  if (CPU_TIME_SAMPLE == type) {
+    assert(_added_cpu_time > 0 && _added_cpu_time <= MAX_NR_OF_CPU_TIME_SAMPLES, "invariant");
+    if (EventCPUTimeSample::is_enabled()) {
+      for (uint i = 0; i < _added_cpu_time; ++i) {
+        _events_cpu_time[i].commit();
+      }
+    }
+  } else if (JAVA_SAMPLE == type) {
     assert(_added_java > 0 && _added_java <= MAX_NR_OF_JAVA_SAMPLES, "invariant");
     if (EventExecutionSample::is_enabled()) {
       for (uint i = 0; i < _added_java; ++i) {
@@ -326,12 +392,15 @@ void JfrThreadSampleClosure::commit_events(JfrSampleType type) {
   }
 }
 
-JfrThreadSampleClosure::JfrThreadSampleClosure(EventExecutionSample* events, EventNativeMethodSample* events_native) :
+JfrThreadSampleClosure::JfrThreadSampleClosure(EventExecutionSample* events, EventNativeMethodSample* events_native,
+                                               EventCPUTimeSample* events_cpu_time) :
   _events(events),
   _events_native(events_native),
+  _events_cpu_time(events_cpu_time),
   _self(Thread::current()),
   _added_java(0),
-  _added_native(0) {
+  _added_native(0),
+  _added_cpu_time(0) {
 }
 
 class JfrThreadSampler : public NonJavaThread {
@@ -342,8 +411,10 @@ class JfrThreadSampler : public NonJavaThread {
   JfrStackFrame* const _frames;
   JavaThread* _last_thread_java;
   JavaThread* _last_thread_native;
+  JavaThread* _last_thread_cpu_time;
   int64_t _java_period_millis;
   int64_t _native_period_millis;
+  int64_t _cpu_time_period_millis;
   const size_t _min_size; // for enqueue buffer monitoring
   int _cur_index;
   const u4 _max_frames;
@@ -354,7 +425,7 @@ class JfrThreadSampler : public NonJavaThread {
 
   JavaThread* next_thread(ThreadsList* t_list, JavaThread* first_sampled, JavaThread* current);
   void task_stacktrace(JfrSampleType type, JavaThread** last_thread);
-  JfrThreadSampler(int64_t java_period_millis, int64_t native_period_millis, u4 max_frames);
+  JfrThreadSampler(int64_t java_period_millis, int64_t native_period_millis, int64_t cpu_time_period_millis, u4 max_frames);
   ~JfrThreadSampler();
 
   void start_thread();
@@ -363,6 +434,7 @@ class JfrThreadSampler : public NonJavaThread {
   void disenroll();
   void set_java_period(int64_t period_millis);
   void set_native_period(int64_t period_millis);
+  void set_cpu_time_period(int64_t period_millis);
  protected:
   virtual void post_run();
  public:
@@ -374,6 +446,7 @@ class JfrThreadSampler : public NonJavaThread {
   static void on_javathread_suspend(JavaThread* thread);
   int64_t get_java_period() const { return Atomic::load(&_java_period_millis); };
   int64_t get_native_period() const { return Atomic::load(&_native_period_millis); };
+  int64_t get_cpu_time_period() const { return Atomic::load(&_cpu_time_period_millis); };
 };
 
 static void clear_transition_block(JavaThread* jt) {
@@ -404,32 +477,38 @@ bool JfrThreadSampleClosure::do_sample_thread(JavaThread* thread, JfrStackFrame*
   }
   if (JAVA_SAMPLE == type) {
     if (thread_state_in_java(thread)) {
-      ret = sample_thread_in_java(thread, frames, max_frames);
+      ret = sample_thread_in_java(thread, frames, max_frames, type);
     }
-  } else {
-    assert(NATIVE_SAMPLE == type, "invariant");
+  } else if (NATIVE_SAMPLE == type) {
     if (thread_state_in_native(thread)) {
-      ret = sample_thread_in_native(thread, frames, max_frames);
+      ret = sample_thread_in_native(thread, frames, max_frames, type);
     }
+  } else {
+    assert(CPU_TIME_SAMPLE == type, "invariant");
+    ret = sample_thread_cpu_time(thread, frames, max_frames);
   }
   clear_transition_block(thread);
   return ret;
 }
 
-JfrThreadSampler::JfrThreadSampler(int64_t java_period_millis, int64_t native_period_millis, u4 max_frames) :
+JfrThreadSampler::JfrThreadSampler(int64_t java_period_millis, int64_t native_period_millis,
+                                   int64_t cpu_time_period_millis, u4 max_frames) :
   _sample(),
   _sampler_thread(nullptr),
   _frames(JfrCHeapObj::new_array<JfrStackFrame>(max_frames)),
   _last_thread_java(nullptr),
   _last_thread_native(nullptr),
+  _last_thread_cpu_time(nullptr),
   _java_period_millis(java_period_millis),
   _native_period_millis(native_period_millis),
+  _cpu_time_period_millis(cpu_time_period_millis),
   _min_size(max_frames * 2 * wordSize), // each frame tags at most 2 words, min size is a full stacktrace
   _cur_index(-1),
   _max_frames(max_frames),
   _disenrolled(true) {
   assert(_java_period_millis >= 0, "invariant");
   assert(_native_period_millis >= 0, "invariant");
+  assert(_cpu_time_period_millis >= 0, "invariant");
 }
 
 JfrThreadSampler::~JfrThreadSampler() {
@@ -446,6 +525,11 @@ void JfrThreadSampler::set_native_period(int64_t period_millis) {
   Atomic::store(&_native_period_millis, period_millis);
 }
 
+void JfrThreadSampler::set_cpu_time_period(int64_t period_millis) {
+  assert(period_millis >= 0, "invariant");
+  Atomic::store(&_cpu_time_period_millis, period_millis);
+}
+
 static inline bool is_released(JavaThread* jt) {
   return !jt->is_trace_suspend();
 }
@@ -514,12 +598,14 @@ void JfrThreadSampler::run() {
 
   int64_t last_java_ms = get_monotonic_ms();
   int64_t last_native_ms = last_java_ms;
+  int64_t last_cpu_time_ms = last_java_ms;
   while (true) {
     if (!_sample.trywait()) {
       // disenrolled
       _sample.wait();
       last_java_ms = get_monotonic_ms();
       last_native_ms = last_java_ms;
+      last_cpu_time_ms = last_java_ms;
     }
     _sample.signal();
 
@@ -527,10 +613,12 @@ void JfrThreadSampler::run() {
     java_period_millis = java_period_millis == 0 ? max_jlong : MAX2<int64_t>(java_period_millis, 1);
     int64_t native_period_millis = get_native_period();
     native_period_millis = native_period_millis == 0 ? max_jlong : MAX2<int64_t>(native_period_millis, 1);
+    int64_t cpu_time_period_millis = get_cpu_time_period();
+    cpu_time_period_millis = cpu_time_period_millis == 0 ? max_jlong : MAX2<int64_t>(cpu_time_period_millis, 1);
 
-    // If both periods are max_jlong, it implies the sampler is in the process of
+    // If all periods are max_jlong, it implies the sampler is in the process of
     // disenrolling. Loop back for graceful disenroll by means of the semaphore.
-    if (java_period_millis == max_jlong && native_period_millis == max_jlong) {
+    if (java_period_millis == max_jlong && native_period_millis == max_jlong && cpu_time_period_millis == max_jlong) {
       continue;
     }
 
@@ -547,8 +635,9 @@ void JfrThreadSampler::run() {
      */
     const int64_t next_j = java_period_millis + (last_java_ms - now_ms);
     const int64_t next_n = native_period_millis + (last_native_ms - now_ms);
+    const int64_t next_c = cpu_time_period_millis + (last_cpu_time_ms - now_ms);
 
-    const int64_t sleep_to_next = MIN2<int64_t>(next_j, next_n);
+    const int64_t sleep_to_next = MIN3<int64_t>(next_j, next_n, next_c);
 
     if (sleep_to_next > 0) {
       os::naked_sleep(sleep_to_next);
@@ -562,6 +651,10 @@ void JfrThreadSampler::run() {
       task_stacktrace(NATIVE_SAMPLE, &_last_thread_native);
       last_native_ms = get_monotonic_ms();
     }
+    if ((next_c - sleep_to_next) <= 0) {
+      task_stacktrace(CPU_TIME_SAMPLE, &_last_thread_cpu_time);
+      last_cpu_time_ms = get_monotonic_ms();
+    }
   }
 }
 
@@ -584,9 +677,11 @@ void JfrThreadSampler::task_stacktrace(JfrSampleType type, JavaThread** last_thr
   ResourceMark rm;
   EventExecutionSample samples[MAX_NR_OF_JAVA_SAMPLES];
   EventNativeMethodSample samples_native[MAX_NR_OF_NATIVE_SAMPLES];
-  JfrThreadSampleClosure sample_task(samples, samples_native);
+  EventCPUTimeSample samples_cpu_time[MAX_NR_OF_CPU_TIME_SAMPLES];
+  JfrThreadSampleClosure sample_task(samples, samples_native, samples_cpu_time);
 
-  const uint sample_limit = JAVA_SAMPLE == type ? MAX_NR_OF_JAVA_SAMPLES : MAX_NR_OF_NATIVE_SAMPLES;
+  const uint sample_limit = JAVA_SAMPLE == type ? MAX_NR_OF_JAVA_SAMPLES :
+                            NATIVE_SAMPLE == type ? MAX_NR_OF_NATIVE_SAMPLES : MAX_NR_OF_CPU_TIME_SAMPLES;
   uint num_samples = 0;
   JavaThread* start = nullptr;
   {
@@ -620,6 +715,10 @@ void JfrThreadSampler::task_stacktrace(JfrSampleType type, JavaThread** last_thr
         if (current->is_Compiler_thread()) {
           continue;
         }
+        if (CPU_TIME_SAMPLE == type && !current->jfr_thread_local()->has_cpu_time_expirations()) {
+          // Did not consume a sampling period of CPU time since the last visit.
+          continue;
+        }
         assert(enqueue_buffer->free_size() >= _min_size, "invariant");
         if (sample_task.do_sample_thread(current, _frames, _max_frames, type)) {
           num_samples++;
@@ -629,8 +728,9 @@ void JfrThreadSampler::task_stacktrace(JfrSampleType type, JavaThread** last_thr
       *last_thread = current;  // remember the thread we last attempted to sample
     }
     sample_time.stop();
-    log_trace(jfr)("JFR thread sampling done in %3.7f secs with %d java %d native samples",
-                   sample_time.seconds(), sample_task.java_entries(), sample_task.native_entries());
+    log_trace(jfr)("JFR thread sampling done in %3.7f secs with %d java %d native %d cpu time samples",
+                   sample_time.seconds(), sample_task.java_entries(), sample_task.native_entries(),
+                   sample_task.cpu_time_entries());
   }
   if (num_samples > 0) {
     sample_task.commit_events(type);
@@ -659,65 +759,84 @@ void JfrThreadSampling::destroy() {
 JfrThreadSampling::JfrThreadSampling() : _sampler(nullptr) {}
 
 JfrThreadSampling::~JfrThreadSampling() {
+  JfrCPUTimer::stop();
   if (_sampler != nullptr) {
     _sampler->disenroll();
   }
 }
 
 #ifdef ASSERT
-void assert_periods(const JfrThreadSampler* sampler, int64_t java_period_millis, int64_t native_period_millis) {
+void assert_periods(const JfrThreadSampler* sampler, int64_t java_period_millis, int64_t native_period_millis,
+                    int64_t cpu_time_period_millis) {
   assert(sampler != nullptr, "invariant");
   assert(sampler->get_java_period() == java_period_millis, "invariant");
   assert(sampler->get_native_period() == native_period_millis, "invariant");
+  assert(sampler->get_cpu_time_period() == cpu_time_period_millis, "invariant");
 }
 #endif
 
-static void log(int64_t java_period_millis, int64_t native_period_millis) {
-  log_trace(jfr)("Updated thread sampler for java: " INT64_FORMAT "  ms, native " INT64_FORMAT " ms", java_period_millis, native_period_millis);
+static void log(int64_t java_period_millis, int64_t native_period_millis, int64_t cpu_time_period_millis) {
+  log_trace(jfr)("Updated thread sampler for java: " INT64_FORMAT "  ms, native " INT64_FORMAT " ms, cpu time " INT64_FORMAT " ms",
+                 java_period_millis, native_period_millis, cpu_time_period_millis);
 }
 
-void JfrThreadSampling::create_sampler(int64_t java_period_millis, int64_t native_period_millis) {
+void JfrThreadSampling::create_sampler(int64_t java_period_millis, int64_t native_period_millis, int64_t cpu_time_period_millis) {
   assert(_sampler == nullptr, "invariant");
-  log_trace(jfr)("Creating thread sampler for java:" INT64_FORMAT " ms, native " INT64_FORMAT " ms", java_period_millis, native_period_millis);
-  _sampler = new JfrThreadSampler(java_period_millis, native_period_millis, JfrOptionSet::stackdepth());
+  log_trace(jfr)("Creating thread sampler for java:" INT64_FORMAT " ms, native " INT64_FORMAT " ms, cpu time " INT64_FORMAT " ms",
+                 java_period_millis, native_period_millis, cpu_time_period_millis);
+  _sampler = new JfrThreadSampler(java_period_millis, native_period_millis, cpu_time_period_millis, JfrOptionSet::stackdepth());
   _sampler->start_thread();
   _sampler->enroll();
 }
 
-void JfrThreadSampling::update_run_state(int64_t java_period_millis, int64_t native_period_millis) {
-  if (java_period_millis > 0 || native_period_millis > 0) {
+void JfrThreadSampling::update_run_state(int64_t java_period_millis, int64_t native_period_millis, int64_t cpu_time_period_millis) {
+  if (java_period_millis > 0 || native_period_millis > 0 || cpu_time_period_millis > 0) {
     if (_sampler == nullptr) {
-      create_sampler(java_period_millis, native_period_millis);
+      create_sampler(java_period_millis, native_period_millis, cpu_time_period_millis);
     } else {
       _sampler->enroll();
     }
-    DEBUG_ONLY(assert_periods(_sampler, java_period_millis, native_period_millis);)
-    log(java_period_millis, native_period_millis);
+    DEBUG_ONLY(assert_periods(_sampler, java_period_millis, native_period_millis, cpu_time_period_millis);)
+    log(java_period_millis, native_period_millis, cpu_time_period_millis);
     return;
   }
   if (_sampler != nullptr) {
-    DEBUG_ONLY(assert_periods(_sampler, java_period_millis, native_period_millis);)
+    DEBUG_ONLY(assert_periods(_sampler, java_period_millis, native_period_millis, cpu_time_period_millis);)
     _sampler->disenroll();
   }
 }
 
-void JfrThreadSampling::set_sampling_period(bool is_java_period, int64_t period_millis) {
+void JfrThreadSampling::set_sampling_period(int sample_type, int64_t period_millis) {
   int64_t java_period_millis = 0;
   int64_t native_period_millis = 0;
-  if (is_java_period) {
-    java_period_millis = period_millis;
-    if (_sampler != nullptr) {
-      _sampler->set_java_period(java_period_millis);
-      native_period_millis = _sampler->get_native_period();
-    }
-  } else {
-    native_period_millis = period_millis;
-    if (_sampler != nullptr) {
-      _sampler->set_native_period(native_period_millis);
-      java_period_millis = _sampler->get_java_period();
-    }
+  int64_t cpu_time_period_millis = 0;
+  if (_sampler != nullptr) {
+    java_period_millis = _sampler->get_java_period();
+    native_period_millis = _sampler->get_native_period();
+    cpu_time_period_millis = _sampler->get_cpu_time_period();
+  }
+  switch (sample_type) {
+    case JAVA_SAMPLE:
+      java_period_millis = period_millis;
+      if (_sampler != nullptr) {
+        _sampler->set_java_period(java_period_millis);
+      }
+      break;
+    case NATIVE_SAMPLE:
+      native_period_millis = period_millis;
+      if (_sampler != nullptr) {
+        _sampler->set_native_period(native_period_millis);
+      }
+      break;
+    default:
+      assert(CPU_TIME_SAMPLE == sample_type, "invariant");
+      cpu_time_period_millis = period_millis;
+      if (_sampler != nullptr) {
+        _sampler->set_cpu_time_period(cpu_time_period_millis);
+      }
+      break;
   }
-  update_run_state(java_period_millis, native_period_millis);
+  update_run_state(java_period_millis, native_period_millis, cpu_time_period_millis);
 }
 
 void JfrThreadSampling::set_java_sample_period(int64_t period_millis) {
@@ -725,7 +844,7 @@ void JfrThreadSampling::set_java_sample_period(int64_t period_millis) {
   if (_instance == nullptr && 0 == period_millis) {
     return;
   }
-  instance().set_sampling_period(true, period_millis);
+  instance().set_sampling_period(JAVA_SAMPLE, period_millis);
 }
 
 void JfrThreadSampling::set_native_sample_period(int64_t period_millis) {
@@ -733,7 +852,30 @@ void JfrThreadSampling::set_native_sample_period(int64_t period_millis) {
   if (_instance == nullptr && 0 == period_millis) {
     return;
   }
-  instance().set_sampling_period(false, period_millis);
+  instance().set_sampling_period(NATIVE_SAMPLE, period_millis);
+}
+
+// The sampler visits the threads whose CPU timer expired once per period of wall-clock time.
+// A thread cannot consume more than one period of CPU time in that time, so the expirations
+// found for a thread rarely exceed one.
+void JfrThreadSampling::set_cpu_time_sample_period(int64_t period_nanos) {
+  assert(period_nanos >= 0, "invariant");
+  if (_instance == nullptr && 0 == period_nanos) {
+    return;
+  }
+  if (period_nanos > 0) {
+    if (!JfrCPUTimer::is_supported()) {
+      log_info(jfr)("CPU time sampling is not supported on this platform");
+      return;
+    }
+    if (!JfrCPUTimer::start(period_nanos)) {
+      return;
+    }
+  } else {
+    JfrCPUTimer::stop();
+  }
+  const int64_t period_millis = period_nanos == 0 ? 0 : MAX2<int64_t>(period_nanos / NANOSECS_PER_MILLISEC, 1);
+  instance().set_sampling_period(CPU_TIME_SAMPLE, period_millis);
 }
 
 void JfrThreadSampling::on_javathread_suspend(JavaThread* thread) {
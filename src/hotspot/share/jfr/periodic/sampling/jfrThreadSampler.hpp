@@ -34,9 +34,9 @@ class JfrThreadSampling : public JfrCHeapObj {
   friend class JfrRecorder;
  private:
   JfrThreadSampler* _sampler;
-  void create_sampler(int64_t java_period_millis, int64_t native_period_millis);
-  void update_run_state(int64_t java_period_millis, int64_t native_period_millis);
-  void set_sampling_period(bool is_java_period, int64_t period_millis);
+  void create_sampler(int64_t java_period_millis, int64_t native_period_millis, int64_t cpu_time_period_millis);
+  void update_run_state(int64_t java_period_millis, int64_t native_period_millis, int64_t cpu_time_period_millis);
+  void set_sampling_period(int sample_type, int64_t period_millis);
 
   JfrThreadSampling();
   ~JfrThreadSampling();
@@ -48,6 +48,7 @@ class JfrThreadSampling : public JfrCHeapObj {
  public:
   static void set_java_sample_period(int64_t period_millis);
   static void set_native_sample_period(int64_t period_millis);
+  static void set_cpu_time_sample_period(int64_t period_nanos);
   static void on_javathread_suspend(JavaThread* thread);
 };
 
@@ -35,43 +35,89 @@ constexpr static const JfrSamplerParams _disabled_params = {
                                                              false // reconfigure
                                                            };
 
-static JfrEventThrottler* _throttler = nullptr;
+// The events with throttle="true" in metadata.xml, followed by the events
+// whose samples are taken at a fixed rate.
+struct JfrThrottledEvent {
+  JfrEventId id;
+  const char* name;
+  bool fixed_rate;
+};
 
-JfrEventThrottler::JfrEventThrottler(JfrEventId event_id) :
+static const JfrThrottledEvent _throttled_events[] = {
+  { JfrObjectAllocationSampleEvent,       "jdk.ObjectAllocationSample",       false },
+  { JfrThreadParkEvent,                   "jdk.ThreadPark",                   false },
+  { JfrJavaMonitorEnterEvent,             "jdk.JavaMonitorEnter",             false },
+  { JfrDeoptimizationEvent,               "jdk.Deoptimization",               false },
+  { JfrObjectAllocationSummaryEvent,      "jdk.ObjectAllocationSummary",      true },
+  { JfrJavaMonitorContentionSummaryEvent, "jdk.JavaMonitorContentionSummary", true }
+};
+
+// Indexed by event id, nullptr for events without a throttler.
+static JfrEventThrottler* _throttlers[LAST_EVENT_ID + 1] = {};
+
+// The jdk.ObjectAllocationSummary and jdk.JavaMonitorContentionSummary events have no throttle
+// setting, their samples are taken at a fixed rate.
+constexpr static const int64_t summary_sample_size = 150;
+constexpr static const int64_t summary_period_ms = MILLIUNITS;
+
+// If the throttler is off, it accepts all events.
+constexpr static const int64_t event_throttler_off = -2;
+
+JfrEventThrottler::JfrEventThrottler(JfrEventId event_id, const char* event_name) :
   JfrAdaptiveSampler(),
   _last_params(),
   _sample_size(0),
   _period_ms(0),
   _sample_size_ewma(0),
   _event_id(event_id),
+  _event_name(event_name),
   _disabled(false),
   _update(false) {}
 
 bool JfrEventThrottler::create() {
-  assert(_throttler == nullptr, "invariant");
-  _throttler = new JfrEventThrottler(JfrObjectAllocationSampleEvent);
-  return _throttler != nullptr && _throttler->initialize();
+  for (size_t i = 0; i < ARRAY_SIZE(_throttled_events); ++i) {
+    const JfrThrottledEvent& event = _throttled_events[i];
+    assert(_throttlers[event.id] == nullptr, "invariant");
+    JfrEventThrottler* const throttler = new JfrEventThrottler(event.id, event.name);
+    if (throttler == nullptr || !throttler->initialize()) {
+      return false;
+    }
+    _throttlers[event.id] = throttler;
+    if (event.fixed_rate) {
+      throttler->configure(summary_sample_size, summary_period_ms);
+    } else if (event.id != JfrObjectAllocationSampleEvent) {
+      // Accept everything until a recording sets a throttle.
+      throttler->configure(event_throttler_off, MILLIUNITS);
+    }
+  }
+  return true;
 }
 
 void JfrEventThrottler::destroy() {
-  delete _throttler;
-  _throttler = nullptr;
+  for (size_t i = 0; i < ARRAY_SIZE(_throttled_events); ++i) {
+    const JfrEventId id = _throttled_events[i].id;
+    delete _throttlers[id];
+    _throttlers[id] = nullptr;
+  }
 }
 
-// There is currently only one throttler instance, for the jdk.ObjectAllocationSample event.
-// When introducing additional throttlers, also add a lookup map keyed by event id.
 JfrEventThrottler* JfrEventThrottler::for_event(JfrEventId event_id) {
-  assert(_throttler != nullptr, "JfrEventThrottler has not been properly initialized");
-  assert(event_id == JfrObjectAllocationSampleEvent, "Event type has an unconfigured throttler");
-  return event_id == JfrObjectAllocationSampleEvent ? _throttler : nullptr;
+  assert(event_id <= LAST_EVENT_ID, "invariant");
+  JfrEventThrottler* const throttler = _throttlers[event_id];
+  assert(throttler != nullptr, "Event type has an unconfigured throttler");
+  return throttler;
 }
 
 void JfrEventThrottler::configure(JfrEventId event_id, int64_t sample_size, int64_t period_ms) {
-  if (event_id != JfrObjectAllocationSampleEvent) {
+  if (event_id > LAST_EVENT_ID || _throttlers[event_id] == nullptr) {
     return;
   }
-  assert(_throttler != nullptr, "JfrEventThrottler has not been properly initialized");
-  _throttler->configure(sample_size, period_ms);
+  for (size_t i = 0; i < ARRAY_SIZE(_throttled_events); ++i) {
+    if (_throttled_events[i].id == event_id && _throttled_events[i].fixed_rate) {
+      return;
+    }
+  }
+  _throttlers[event_id]->configure(sample_size, period_ms);
 }
 
 /*
@@ -94,7 +140,7 @@ void JfrEventThrottler::configure(int64_t sample_size, int64_t period_ms) {
 bool JfrEventThrottler::accept(JfrEventId event_id, int64_t timestamp /* 0 */) {
   JfrEventThrottler* const throttler = for_event(event_id);
   if (throttler == nullptr) return true;
-  return _throttler->_disabled ? true : _throttler->sample(timestamp);
+  return throttler->_disabled ? true : throttler->sample(timestamp);
 }
 
 /*
@@ -136,9 +182,6 @@ inline void set_low_rate(JfrSamplerParams& params, int64_t event_sample_size, in
   params.window_duration_ms = period_ms;
 }
 
-// If the throttler is off, it accepts all events.
-constexpr static const int64_t event_throttler_off = -2;
-
 /*
  * Set the number of sample points and window duration.
  */
@@ -241,15 +284,13 @@ inline double compute_ewma_alpha_coefficient(size_t lookback_count) {
  * Monitoring the relation of average sample size to the window set point, i.e the target,
  * is a good indicator of how the throttler is performing over time.
  *
- * Note: there is currently only one throttler instance, for the ObjectAllocationSample event.
- * When introducing additional throttlers, also provide a map from the event id to the event name.
  */
-static void log(const JfrSamplerWindow* expired, double* sample_size_ewma) {
+static void log(const char* event_name, const JfrSamplerWindow* expired, double* sample_size_ewma) {
   assert(sample_size_ewma != nullptr, "invariant");
   if (log_is_enabled(Debug, jfr, system, throttle)) {
     *sample_size_ewma = exponentially_weighted_moving_average(expired->sample_size(), compute_ewma_alpha_coefficient(expired->params().window_lookback_count), *sample_size_ewma);
-    log_debug(jfr, system, throttle)("jdk.ObjectAllocationSample: avg.sample size: %0.4f, window set point: %zu, sample size: %zu, population size: %zu, ratio: %.4f, window duration: %zu ms\n",
-      *sample_size_ewma, expired->params().sample_points_per_window, expired->sample_size(), expired->population_size(),
+    log_debug(jfr, system, throttle)("%s: avg.sample size: %0.4f, window set point: %zu, sample size: %zu, population size: %zu, ratio: %.4f, window duration: %zu ms\n",
+      event_name, *sample_size_ewma, expired->params().sample_points_per_window, expired->sample_size(), expired->population_size(),
       expired->population_size() == 0 ? 0 : (double)expired->sample_size() / (double)expired->population_size(),
       expired->params().window_duration_ms);
   }
@@ -268,7 +309,7 @@ static void log(const JfrSamplerWindow* expired, double* sample_size_ewma) {
 const JfrSamplerParams& JfrEventThrottler::next_window_params(const JfrSamplerWindow* expired) {
   assert(expired != nullptr, "invariant");
   assert(_lock, "invariant");
-  log(expired, &_sample_size_ewma);
+  log(_event_name, expired, &_sample_size_ewma);
   if (_update) {
     return update_params(expired); // Updates _last_params in-place.
   }
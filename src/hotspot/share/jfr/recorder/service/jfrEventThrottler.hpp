@@ -37,12 +37,13 @@ class JfrEventThrottler : public JfrAdaptiveSampler {
   int64_t _period_ms;
   double _sample_size_ewma;
   JfrEventId _event_id;
+  const char* _event_name;
   bool _disabled;
   bool _update;
 
   static bool create();
   static void destroy();
-  JfrEventThrottler(JfrEventId event_id);
+  JfrEventThrottler(JfrEventId event_id, const char* event_name);
   void configure(int64_t event_sample_size, int64_t period_ms);
 
   const JfrSamplerParams& update_params(const JfrSamplerWindow* expired);
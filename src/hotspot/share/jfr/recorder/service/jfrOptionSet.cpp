@@ -104,6 +104,14 @@ void JfrOptionSet::set_old_object_queue_size(jlong value) {
   _old_object_queue_size = value;
 }
 
+jlong JfrOptionSet::cpu_sample_period() {
+  return _cpu_sample_period;
+}
+
+void JfrOptionSet::set_cpu_sample_period(jlong value) {
+  _cpu_sample_period = value;
+}
+
 u4 JfrOptionSet::stackdepth() {
   return _stack_depth;
 }
@@ -165,6 +173,7 @@ const char* const default_sample_threads = "true";
 const char* const default_stack_depth = "64";
 const char* const default_retransform = "true";
 const char* const default_old_object_queue_size = "256";
+const char* const default_cpu_sample_period = "20ms";
 const char* const default_preserve_repository = "false";
 DEBUG_ONLY(const char* const default_sample_protection = "false";)
 
@@ -225,6 +234,13 @@ static DCmdArgument<jlong> _dcmd_old_object_queue_size (
   false,
   default_old_object_queue_size);
 
+static DCmdArgument<NanoTimeArgument> _dcmd_cpu_sample_period(
+  "cpu-sample-period",
+  "CPU time consumed by a thread between two jdk.CPUTimeSample events",
+  "NANOTIME",
+  false,
+  default_cpu_sample_period);
+
 static DCmdArgument<bool> _dcmd_sample_threads(
   "samplethreads",
   "Thread sampling enable / disable (only sampling when event enabled and sampling enabled)",
@@ -276,6 +292,7 @@ static void register_parser_options() {
   _parser.add_dcmd_option(&_dcmd_sample_threads);
   _parser.add_dcmd_option(&_dcmd_retransform);
   _parser.add_dcmd_option(&_dcmd_old_object_queue_size);
+  _parser.add_dcmd_option(&_dcmd_cpu_sample_period);
   _parser.add_dcmd_option(&_dcmd_preserve_repository);
   DEBUG_ONLY(_parser.add_dcmd_option(&_dcmd_sample_protection);)
 }
@@ -315,6 +332,7 @@ jlong JfrOptionSet::_thread_buffer_size = 0;
 jlong JfrOptionSet::_memory_size = 0;
 jlong JfrOptionSet::_num_global_buffers = 0;
 jlong JfrOptionSet::_old_object_queue_size = 0;
+jlong JfrOptionSet::_cpu_sample_period = 0;
 u4 JfrOptionSet::_stack_depth = STACK_DEPTH_DEFAULT;
 jboolean JfrOptionSet::_retransform = JNI_TRUE;
 #ifdef ASSERT
@@ -332,6 +350,7 @@ bool JfrOptionSet::initialize(JavaThread* thread) {
     set_retransform(_dcmd_retransform.value());
   }
   set_old_object_queue_size(_dcmd_old_object_queue_size.value());
+  set_cpu_sample_period(_dcmd_cpu_sample_period.value()._nanotime);
   return adjust_memory_options();
 }
 
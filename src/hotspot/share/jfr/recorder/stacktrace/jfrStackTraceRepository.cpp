@@ -28,13 +28,20 @@
 #include "jfr/recorder/repository/jfrChunkWriter.hpp"
 #include "jfr/recorder/stacktrace/jfrStackTraceRepository.hpp"
 #include "jfr/support/jfrThreadLocal.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "utilities/globalCounter.inline.hpp"
 
 /*
  * There are two separate repository instances.
  * One instance is dedicated to stacktraces taken as part of the leak profiler subsystem.
  * It is kept separate because at the point of insertion, it is unclear if a trace will be serialized,
  * which is a decision postponed and taken during rotation.
+ *
+ * Insertions are lock-free: a new trace is pushed onto the head of its bucket with a CAS, so threads
+ * only contend when they insert into the same bucket at the same time. Lookups walk the buckets
+ * inside a GlobalCounter critical section. Writers and clearers serialize on JfrStacktrace_lock,
+ * detach the buckets they drop and synchronize with the GlobalCounter before deleting the traces.
  */
 
 static JfrStackTraceRepository* _instance = nullptr;
@@ -52,7 +59,7 @@ static JfrStackTraceRepository& leak_profiler_instance() {
 }
 
 JfrStackTraceRepository::JfrStackTraceRepository() : _last_entries(0), _entries(0) {
-  memset(_table, 0, sizeof(_table));
+  memset((void*)_table, 0, sizeof(_table));
 }
 
 JfrStackTraceRepository* JfrStackTraceRepository::create() {
@@ -94,54 +101,92 @@ void JfrStackTraceRepository::destroy() {
 }
 
 bool JfrStackTraceRepository::is_modified() const {
-  return _last_entries != _entries;
+  return _last_entries != Atomic::load(&_entries);
+}
+
+// Detaches all buckets, returning the heads in the detached array. On return,
+// no concurrent add_trace can still find, insert into or count the detached
+// traces, all of them were pushed and counted before the synchronization.
+void JfrStackTraceRepository::detach(JfrStackTrace** detached) {
+  assert_lock_strong(JfrStacktrace_lock);
+  for (u4 i = 0; i < TABLE_SIZE; ++i) {
+    detached[i] = Atomic::xchg(&_table[i], (JfrStackTrace*)nullptr);
+  }
+  GlobalCounter::write_synchronize();
+}
+
+// Deletes the detached buckets.
+size_t JfrStackTraceRepository::release(JfrStackTrace** detached) {
+  assert_lock_strong(JfrStacktrace_lock);
+  u4 count = 0;
+  for (u4 i = 0; i < TABLE_SIZE; ++i) {
+    JfrStackTrace* stacktrace = detached[i];
+    while (stacktrace != nullptr) {
+      JfrStackTrace* next = const_cast<JfrStackTrace*>(stacktrace->next());
+      delete stacktrace;
+      ++count;
+      stacktrace = next;
+    }
+  }
+  // Every detached trace was counted before detach returned, but clamp at
+  // zero rather than wrap around if that was ever not the case.
+  u4 entries = Atomic::load(&_entries);
+  while (true) {
+    assert(entries >= count, "released more traces than were counted");
+    const u4 witness = Atomic::cmpxchg(&_entries, entries, entries >= count ? entries - count : 0);
+    if (witness == entries) {
+      break;
+    }
+    entries = witness;
+  }
+  return count;
 }
 
 size_t JfrStackTraceRepository::write(JfrChunkWriter& sw, bool clear) {
-  if (_entries == 0) {
+  if (Atomic::load(&_entries) == 0) {
     return 0;
   }
   MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
-  assert(_entries > 0, "invariant");
+  // Snapshot the count before walking the buckets. A trace inserted into an
+  // already visited bucket is then still seen as a modification. Entries
+  // are counted after they are published, so the snapshot never covers a
+  // trace that the walk cannot see.
+  const u4 entries = Atomic::load(&_entries);
+  JfrStackTrace** detached = nullptr;
+  if (clear) {
+    detached = NEW_C_HEAP_ARRAY(JfrStackTrace*, TABLE_SIZE, mtTracing);
+    detach(detached);
+  }
   int count = 0;
   for (u4 i = 0; i < TABLE_SIZE; ++i) {
-    JfrStackTrace* stacktrace = _table[i];
+    const JfrStackTrace* stacktrace = clear ? detached[i] : Atomic::load_acquire(&_table[i]);
     while (stacktrace != nullptr) {
-      JfrStackTrace* next = const_cast<JfrStackTrace*>(stacktrace->next());
       if (stacktrace->should_write()) {
         stacktrace->write(sw);
         ++count;
       }
-      if (clear) {
-        delete stacktrace;
-      }
-      stacktrace = next;
+      stacktrace = stacktrace->next();
     }
   }
   if (clear) {
-    memset(_table, 0, sizeof(_table));
-    _entries = 0;
+    release(detached);
+    FREE_C_HEAP_ARRAY(JfrStackTrace*, detached);
   }
-  _last_entries = _entries;
+  // Whatever is left after clearing was inserted after the detach and has
+  // not been written.
+  _last_entries = clear ? 0 : entries;
   return count;
 }
 
 size_t JfrStackTraceRepository::clear(JfrStackTraceRepository& repo) {
   MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
-  if (repo._entries == 0) {
+  if (Atomic::load(&repo._entries) == 0) {
     return 0;
   }
-  for (u4 i = 0; i < TABLE_SIZE; ++i) {
-    JfrStackTrace* stacktrace = repo._table[i];
-    while (stacktrace != nullptr) {
-      JfrStackTrace* next = const_cast<JfrStackTrace*>(stacktrace->next());
-      delete stacktrace;
-      stacktrace = next;
-    }
-  }
-  memset(repo._table, 0, sizeof(repo._table));
-  const size_t processed = repo._entries;
-  repo._entries = 0;
+  JfrStackTrace** const detached = NEW_C_HEAP_ARRAY(JfrStackTrace*, TABLE_SIZE, mtTracing);
+  repo.detach(detached);
+  const size_t processed = repo.release(detached);
+  FREE_C_HEAP_ARRAY(JfrStackTrace*, detached);
   repo._last_entries = 0;
   return processed;
 }
@@ -198,33 +243,57 @@ void JfrStackTraceRepository::record_for_leak_profiler(JavaThread* current_threa
   }
 }
 
+// Searches the bucket chain from head up to, but not including, end. The
+// chain does not reach end if the bucket was detached by a concurrent clear
+// in the meantime, the search then stops at the end of the chain.
+const JfrStackTrace* JfrStackTraceRepository::find(const JfrStackTrace* head, const JfrStackTrace* end,
+                                                   const JfrStackTrace& stacktrace) {
+  for (const JfrStackTrace* entry = head; entry != end && entry != nullptr; entry = entry->next()) {
+    if (entry->equals(stacktrace)) {
+      return entry;
+    }
+  }
+  return nullptr;
+}
+
 traceid JfrStackTraceRepository::add_trace(const JfrStackTrace& stacktrace) {
-  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
   assert(stacktrace._nr_of_frames > 0, "invariant");
+  GlobalCounter::CriticalSection cs(Thread::current());
   const size_t index = stacktrace._hash % TABLE_SIZE;
-  const JfrStackTrace* table_entry = _table[index];
+  JfrStackTrace* head = Atomic::load_acquire(&_table[index]);
 
-  while (table_entry != nullptr) {
-    if (table_entry->equals(stacktrace)) {
-      return table_entry->id();
-    }
-    table_entry = table_entry->next();
+  const JfrStackTrace* const existing = find(head, nullptr, stacktrace);
+  if (existing != nullptr) {
+    return existing->id();
   }
 
   if (!stacktrace.have_lineno()) {
     return 0;
   }
 
-  traceid id = ++_next_id;
-  _table[index] = new JfrStackTrace(id, stacktrace, _table[index]);
-  ++_entries;
-  return id;
+  const traceid id = Atomic::add(&_next_id, (traceid)1);
+  JfrStackTrace* const entry = new JfrStackTrace(id, stacktrace, head);
+  while (true) {
+    JfrStackTrace* const witness = Atomic::cmpxchg(&_table[index], head, entry);
+    if (witness == head) {
+      Atomic::inc(&_entries);
+      return id;
+    }
+    // Other traces were pushed onto the bucket, one of them could be the same trace.
+    const JfrStackTrace* const inserted = find(witness, head, stacktrace);
+    if (inserted != nullptr) {
+      delete entry;
+      return inserted->id();
+    }
+    head = witness;
+    entry->_next = head;
+  }
 }
 
 // invariant is that the entry to be resolved actually exists in the table
 const JfrStackTrace* JfrStackTraceRepository::lookup_for_leak_profiler(unsigned int hash, traceid id) {
   const size_t index = (hash % TABLE_SIZE);
-  const JfrStackTrace* trace = leak_profiler_instance()._table[index];
+  const JfrStackTrace* trace = Atomic::load_acquire(&leak_profiler_instance()._table[index]);
   while (trace != nullptr && trace->id() != id) {
     trace = trace->next();
   }
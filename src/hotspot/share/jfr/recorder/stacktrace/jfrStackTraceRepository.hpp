@@ -45,9 +45,9 @@ class JfrStackTraceRepository : public JfrCHeapObj {
 
  private:
   static const u4 TABLE_SIZE = 2053;
-  JfrStackTrace* _table[TABLE_SIZE];
+  JfrStackTrace* volatile _table[TABLE_SIZE];
   u4 _last_entries;
-  u4 _entries;
+  volatile u4 _entries;
 
   JfrStackTraceRepository();
   static JfrStackTraceRepository& instance();
@@ -59,11 +59,14 @@ class JfrStackTraceRepository : public JfrCHeapObj {
   static size_t clear();
   static size_t clear(JfrStackTraceRepository& repo);
   size_t write(JfrChunkWriter& cw, bool clear);
+  void detach(JfrStackTrace** detached);
+  size_t release(JfrStackTrace** detached);
 
   static const JfrStackTrace* lookup_for_leak_profiler(unsigned int hash, traceid id);
   static void record_for_leak_profiler(JavaThread* thread, int skip = 0);
   static void clear_leak_profiler();
 
+  static const JfrStackTrace* find(const JfrStackTrace* head, const JfrStackTrace* end, const JfrStackTrace& stacktrace);
   traceid add_trace(const JfrStackTrace& stacktrace);
   static traceid add(JfrStackTraceRepository& repo, const JfrStackTrace& stacktrace);
   static traceid add(const JfrStackTrace& stacktrace);
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "jfr/jfrEvents.hpp"
+#include "jfr/recorder/checkpoint/types/traceid/jfrTraceId.inline.hpp"
+#include "jfr/recorder/checkpoint/types/traceid/jfrTraceIdEpoch.hpp"
+#include "jfr/recorder/service/jfrEventThrottler.hpp"
+#include "jfr/recorder/stacktrace/jfrStackTraceRepository.hpp"
+#include "jfr/support/jfrMonitorContentionSummary.hpp"
+#include "jfr/support/jfrSummaryTable.inline.hpp"
+#include "runtime/javaThread.hpp"
+
+static JfrSummaryTable<1024> _summary;
+
+JfrMonitorContentionSample::JfrMonitorContentionSample(const Klass* klass, JavaThread* jt) :
+  _jt(jt), _klass(klass), _klass_id(0), _stack_trace_id(0), _start(), _generation(0) {
+  assert(klass != nullptr, "invariant");
+  assert(jt != nullptr, "invariant");
+  if (!EventJavaMonitorContentionSummary::is_enabled() || !JfrEventThrottler::accept(JfrJavaMonitorContentionSummaryEvent)) {
+    return;
+  }
+  // Read the generation first. A rotation after this point only makes the entry stale.
+  _generation = JfrTraceIdEpoch::epoch_generation();
+  // Tagging the klass in this epoch makes it part of the unloaded klass set if it is
+  // unloaded before the entry is sent.
+  _klass_id = JfrTraceId::load(klass);
+  _stack_trace_id = JfrStackTraceRepository::record(jt);
+  _start = Ticks::now();
+}
+
+JfrMonitorContentionSample::~JfrMonitorContentionSample() {
+  if (_stack_trace_id == 0) {
+    return;
+  }
+  const int64_t blocked_nanos = static_cast<int64_t>((Ticks::now() - _start).nanoseconds());
+  JfrMonitorContentionSummary::add(_klass, _klass_id, _stack_trace_id, _generation, blocked_nanos, _jt);
+}
+
+void JfrMonitorContentionSummary::add(const Klass* klass, traceid klass_id, traceid stack_trace_id, u2 generation,
+                                      int64_t blocked_nanos, JavaThread* jt) {
+  _summary.add(klass, klass_id, stack_trace_id, generation, blocked_nanos, jt);
+}
+
+class SendMonitorContentionSummary : public StackObj {
+ public:
+  void operator()(const JfrSummaryEntry* entry, int64_t samples, int64_t blocked_nanos) {
+    EventJavaMonitorContentionSummary event;
+    event.set_monitorClass(entry->_klass);
+    event.set_stackTrace(entry->_stack_trace_id);
+    event.set_samples(samples);
+    event.set_blockedTime(blocked_nanos);
+    event.commit();
+  }
+};
+
+void JfrMonitorContentionSummary::send_events() {
+  SendMonitorContentionSummary send;
+  _summary.drain(send, "Monitor contention summary");
+}
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_JFR_SUPPORT_JFRMONITORCONTENTIONSUMMARY_HPP
+#define SHARE_JFR_SUPPORT_JFRMONITORCONTENTIONSUMMARY_HPP
+
+#include "jfr/utilities/jfrTypes.hpp"
+#include "memory/allocation.hpp"
+#include "utilities/ticks.hpp"
+
+class JavaThread;
+class Klass;
+
+//
+// Aggregates samples of contended monitor enters by (monitor klass, stack trace) in a
+// fixed size, lock-free table.
+//
+// The periodic jdk.JavaMonitorContentionSummary event drains the table, sending one
+// event per entry that was contended since the previous event, with the number of
+// samples and the time the sampled threads were blocked.
+//
+class JfrMonitorContentionSummary : AllStatic {
+  friend class JfrMonitorContentionSample;
+ private:
+  static void add(const Klass* klass, traceid klass_id, traceid stack_trace_id, u2 generation,
+                  int64_t blocked_nanos, JavaThread* jt);
+ public:
+  static void send_events();
+};
+
+//
+// Scoped around a contended enter. If the enter is sampled, the stack trace is taken
+// before the thread blocks, so the owner is not delayed by it, and the blocked time is
+// added to the summary when the scope ends.
+//
+class JfrMonitorContentionSample : public StackObj {
+ private:
+  JavaThread* const _jt;
+  const Klass* const _klass;
+  traceid _klass_id;
+  traceid _stack_trace_id;
+  Ticks _start;
+  u2 _generation;
+ public:
+  JfrMonitorContentionSample(const Klass* klass, JavaThread* jt);
+  ~JfrMonitorContentionSample();
+};
+
+#endif // SHARE_JFR_SUPPORT_JFRMONITORCONTENTIONSUMMARY_HPP
@@ -26,7 +26,9 @@
 #include "gc/shared/threadLocalAllocBuffer.inline.hpp"
 #include "gc/shared/tlab_globals.hpp"
 #include "jfr/jfrEvents.hpp"
+#include "jfr/recorder/service/jfrEventThrottler.hpp"
 #include "jfr/support/jfrObjectAllocationSample.hpp"
+#include "jfr/support/jfrObjectAllocationSummary.hpp"
 #include "jfr/support/jfrThreadLocal.hpp"
 #include "utilities/globalDefinitions.hpp"
 
@@ -78,10 +80,32 @@ static void normalize_as_tlab_and_send_allocation_samples(const Klass* klass, in
   } while (obj_alloc_size_bytes > 0);
 }
 
+// Samples for the allocation summary are taken at the same points and weighted the same way,
+// but with their own throttler and allocated bytes watermark.
+static void add_summary_sample(const Klass* klass, int64_t obj_alloc_size_bytes, bool outside_tlab, JfrThreadLocal* tl, Thread* thread) {
+  const int64_t allocated_bytes = thread->allocated_bytes();
+  const int64_t weight = allocated_bytes - tl->last_summary_allocated_bytes();
+  if (weight <= 0) {
+    return;
+  }
+  const int64_t tlab_size_bytes = outside_tlab && UseTLAB ? estimate_tlab_size_bytes(thread) : obj_alloc_size_bytes;
+  do {
+    if (JfrEventThrottler::accept(JfrObjectAllocationSummaryEvent)) {
+      JfrObjectAllocationSummary::add(klass, weight, thread);
+      tl->set_last_summary_allocated_bytes(allocated_bytes);
+      return;
+    }
+    obj_alloc_size_bytes -= tlab_size_bytes;
+  } while (obj_alloc_size_bytes > 0);
+}
+
 void JfrObjectAllocationSample::send_event(const Klass* klass, size_t alloc_size, bool outside_tlab, Thread* thread) {
   assert(thread != nullptr, "invariant");
   JfrThreadLocal* const tl = thread->jfr_thread_local();
   assert(tl != nullptr, "invariant");
+  if (EventObjectAllocationSummary::is_enabled()) {
+    add_summary_sample(klass, static_cast<int64_t>(alloc_size), outside_tlab, tl, thread);
+  }
   if (outside_tlab) {
     normalize_as_tlab_and_send_allocation_samples(klass, static_cast<int64_t>(alloc_size), tl, thread);
     return;
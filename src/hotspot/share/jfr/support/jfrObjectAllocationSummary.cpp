@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "jfr/jfrEvents.hpp"
+#include "jfr/recorder/checkpoint/types/traceid/jfrTraceId.inline.hpp"
+#include "jfr/recorder/checkpoint/types/traceid/jfrTraceIdEpoch.hpp"
+#include "jfr/recorder/stacktrace/jfrStackTraceRepository.hpp"
+#include "jfr/support/jfrObjectAllocationSummary.hpp"
+#include "jfr/support/jfrSummaryTable.inline.hpp"
+
+static JfrSummaryTable<4096> _summary;
+
+void JfrObjectAllocationSummary::add(const Klass* klass, int64_t weight, Thread* thread) {
+  assert(klass != nullptr, "invariant");
+  assert(weight > 0, "invariant");
+  if (!_summary.is_available()) {
+    return;
+  }
+  // Read the generation first. A rotation after this point only makes the entry stale.
+  const u2 generation = JfrTraceIdEpoch::epoch_generation();
+  // Tagging the klass in this epoch makes it part of the unloaded klass set if it is
+  // unloaded before the entry is sent.
+  const traceid klass_id = JfrTraceId::load(klass);
+  const traceid stack_trace_id = JfrStackTraceRepository::record(thread);
+  if (stack_trace_id == 0) {
+    return;
+  }
+  _summary.add(klass, klass_id, stack_trace_id, generation, weight, thread);
+}
+
+class SendObjectAllocationSummary : public StackObj {
+ public:
+  void operator()(const JfrSummaryEntry* entry, int64_t samples, int64_t weight) {
+    EventObjectAllocationSummary event;
+    event.set_objectClass(entry->_klass);
+    event.set_stackTrace(entry->_stack_trace_id);
+    event.set_weight(weight);
+    event.set_samples(samples);
+    event.commit();
+  }
+};
+
+void JfrObjectAllocationSummary::send_events() {
+  SendObjectAllocationSummary send;
+  _summary.drain(send, "Object allocation summary");
+}
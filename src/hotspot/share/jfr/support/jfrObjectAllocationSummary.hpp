@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_JFR_SUPPORT_JFROBJECTALLOCATIONSUMMARY_HPP
+#define SHARE_JFR_SUPPORT_JFROBJECTALLOCATIONSUMMARY_HPP
+
+#include "memory/allStatic.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class Klass;
+class Thread;
+
+//
+// Aggregates allocation samples by (klass, stack trace) in a fixed size, lock-free table.
+//
+// Allocating threads add the weight of a sample to the counters of its entry. The
+// periodic jdk.ObjectAllocationSummary event drains the counters, sending one event
+// per entry that was allocated from since the previous event. The number of events
+// thus depends on the number of allocation sites, not on the allocation rate.
+//
+class JfrObjectAllocationSummary : AllStatic {
+ public:
+  static void add(const Klass* klass, int64_t weight, Thread* thread);
+  static void send_events();
+};
+
+#endif // SHARE_JFR_SUPPORT_JFROBJECTALLOCATIONSUMMARY_HPP
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_JFR_SUPPORT_JFRSUMMARYTABLE_HPP
+#define SHARE_JFR_SUPPORT_JFRSUMMARYTABLE_HPP
+
+#include "jfr/utilities/jfrTypes.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/powerOfTwo.hpp"
+
+class Klass;
+class Thread;
+
+struct JfrSummaryEntry {
+  volatile u4 _state;
+  u2 _generation;
+  const Klass* _klass;
+  traceid _klass_id;
+  traceid _stack_trace_id;
+  volatile int64_t _samples;
+  volatile int64_t _value;   // summed over the samples, for example a weight or a time
+};
+
+//
+// A fixed size, lock-free table aggregating samples by (klass, stack trace), drained by
+// a periodic event that sends one event per entry sampled since the previous event.
+//
+// Entries are claimed with a CAS on their state and are never moved. Sampling threads
+// look up and update entries inside a GlobalCounter critical section. Draining reclaims
+// the entries that were idle since the previous event, that are from an earlier epoch
+// generation, or whose klass has been unloaded. Reclaimed entries are only made available
+// again after synchronizing with the GlobalCounter.
+//
+// The generation is part of the key because stack trace ids are only valid until the
+// stack trace repository is cleared at the next chunk rotation.
+//
+template <u4 TABLE_SIZE>
+class JfrSummaryTable {
+  STATIC_ASSERT(is_power_of_2(TABLE_SIZE));
+ private:
+  static const u4 MAX_PROBES = 32;
+
+  JfrSummaryEntry* volatile _table;
+  volatile size_t _lost_samples;
+
+  JfrSummaryEntry* table();
+
+ public:
+  constexpr JfrSummaryTable() : _table(nullptr), _lost_samples(0) {}
+
+  // Returns false if the table could not be allocated.
+  bool is_available() { return table() != nullptr; }
+
+  void add(const Klass* klass, traceid klass_id, traceid stack_trace_id, u2 generation,
+           int64_t value, Thread* thread);
+
+  // Calls send(entry, samples, value) for every entry sampled since the previous drain,
+  // and logs the outcome under name.
+  template <typename Send>
+  void drain(Send& send, const char* name);
+};
+
+#endif // SHARE_JFR_SUPPORT_JFRSUMMARYTABLE_HPP
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_JFR_SUPPORT_JFRSUMMARYTABLE_INLINE_HPP
+#define SHARE_JFR_SUPPORT_JFRSUMMARYTABLE_INLINE_HPP
+
+#include "jfr/support/jfrSummaryTable.hpp"
+
+#include "jfr/recorder/checkpoint/types/traceid/jfrTraceIdEpoch.hpp"
+#include "jfr/support/jfrKlassUnloading.hpp"
+#include "logging/log.hpp"
+#include "memory/allocation.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
+#include "utilities/globalCounter.inline.hpp"
+
+enum JfrSummaryEntryState {
+  JFR_SUMMARY_EMPTY,
+  JFR_SUMMARY_CLAIMED,    // keys are being written by the claiming thread
+  JFR_SUMMARY_IN_USE,
+  JFR_SUMMARY_RECLAIMING  // waiting for concurrent readers before becoming empty
+};
+
+template <u4 TABLE_SIZE>
+inline JfrSummaryEntry* JfrSummaryTable<TABLE_SIZE>::table() {
+  JfrSummaryEntry* table = Atomic::load_acquire(&_table);
+  if (table != nullptr) {
+    return table;
+  }
+  JfrSummaryEntry* const new_table = NEW_C_HEAP_ARRAY_RETURN_NULL(JfrSummaryEntry, TABLE_SIZE, mtTracing);
+  if (new_table == nullptr) {
+    return nullptr;
+  }
+  memset(new_table, 0, sizeof(JfrSummaryEntry) * TABLE_SIZE);
+  table = Atomic::cmpxchg(&_table, (JfrSummaryEntry*)nullptr, new_table);
+  if (table != nullptr) {
+    // Another thread installed its table first.
+    FREE_C_HEAP_ARRAY(JfrSummaryEntry, new_table);
+    return table;
+  }
+  return new_table;
+}
+
+static inline u4 jfr_summary_hash(traceid klass_id, traceid stack_trace_id) {
+  const uint64_t key = (klass_id * 0x9E3779B97F4A7C15ULL) ^ stack_trace_id;
+  return static_cast<u4>(key ^ (key >> 32));
+}
+
+static inline bool jfr_summary_matches(const JfrSummaryEntry* entry, u2 generation, const Klass* klass, traceid stack_trace_id) {
+  return entry->_generation == generation && entry->_klass == klass && entry->_stack_trace_id == stack_trace_id;
+}
+
+template <u4 TABLE_SIZE>
+inline void JfrSummaryTable<TABLE_SIZE>::add(const Klass* klass, traceid klass_id, traceid stack_trace_id, u2 generation,
+                                             int64_t value, Thread* thread) {
+  assert(klass != nullptr, "invariant");
+  assert(stack_trace_id != 0, "invariant");
+  JfrSummaryEntry* const entries = table();
+  if (entries == nullptr) {
+    return;
+  }
+  const u4 hash = jfr_summary_hash(klass_id, stack_trace_id);
+
+  GlobalCounter::CriticalSection cs(thread);
+  for (u4 i = 0; i < MAX_PROBES; ++i) {
+    JfrSummaryEntry* const entry = &entries[(hash + i) & (TABLE_SIZE - 1)];
+    u4 state = Atomic::load_acquire(&entry->_state);
+    if (state == JFR_SUMMARY_EMPTY) {
+      state = Atomic::cmpxchg(&entry->_state, (u4)JFR_SUMMARY_EMPTY, (u4)JFR_SUMMARY_CLAIMED);
+      if (state == JFR_SUMMARY_EMPTY) {
+        entry->_generation = generation;
+        entry->_klass = klass;
+        entry->_klass_id = klass_id;
+        entry->_stack_trace_id = stack_trace_id;
+        Atomic::store(&entry->_samples, (int64_t)1);
+        Atomic::store(&entry->_value, value);
+        Atomic::release_store(&entry->_state, (u4)JFR_SUMMARY_IN_USE);
+        return;
+      }
+    }
+    // The claiming thread only writes the keys, it does not block.
+    while (state == JFR_SUMMARY_CLAIMED) {
+      SpinPause();
+      state = Atomic::load_acquire(&entry->_state);
+    }
+    if (state == JFR_SUMMARY_IN_USE && jfr_summary_matches(entry, generation, klass, stack_trace_id)) {
+      Atomic::inc(&entry->_samples);
+      Atomic::add(&entry->_value, value);
+      return;
+    }
+  }
+  Atomic::inc(&_lost_samples);
+}
+
+template <u4 TABLE_SIZE>
+template <typename Send>
+inline void JfrSummaryTable<TABLE_SIZE>::drain(Send& send, const char* name) {
+  JfrSummaryEntry* const entries = Atomic::load_acquire(&_table);
+  if (entries == nullptr) {
+    return;
+  }
+  const u2 generation = JfrTraceIdEpoch::epoch_generation();
+  u4 sent = 0;
+  u4 reclaimed = 0;
+  {
+    // The lock is needed to ensure the unload lists do not grow in the middle of inspection.
+    MutexLocker lock(ClassLoaderDataGraph_lock);
+    JfrKlassUnloading::sort();
+    for (u4 i = 0; i < TABLE_SIZE; ++i) {
+      JfrSummaryEntry* const entry = &entries[i];
+      if (Atomic::load_acquire(&entry->_state) != JFR_SUMMARY_IN_USE) {
+        continue;
+      }
+      const int64_t samples = Atomic::xchg(&entry->_samples, (int64_t)0);
+      const int64_t value = Atomic::xchg(&entry->_value, (int64_t)0);
+      if (samples == 0 || entry->_generation != generation || JfrKlassUnloading::is_unloaded(entry->_klass_id)) {
+        Atomic::release_store(&entry->_state, (u4)JFR_SUMMARY_RECLAIMING);
+        ++reclaimed;
+        continue;
+      }
+      send(entry, samples, value);
+      ++sent;
+    }
+  }
+  if (reclaimed > 0) {
+    // Wait for threads that may still be matching against the reclaimed entries.
+    GlobalCounter::write_synchronize();
+    for (u4 i = 0; i < TABLE_SIZE; ++i) {
+      JfrSummaryEntry* const entry = &entries[i];
+      if (Atomic::load_acquire(&entry->_state) == JFR_SUMMARY_RECLAIMING) {
+        entry->_klass = nullptr;
+        entry->_klass_id = 0;
+        entry->_stack_trace_id = 0;
+        Atomic::release_store(&entry->_state, (u4)JFR_SUMMARY_EMPTY);
+      }
+    }
+  }
+  const size_t lost = Atomic::xchg(&_lost_samples, (size_t)0);
+  log_debug(jfr, system)("%s: %u events, %u entries reclaimed, " SIZE_FORMAT " samples lost", name, sent, reclaimed, lost);
+}
+
+#endif // SHARE_JFR_SUPPORT_JFRSUMMARYTABLE_INLINE_HPP
@@ -27,6 +27,7 @@
 #include "jfr/jni/jfrJavaSupport.hpp"
 #include "jfr/leakprofiler/checkpoint/objectSampleCheckpoint.hpp"
 #include "jfr/periodic/jfrThreadCPULoadEvent.hpp"
+#include "jfr/periodic/sampling/jfrCPUTimer.hpp"
 #include "jfr/recorder/checkpoint/jfrCheckpointManager.hpp"
 #include "jfr/recorder/checkpoint/types/traceid/jfrOopTraceId.inline.hpp"
 #include "jfr/recorder/jfrRecorder.hpp"
@@ -57,6 +58,7 @@ JfrThreadLocal::JfrThreadLocal() :
   _checkpoint_buffer_epoch_1(nullptr),
   _stackframes(nullptr),
   _dcmd_arena(nullptr),
+  _cpu_timer(nullptr),
   _thread(),
   _vthread_id(0),
   _jvm_thread_id(0),
@@ -65,11 +67,14 @@ JfrThreadLocal::JfrThreadLocal() :
   _stack_trace_id(max_julong),
   _parent_trace_id(0),
   _last_allocated_bytes(0),
+  _last_summary_allocated_bytes(0),
   _user_time(0),
   _cpu_time(0),
   _wallclock_time(os::javaTimeNanos()),
+  _cpu_time_first_expiration(0),
   _stack_trace_hash(0),
   _stackdepth(0),
+  _cpu_time_expirations(0),
   _entering_suspend_flag(0),
   _critical_section(0),
   _vthread_epoch(0),
@@ -87,6 +92,22 @@ u8 JfrThreadLocal::add_data_lost(u8 value) {
   return _data_lost;
 }
 
+void JfrThreadLocal::add_cpu_time_expirations(u4 expirations) {
+  if (Atomic::fetch_then_add(&_cpu_time_expirations, expirations) == 0) {
+    Atomic::release_store(&_cpu_time_first_expiration, JfrTicks::now().value());
+  }
+}
+
+bool JfrThreadLocal::has_cpu_time_expirations() const {
+  return Atomic::load(&_cpu_time_expirations) != 0;
+}
+
+u4 JfrThreadLocal::take_cpu_time_expirations(JfrTicks* first_expiration) {
+  assert(first_expiration != nullptr, "invariant");
+  *first_expiration = JfrTicks(Atomic::load_acquire(&_cpu_time_first_expiration));
+  return Atomic::xchg(&_cpu_time_expirations, (u4)0);
+}
+
 bool JfrThreadLocal::has_thread_blob() const {
   return _thread.valid();
 }
@@ -123,6 +144,9 @@ void JfrThreadLocal::on_start(Thread* t) {
       send_java_thread_start_event(JavaThread::cast(t));
     }
   }
+  if (t->is_Java_thread()) {
+    JfrCPUTimer::on_thread_start(JavaThread::cast(t));
+  }
   if (t->jfr_thread_local()->has_cached_stack_trace()) {
     t->jfr_thread_local()->clear_cached_stack_trace();
   }
@@ -219,6 +243,9 @@ void JfrThreadLocal::on_exit(Thread* t) {
     JfrThreadCPULoadEvent::send_event_for_thread(jt);
   }
   release(tl, Thread::current()); // because it could be that Thread::current() != t
+  if (t->is_Java_thread()) {
+    JfrCPUTimer::on_thread_exit(JavaThread::cast(t));
+  }
 }
 
 static JfrBuffer* acquire_buffer() {
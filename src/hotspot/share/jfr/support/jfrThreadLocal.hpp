@@ -26,6 +26,7 @@
 #define SHARE_JFR_SUPPORT_JFRTHREADLOCAL_HPP
 
 #include "jfr/utilities/jfrBlob.hpp"
+#include "jfr/utilities/jfrTime.hpp"
 #include "jfr/utilities/jfrTypes.hpp"
 
 class Arena;
@@ -51,6 +52,7 @@ class JfrThreadLocal {
   JfrBuffer* _checkpoint_buffer_epoch_1;
   mutable JfrStackFrame* _stackframes;
   Arena* _dcmd_arena;
+  void* _cpu_timer;
   JfrBlobHandle _thread;
   mutable traceid _vthread_id;
   mutable traceid _jvm_thread_id;
@@ -59,11 +61,14 @@ class JfrThreadLocal {
   traceid _stack_trace_id;
   traceid _parent_trace_id;
   int64_t _last_allocated_bytes;
+  int64_t _last_summary_allocated_bytes;
   jlong _user_time;
   jlong _cpu_time;
   jlong _wallclock_time;
+  volatile int64_t _cpu_time_first_expiration;
   unsigned int _stack_trace_hash;
   mutable u4 _stackdepth;
+  volatile u4 _cpu_time_expirations;
   volatile jint _entering_suspend_flag;
   mutable volatile int _critical_section;
   u2 _vthread_epoch;
@@ -159,8 +164,17 @@ class JfrThreadLocal {
     _last_allocated_bytes = allocated_bytes;
   }
 
+  int64_t last_summary_allocated_bytes() const {
+    return _last_summary_allocated_bytes;
+  }
+
+  void set_last_summary_allocated_bytes(int64_t allocated_bytes) {
+    _last_summary_allocated_bytes = allocated_bytes;
+  }
+
   void clear_last_allocated_bytes() {
     set_last_allocated_bytes(0);
+    set_last_summary_allocated_bytes(0);
   }
 
   // Contextually defined thread id that is volatile,
@@ -251,6 +265,21 @@ class JfrThreadLocal {
     _wallclock_time = wallclock_time;
   }
 
+  // Platform timer measuring the CPU time consumed by this thread, see JfrCPUTimer.
+  void* cpu_timer() const {
+    return _cpu_timer;
+  }
+
+  void set_cpu_timer(void* timer) {
+    _cpu_timer = timer;
+  }
+
+  // Called from the CPU timer signal handler, must be async-signal-safe.
+  void add_cpu_time_expirations(u4 expirations);
+  bool has_cpu_time_expirations() const;
+  // Returns and clears the number of CPU timer expirations not yet sampled.
+  u4 take_cpu_time_expirations(JfrTicks* first_expiration);
+
   bool is_notified() {
     return _notified;
   }
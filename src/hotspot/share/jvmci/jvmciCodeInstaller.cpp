@@ -639,7 +639,7 @@ void CodeInstaller::initialize_dependencies(HotSpotCompiledCodeStream* stream, u
     u2 length = stream->read_u2("methods:length");
     for (int i = 0; i < length; ++i) {
       Method* method = stream->read_method("method");
-      if (JvmtiExport::can_hotswap_or_post_breakpoint()) {
+      if (JvmtiExport::can_hotswap_or_post_breakpoint() || AlwaysRecordEvolDependencies) {
         _dependencies->assert_evol_method(method);
       }
     }
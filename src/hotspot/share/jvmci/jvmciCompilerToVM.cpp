@@ -1047,7 +1047,7 @@ C2V_VMENTRY_0(jint, getInstallCodeFlags, (JNIEnv *env, jobject))
   flags |= 0x0001; // VM will install block comments
   flags |= 0x0004; // Enable HotSpotJVMCIRuntime.Option.CodeSerializationTypeInfo if not explicitly set
 #endif
-  if (JvmtiExport::can_hotswap_or_post_breakpoint()) {
+  if (JvmtiExport::can_hotswap_or_post_breakpoint() || AlwaysRecordEvolDependencies) {
     // VM needs to track method dependencies
     flags |= 0x0002;
   }
@@ -3005,6 +3005,7 @@ C2V_VMENTRY_0(jint, registerCompilerPhase, (JNIEnv* env, jobject, jstring jphase
 C2V_VMENTRY(void, notifyCompilerPhaseEvent, (JNIEnv* env, jobject, jlong startTime, jint phase, jint compileId, jint level))
   EventCompilerPhase event;
   if (event.should_commit()) {
+    event.set_liveNodes(0); // JVMCI compilers do not report their graph size
     CompilerEvent::PhaseEvent::post(event, startTime, phase, compileId, level);
   }
 }
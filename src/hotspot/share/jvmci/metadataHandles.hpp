@@ -78,7 +78,7 @@ class MetadataHandleBlock : public CHeapObj<mtJVMCI> {
   friend class MetadataHandles;
  private:
   enum SomeConstants {
-    block_size_in_handles  = 32 // Number of handles per handle block
+    block_size_in_handles  = 256 // Number of handles per handle block
   };
 
   // Free handles always have their low bit set so those pointers can
@@ -79,8 +79,13 @@ void AsyncLogWriter::enqueue_locked(LogFileStreamOutput* output, const LogDecora
     return;
   }
 
-  _data_available = true;
-  _lock.notify();
+  // The writer thread only waits while no data is available, so only the
+  // message that makes data available needs to wake it up. This keeps the
+  // monitor signalling out of bursts of messages logged within one write().
+  if (!_data_available) {
+    _data_available = true;
+    _lock.notify();
+  }
 }
 
 void AsyncLogWriter::enqueue(LogFileStreamOutput& output, const LogDecorations& decorations, const char* msg) {
@@ -51,9 +51,12 @@ bool LogFileStreamOutput::set_option(const char* key, const char* value, outputS
   return success;
 }
 
+// Formats all decorations, followed by the separating space, into one buffer
+// and hands them to the stream in a single call rather than one per decorator.
 int LogFileStreamOutput::write_decorations(const LogDecorations& decorations) {
-  int total_written = 0;
+  char line[LogDecorators::Count * (LogDecorations::max_decoration_size + 2) + 2];
   char buf[LogDecorations::max_decoration_size + 1];
+  size_t pos = 0;
 
   for (uint i = 0; i < LogDecorators::Count; i++) {
     LogDecorators::Decorator decorator = static_cast<LogDecorators::Decorator>(i);
@@ -61,17 +64,20 @@ int LogFileStreamOutput::write_decorations(const LogDecorations& decorations) {
       continue;
     }
 
-    int written = jio_fprintf(_stream, "[%-*s]",
-                              _decorator_padding[decorator],
-                              decorations.decoration(decorator, buf, sizeof(buf)));
-    if (written <= 0) {
+    int written = jio_snprintf(line + pos, sizeof(line) - pos, "[%-*s]",
+                               _decorator_padding[decorator],
+                               decorations.decoration(decorator, buf, sizeof(buf)));
+    if (written <= 0 || pos + written >= sizeof(line) - 1) {
       return -1;
     } else if (static_cast<size_t>(written - 2) > _decorator_padding[decorator]) {
       _decorator_padding[decorator] = written - 2;
     }
-    total_written += written;
+    pos += written;
   }
-  return total_written;
+  line[pos++] = ' ';
+  line[pos] = '\0';
+
+  return jio_fprintf(_stream, "%s", line);
 }
 
 class FileLocker : public StackObj {
@@ -123,7 +129,6 @@ int LogFileStreamOutput::write_internal(const LogDecorations& decorations, const
 
   if (use_decorations) {
     WRITE_LOG_WITH_RESULT_CHECK(write_decorations(decorations), written);
-    WRITE_LOG_WITH_RESULT_CHECK(jio_fprintf(_stream, " "), written);
   }
 
   if (!_fold_multilines) {
@@ -24,11 +24,13 @@
  */
 
 #include "precompiled.hpp"
+#include "compiler/compilerThread.hpp"
 #include "memory/allocation.hpp"
 #include "memory/allocation.inline.hpp"
 #include "memory/resourceArea.hpp"
 #include "runtime/os.hpp"
 #include "runtime/task.hpp"
+#include "runtime/thread.hpp"
 #include "runtime/threadCritical.hpp"
 #include "runtime/trimNativeHeap.hpp"
 #include "services/memTracker.inline.hpp"
@@ -48,48 +50,60 @@ STATIC_ASSERT(is_aligned((int)Chunk::non_pool_size, ARENA_AMALLOC_ALIGNMENT));
 
 // MT-safe pool of same-sized chunks to reduce malloc/free thrashing
 // NB: not using Mutex because pools are used before Threads are initialized
+// Each pool has its own spin lock, so that threads churning through chunks of
+// different sizes, or using ThreadCritical for other purposes, do not contend.
+// ThreadCritical is only taken where chunks are handed back to the C-heap.
 class ChunkPool {
   Chunk*       _first;        // first cached Chunk; its first word points to next chunk
   const size_t _size;         // (inner payload) size of the chunks this pool serves
+  volatile int _lock;         // protects _first
 
   // Our four static pools
   static const int _num_pools = 4;
   static ChunkPool _pools[_num_pools];
 
  public:
-  ChunkPool(size_t size) : _first(nullptr), _size(size) {}
+  ChunkPool(size_t size) : _first(nullptr), _size(size), _lock(0) {}
 
   // Allocate a chunk from the pool; returns null if pool is empty.
   Chunk* allocate() {
-    ThreadCritical tc;
+    Thread::SpinAcquire(&_lock, "ChunkPool");
     Chunk* c = _first;
     if (_first != nullptr) {
       _first = _first->next();
     }
+    Thread::SpinRelease(&_lock);
     return c;
   }
 
   // Return a chunk to the pool
   void free(Chunk* chunk) {
     assert(chunk->length() == _size, "wrong pool for this chunk");
-    ThreadCritical tc;
+    Thread::SpinAcquire(&_lock, "ChunkPool");
     chunk->set_next(_first);
     _first = chunk;
+    Thread::SpinRelease(&_lock);
   }
 
   // Prune the pool
   void prune() {
+    // Detach the list, so that the pool is usable while the chunks are freed.
+    Thread::SpinAcquire(&_lock, "ChunkPool");
+    Chunk* cur = _first;
+    _first = nullptr;
+    Thread::SpinRelease(&_lock);
+    if (cur == nullptr) {
+      return;
+    }
     // Free all chunks while in ThreadCritical lock
     // so NMT adjustment is stable.
     ThreadCritical tc;
-    Chunk* cur = _first;
     Chunk* next = nullptr;
     while (cur != nullptr) {
       next = cur->next();
       os::free(cur);
       cur = next;
     }
-    _first = nullptr;
   }
 
   static void clean() {
@@ -273,6 +287,13 @@ void Arena::set_size_in_bytes(size_t size) {
     ssize_t delta = size - size_in_bytes();
     _size_in_bytes = size;
     MemTracker::record_arena_size_change(delta, _flags);
+    if (_flags == mtCompiler) {
+      // Lets a compilation see how much arena memory it uses.
+      Thread* thread = Thread::current_or_null();
+      if (thread != nullptr && thread->is_Compiler_thread()) {
+        CompilerThread::cast(thread)->add_arena_bytes(delta);
+      }
+    }
   }
 }
 
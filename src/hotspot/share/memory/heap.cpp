@@ -676,11 +676,18 @@ HeapBlock* CodeHeap::search_freelist(size_t length) {
 
   length = length < CodeCacheMinBlockLength ? CodeCacheMinBlockLength : length;
 
+  // No single block can be larger than all free space together. This spares
+  // walking a long, fragmented freelist for a request that cannot succeed.
+  if (length > _freelist_segments) {
+    return nullptr;
+  }
+
   // Search for best-fitting block
   while(cur != nullptr) {
     size_t cur_length = cur->length();
-    if (cur_length == length) {
-      // We have a perfect fit
+    if (cur_length >= length && cur_length - length < CodeCacheMinBlockLength) {
+      // We have a perfect fit. A block with less than CodeCacheMinBlockLength
+      // to spare is handed out whole, not worth searching on for a closer one.
       found_block  = cur;
       found_prev   = prev;
       found_length = cur_length;
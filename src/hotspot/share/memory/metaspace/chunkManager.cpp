@@ -251,6 +251,21 @@ void ChunkManager::return_chunk(Metachunk* c) {
   return_chunk_locked(c);
 }
 
+// See return_chunks().
+void ChunkManager::return_chunks(Metachunk* first) {
+  MutexLocker fcl(Metaspace_lock, Mutex::_no_safepoint_check_flag);
+  Metachunk* c = first;
+  while (c != nullptr) {
+    Metachunk* next = c->next();
+    DEBUG_ONLY(c->set_prev(nullptr);)
+    DEBUG_ONLY(c->set_next(nullptr);)
+    ASAN_POISON_MEMORY_REGION(c->base(), c->word_size() * BytesPerWord);
+    return_chunk_locked(c);
+    // c may be invalid now. Don't access anymore.
+    c = next;
+  }
+}
+
 // See return_chunk().
 void ChunkManager::return_chunk_locked(Metachunk* c) {
   assert_lock_strong(Metaspace_lock);
@@ -138,19 +138,13 @@ MetaspaceArena::~MetaspaceArena() {
   MutexLocker fcl(lock(), Mutex::_no_safepoint_check_flag);
   MemRangeCounter return_counter;
 
-  Metachunk* c = _chunks.first();
-  Metachunk* c2 = nullptr;
-
-  while (c) {
-    c2 = c->next();
+  for (Metachunk* c = _chunks.first(); c != nullptr; c = c->next()) {
     return_counter.add(c->used_words());
-    DEBUG_ONLY(c->set_prev(nullptr);)
-    DEBUG_ONLY(c->set_next(nullptr);)
     UL2(debug, "return chunk: " METACHUNK_FORMAT ".", METACHUNK_FORMAT_ARGS(c));
-    _chunk_manager->return_chunk(c);
-    // c may be invalid after return_chunk(c) was called. Don't access anymore.
-    c = c2;
   }
+  // Hand all chunks back in one go, so that a dying loader takes the
+  // Metaspace_lock once rather than once per chunk.
+  _chunk_manager->return_chunks(_chunks.first());
 
   UL2(info, "returned %d chunks, total capacity " SIZE_FORMAT " words.",
       return_counter.count(), return_counter.total_size());
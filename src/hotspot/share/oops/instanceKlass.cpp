@@ -42,6 +42,7 @@
 #include "code/dependencyContext.hpp"
 #include "compiler/compilationPolicy.hpp"
 #include "compiler/compileBroker.hpp"
+#include "compiler/compilePlan.hpp"
 #include "gc/shared/collectedHeap.inline.hpp"
 #include "interpreter/oopMapCache.hpp"
 #include "interpreter/rewriter.hpp"
@@ -946,6 +947,9 @@ bool InstanceKlass::link_class_impl(TRAPS) {
       // itable().verify(tty, true);
 #endif
       set_initialization_state_and_notify(linked, THREAD);
+      if (CompilePlan::is_enabled()) {
+        CompilePlan::apply(this, THREAD);
+      }
       if (JvmtiExport::should_post_class_prepare()) {
         JvmtiExport::post_class_prepare(THREAD, this);
       }
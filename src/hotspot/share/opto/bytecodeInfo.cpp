@@ -428,7 +428,10 @@ bool InlineTree::try_to_inline(ciMethod* callee_method, ciMethod* caller_method,
     return false;
   }
   if (inline_level() > _max_inline_level) {
-    if (!callee_method->force_inline() || !IncrementalInline) {
+    if (InlineTrivialBeyondMaxInlineLevel && callee_method->code_size() <= MaxTrivialSize) {
+      // Trivial methods, typically delegating wrappers in deeply layered
+      // code, never grow the graph by more than the call they replace.
+    } else if (!callee_method->force_inline() || !IncrementalInline) {
       set_msg("inlining too deep");
       return false;
     } else if (!C->inlining_incrementally()) {
@@ -393,6 +393,10 @@
   product(bool, UseOnlyInlinedBimorphic, true,                              \
           "Don't use BimorphicInlining if can't inline a second method")    \
                                                                             \
+  product(bool, UsePolymorphicInlining, true,                               \
+          "Profiling based inlining for more than two receivers, when "     \
+          "TypeProfileWidth is large enough to record all of them")         \
+                                                                            \
   develop(bool, SubsumeLoads, true,                                         \
           "Attempt to compile while subsuming loads into machine "          \
           "instructions.")                                                  \
@@ -423,6 +427,11 @@
           "Maximum number of nodes")                                        \
           range(1000, max_jint / 3)                                         \
                                                                             \
+  product(size_t, C2CompileArenaLimit, 0,                                   \
+          "Arena memory in bytes one compilation may use before it is "     \
+          "retried with cheaper options, or given up if already retried. "  \
+          "0 means no limit")                                               \
+                                                                            \
   product(intx, NodeLimitFudgeFactor, 2000,                                 \
           "Fudge Factor for certain optimizations")                         \
           constraint(NodeLimitFudgeFactorConstraintFunc, AfterErgo)         \
@@ -489,6 +498,10 @@
   product(bool, EliminateAllocations, true,                                 \
           "Use escape analysis to eliminate allocations")                   \
                                                                             \
+  product(bool, ReduceAllocationMerges, false, EXPERIMENTAL,                \
+          "Split field loads through Phis that merge allocations, so that " \
+          "the merged allocations can be scalar replaced")                  \
+                                                                            \
   notproduct(bool, PrintEliminateAllocations, false,                        \
           "Print out when allocations are eliminated")                      \
                                                                             \
@@ -594,6 +607,10 @@
   develop(bool, InlineAccessors, true,                                      \
           "inline accessor methods (get/set)")                              \
                                                                             \
+  product(bool, InlineTrivialBeyondMaxInlineLevel, false, DIAGNOSTIC,       \
+          "inline methods no larger than MaxTrivialSize even when deeper "  \
+          "than MaxInlineLevel, up to MaxForceInlineLevel")                 \
+                                                                            \
   product(intx, TypeProfileMajorReceiverPercent, 90,                        \
           "% of major receiver type to all profiled receivers")             \
           range(0, 100)                                                     \
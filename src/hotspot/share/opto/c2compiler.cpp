@@ -52,6 +52,9 @@ const char* C2Compiler::retry_no_locks_coarsening() {
 const char* C2Compiler::retry_no_iterative_escape_analysis() {
   return "retry without iterative escape analysis";
 }
+const char* C2Compiler::retry_over_arena_limit() {
+  return "retry with cheaper options, over C2CompileArenaLimit";
+}
 const char* C2Compiler::retry_class_loading_during_parsing() {
   return "retry class loading during parsing";
 }
@@ -117,6 +120,7 @@ void C2Compiler::compile_method(ciEnv* env, ciMethod* target, int entry_bci, boo
     // Attempt to compile while subsuming loads into machine instructions.
     Options options(subsume_loads, do_escape_analysis, do_iterative_escape_analysis, eliminate_boxing, do_locks_coarsening, install_code);
     Compile C(env, target, entry_bci, options, directive);
+    C.check_arena_limit();
 
     // Check result and retry if appropriate.
     if (C.failure_reason() != nullptr) {
@@ -124,6 +128,15 @@ void C2Compiler::compile_method(ciEnv* env, ciMethod* target, int entry_bci, boo
         env->report_failure(C.failure_reason());
         continue;  // retry
       }
+      if (C.failure_reason_is(retry_over_arena_limit())) {
+        assert(do_escape_analysis || eliminate_boxing || do_locks_coarsening, "must make progress");
+        do_escape_analysis = false;
+        do_iterative_escape_analysis = false;
+        eliminate_boxing = false;
+        do_locks_coarsening = false;
+        env->report_failure(C.failure_reason());
+        continue;  // retry
+      }
       if (C.failure_reason_is(retry_no_subsuming_loads())) {
         assert(subsume_loads, "must make progress");
         subsume_loads = false;
@@ -31,6 +31,7 @@
 #include "code/nmethod.hpp"
 #include "compiler/compileBroker.hpp"
 #include "compiler/compileLog.hpp"
+#include "compiler/compilerThread.hpp"
 #include "compiler/disassembler.hpp"
 #include "compiler/oopMap.hpp"
 #include "gc/shared/barrierSet.hpp"
@@ -617,6 +618,7 @@ Compile::Compile( ciEnv* ci_env, ciMethod* target, int osr_bci,
                   _has_method_handle_invokes(false),
                   _clinit_barrier_on_entry(false),
                   _stress_seed(0),
+                  _over_arena_limit(false),
                   _comp_arena(mtCompiler),
                   _barrier_set_state(BarrierSet::barrier_set()->barrier_set_c2()->create_barrier_state(comp_arena())),
                   _env(ci_env),
@@ -913,6 +915,7 @@ Compile::Compile( ciEnv* ci_env,
     _has_method_handle_invokes(false),
     _clinit_barrier_on_entry(false),
     _stress_seed(0),
+    _over_arena_limit(false),
     _comp_arena(mtCompiler),
     _barrier_set_state(BarrierSet::barrier_set()->barrier_set_c2()->create_barrier_state(comp_arena())),
     _env(ci_env),
@@ -1032,6 +1035,10 @@ void Compile::Init(bool aliasing) {
 
   set_do_freq_based_layout(_directive->BlockLayoutByFrequencyOption);
   _loop_opts_cnt = LoopOptsCount;
+  if (C2CompileArenaLimit > 0 && Thread::current()->is_Compiler_thread()) {
+    CompilerThread* const thread = CompilerThread::current();
+    thread->set_arena_limit(thread->arena_bytes() + (ssize_t)C2CompileArenaLimit, &_over_arena_limit);
+  }
   set_do_inlining(Inline);
   set_max_inline_size(MaxInlineSize);
   set_freq_inline_size(FreqInlineSize);
@@ -4358,6 +4365,7 @@ Compile::TracePhase::TracePhase(const char* name, elapsedTimer* accumulator)
 Compile::TracePhase::~TracePhase() {
 
   C = Compile::current();
+  C->check_arena_limit();
   if (_dolog) {
     _log = C->log();
   } else {
@@ -4380,6 +4388,26 @@ Compile::TracePhase::~TracePhase() {
   }
 }
 
+Compile::~Compile() {
+  if (C2CompileArenaLimit > 0 && Thread::current()->is_Compiler_thread()) {
+    CompilerThread::current()->set_arena_limit(0, nullptr);
+  }
+  delete _print_inlining_stream;
+}
+
+void Compile::check_arena_limit() {
+  if (!_over_arena_limit || _env->failing() || _failure_reason.get() != nullptr) {
+    return;
+  }
+  if (do_escape_analysis() || eliminate_boxing() || do_locks_coarsening()) {
+    // Escape analysis, and the scalar replacement and macro expansion
+    // that follow it, are the largest optional consumers. Try without.
+    record_failure(C2Compiler::retry_over_arena_limit());
+  } else {
+    record_method_not_compilable("over C2CompileArenaLimit");
+  }
+}
+
 //----------------------------static_subtype_check-----------------------------
 // Shortcut important common cases when superklass is exact:
 // (0) superklass is java.lang.Object (can occur in reflective code)
@@ -5083,6 +5111,7 @@ void Compile::sort_macro_nodes() {
 void Compile::print_method(CompilerPhaseType cpt, int level, Node* n) {
   EventCompilerPhase event;
   if (event.should_commit()) {
+    event.set_liveNodes(C->live_nodes());
     CompilerEvent::PhaseEvent::post(event, C->_latest_stage_start_counter, cpt, C->_compile_id, level);
   }
 #ifndef PRODUCT
@@ -5118,6 +5147,7 @@ void Compile::begin_method() {
 void Compile::end_method() {
   EventCompilerPhase event;
   if (event.should_commit()) {
+    event.set_liveNodes(C->live_nodes());
     CompilerEvent::PhaseEvent::post(event, C->_latest_stage_start_counter, PHASE_END, C->_compile_id, 1);
   }
 
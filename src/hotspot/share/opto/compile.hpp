@@ -344,6 +344,7 @@ class Compile : public Phase {
   int                   _loop_opts_cnt;         // loop opts round
   bool                  _clinit_barrier_on_entry; // True if clinit barrier is needed on nmethod entry
   uint                  _stress_seed;           // Seed for stress testing
+  bool                  _over_arena_limit;      // Set by the compiler thread when arenas grow past C2CompileArenaLimit
 
   // Compilation environment.
   Arena                 _comp_arena;            // Arena with lifetime equivalent to Compile
@@ -779,7 +780,8 @@ class Compile : public Phase {
 
   bool        failing() const        {
     return _env->failing() ||
-           _failure_reason.get() != nullptr;
+           _failure_reason.get() != nullptr ||
+           _over_arena_limit;
   }
 
   const char* failure_reason() const {
@@ -800,6 +802,11 @@ class Compile : public Phase {
     // Record failure reason.
     record_failure(reason);
   }
+  // Record the failure of a compilation that went over C2CompileArenaLimit.
+  // The limit is detected as the arenas grow, which only makes failing()
+  // true, the reason is recorded once the current phase has bailed out.
+  void check_arena_limit();
+
   bool check_node_count(uint margin, const char* reason) {
     if (live_nodes() + margin > max_node_limit()) {
       record_method_not_compilable(reason);
@@ -1098,9 +1105,7 @@ class Compile : public Phase {
           int is_fancy_jump, bool pass_tls,
           bool return_pc, DirectiveSet* directive);
 
-  ~Compile() {
-    delete _print_inlining_stream;
-  };
+  ~Compile();
 
   // Are we compiling a method?
   bool has_method() { return method() != nullptr; }
@@ -234,7 +234,8 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
       }
       if (receiver_method == nullptr &&
           (have_major_receiver || morphism == 1 ||
-           (morphism == 2 && UseBimorphicInlining))) {
+           (morphism == 2 && UseBimorphicInlining) ||
+           (morphism > 2 && UsePolymorphicInlining))) {
         // receiver_method = profile.method();
         // Profiles do not suggest methods now.  Look it up in the major receiver.
         receiver_method = callee->resolve_invoke(jvms->method()->holder(),
@@ -245,32 +246,49 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
         CallGenerator* hit_cg = this->call_generator(receiver_method,
               vtable_index, !call_does_dispatch, jvms, allow_inline, prof_factor);
         if (hit_cg != nullptr) {
-          // Look up second receiver.
-          CallGenerator* next_hit_cg = nullptr;
-          ciMethod* next_receiver_method = nullptr;
-          if (morphism == 2 && UseBimorphicInlining) {
-            next_receiver_method = callee->resolve_invoke(jvms->method()->holder(),
-                                                               profile.receiver(1));
-            if (next_receiver_method != nullptr) {
-              next_hit_cg = this->call_generator(next_receiver_method,
-                                  vtable_index, !call_does_dispatch, jvms,
-                                  allow_inline, prof_factor);
-              if (next_hit_cg != nullptr && !next_hit_cg->is_inline() &&
-                  have_major_receiver && UseOnlyInlinedBimorphic) {
-                  // Skip if we can't inline second receiver's method
+          // Look up the other receivers. A site with all of its receivers
+          // recorded gets a guarded call per receiver, the second receiver
+          // if bimorphic, or up to TypeProfileWidth receivers if polymorphic.
+          CallGenerator* next_hit_cgs[ciCallProfile::MorphismLimit];
+          ciMethod* next_receiver_methods[ciCallProfile::MorphismLimit];
+          int num_receivers = 1;
+          if ((morphism == 2 && UseBimorphicInlining) ||
+              (morphism > 2 && UsePolymorphicInlining)) {
+            for (int i = 1; i < morphism; i++) {
+              ciMethod* next_receiver_method = callee->resolve_invoke(jvms->method()->holder(),
+                                                                      profile.receiver(i));
+              CallGenerator* next_hit_cg = nullptr;
+              if (next_receiver_method != nullptr) {
+                next_hit_cg = this->call_generator(next_receiver_method,
+                                    vtable_index, !call_does_dispatch, jvms,
+                                    allow_inline, prof_factor);
+                if (next_hit_cg != nullptr && !next_hit_cg->is_inline() &&
+                    ((have_major_receiver && UseOnlyInlinedBimorphic) || morphism > 2)) {
+                  // Skip if we can't inline the receiver's method
                   next_hit_cg = nullptr;
+                }
               }
+              if (next_hit_cg == nullptr) {
+                // Only guard for the major receiver.
+                num_receivers = 1;
+                break;
+              }
+              next_receiver_methods[i] = next_receiver_method;
+              next_hit_cgs[i] = next_hit_cg;
+              num_receivers++;
             }
           }
           CallGenerator* miss_cg;
-          Deoptimization::DeoptReason reason = (morphism == 2
+          // A polymorphic site with all receivers guarded traps like a bimorphic one.
+          Deoptimization::DeoptReason reason = (morphism >= 2
                                                ? Deoptimization::Reason_bimorphic
                                                : Deoptimization::reason_class_check(speculative_receiver_type != nullptr));
-          if ((morphism == 1 || (morphism == 2 && next_hit_cg != nullptr)) &&
+          if ((morphism == 1 || (morphism >= 2 && num_receivers == morphism)) &&
               !too_many_traps_or_recompiles(caller, bci, reason)
              ) {
             // Generate uncommon trap for class check failure path
-            // in case of monomorphic or bimorphic virtual call site.
+            // in case of monomorphic, bimorphic or fully guarded
+            // polymorphic virtual call site.
             miss_cg = CallGenerator::for_uncommon_trap(callee, reason,
                         Deoptimization::Action_maybe_recompile);
           } else {
@@ -280,12 +298,18 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
                                                 : CallGenerator::for_virtual_call(callee, vtable_index));
           }
           if (miss_cg != nullptr) {
-            if (next_hit_cg != nullptr) {
+            // Chain the guards from the least frequent receiver up, so the
+            // most frequent one is tested first.
+            int remaining_count = 0;
+            for (int i = num_receivers - 1; i >= 1 && miss_cg != nullptr; i--) {
               assert(speculative_receiver_type == nullptr, "shouldn't end up here if we used speculation");
-              trace_type_profile(C, jvms->method(), jvms->depth() - 1, jvms->bci(), next_receiver_method, profile.receiver(1), site_count, profile.receiver_count(1));
+              trace_type_profile(C, jvms->method(), jvms->depth() - 1, jvms->bci(), next_receiver_methods[i], profile.receiver(i), site_count, profile.receiver_count(i));
+              remaining_count += profile.receiver_count(i);
+              float next_hit_prob = (i == num_receivers - 1) ? PROB_MAX
+                                                             : (float)profile.receiver_count(i) / (float)remaining_count;
               // We don't need to record dependency on a receiver here and below.
               // Whenever we inline, the dependency is added by Parse::Parse().
-              miss_cg = CallGenerator::for_predicted_call(profile.receiver(1), miss_cg, next_hit_cg, PROB_MAX);
+              miss_cg = CallGenerator::for_predicted_call(profile.receiver(i), miss_cg, next_hit_cgs[i], next_hit_prob);
             }
             if (miss_cg != nullptr) {
               ciKlass* k = speculative_receiver_type != nullptr ? speculative_receiver_type : profile.receiver(0);
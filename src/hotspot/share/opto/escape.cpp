@@ -91,10 +91,100 @@ bool ConnectionGraph::has_candidates(Compile *C) {
   return false;
 }
 
+// A Phi merging allocations makes all of them NonScalarReplaceable. If the
+// Phi is only used to read fields, the reads can be split through the Phi
+// instead: each path then reads from its own allocation and the Phi dies.
+bool ConnectionGraph::can_reduce_phi(PhiNode* phi, PhaseIterGVN* igvn) {
+  Node* region = phi->in(0);
+  if (region == nullptr || !region->is_Region() || igvn->type(phi)->isa_instptr() == nullptr) {
+    return false;
+  }
+  for (uint i = 1; i < phi->req(); i++) {
+    Node* in = phi->in(i);
+    // The split loads have no null check of their own.
+    if (in == nullptr || in == phi || region->in(i) == nullptr ||
+        igvn->type(in)->maybe_null() || igvn->type(in) == Type::TOP) {
+      return false;
+    }
+  }
+  if (phi->outcnt() == 0) {
+    return false;
+  }
+  for (DUIterator_Fast imax, i = phi->fast_outs(imax); i < imax; i++) {
+    Node* addp = phi->fast_out(i);
+    if (!addp->is_AddP() ||
+        addp->in(AddPNode::Base) != phi ||
+        addp->in(AddPNode::Address) != phi ||
+        !addp->in(AddPNode::Offset)->is_Con()) {
+      return false;
+    }
+    for (DUIterator_Fast jmax, j = addp->fast_outs(jmax); j < jmax; j++) {
+      Node* use = addp->fast_out(j);
+      if (!use->is_Load() || use->req() > 3 || use->as_Load()->has_pinned_control_dependency()) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool ConnectionGraph::reduce_allocation_merges(Compile* C, PhaseIterGVN* igvn) {
+  Unique_Node_List phis;
+  for (int i = 0; i < C->macro_count(); i++) {
+    Node* n = C->macro_node(i);
+    if (!n->is_Allocate() || n->is_AllocateArray()) {
+      continue;
+    }
+    Node* res = n->as_Allocate()->result_cast();
+    if (res == nullptr) {
+      continue;
+    }
+    for (DUIterator_Fast jmax, j = res->fast_outs(jmax); j < jmax; j++) {
+      Node* use = res->fast_out(j);
+      if (use->is_Phi() && can_reduce_phi(use->as_Phi(), igvn)) {
+        phis.push(use);
+      }
+    }
+  }
+
+  bool progress = false;
+  Node_List loads;
+  for (uint i = 0; i < phis.size(); i++) {
+    Node* phi = phis.at(i);
+    for (DUIterator_Fast jmax, j = phi->fast_outs(jmax); j < jmax; j++) {
+      Node* addp = phi->fast_out(j);
+      for (DUIterator_Fast kmax, k = addp->fast_outs(kmax); k < kmax; k++) {
+        loads.push(addp->fast_out(k));
+      }
+    }
+    while (loads.size() > 0) {
+      LoadNode* load = loads.pop()->as_Load();
+      Node* split = load->split_through_phi(igvn, true /* ignore_missing_instance_id */);
+      if (split == load) {
+        // Only the memory input was simplified, let IGVN look at it again.
+        igvn->_worklist.push(load);
+        progress = true;
+      } else if (split != nullptr) {
+        igvn->replace_node(load, split);
+        progress = true;
+      }
+    }
+  }
+  return progress;
+}
+
 void ConnectionGraph::do_analysis(Compile *C, PhaseIterGVN *igvn) {
   Compile::TracePhase tp("escapeAnalysis", &Phase::timers[Phase::_t_escapeAnalysis]);
   ResourceMark rm;
 
+  if (ReduceAllocationMerges && reduce_allocation_merges(C, igvn)) {
+    // Let the merging Phis go away before the connection graph is built.
+    igvn->optimize();
+    if (C->failing()) {
+      return;
+    }
+  }
+
   // Add ConP and ConN null oop nodes before ConnectionGraph construction
   // to create space for them in ConnectionGraph::_nodes[].
   Node* oop_null = igvn->zerocon(T_OBJECT);
@@ -605,6 +605,10 @@ public:
   // Perform escape analysis
   static void do_analysis(Compile *C, PhaseIterGVN *igvn);
 
+  // Split field loads through Phis merging allocations (see ReduceAllocationMerges)
+  static bool can_reduce_phi(PhiNode* phi, PhaseIterGVN* igvn);
+  static bool reduce_allocation_merges(Compile* C, PhaseIterGVN* igvn);
+
   bool not_global_escape(Node *n);
 
   // To be used by, e.g., BarrierSetC2 impls
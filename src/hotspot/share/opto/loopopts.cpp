@@ -652,6 +652,11 @@ Node *PhaseIdealLoop::conditional_move( Node *region ) {
   assert(r_loop == get_loop(iff), "sanity");
   // Always convert to CMOVE if all results are used only outside this loop.
   bool used_inside_loop = (r_loop == _ltree_root);
+  // A diamond in an innermost counted loop may be vectorized by SuperWord as a
+  // VectorBlend, if all the merged values are numbers. Then how predictable the
+  // branch is does not matter.
+  bool vector_cmove = UseVectorCmov && r_loop != _ltree_root &&
+                      r_loop->is_innermost() && r_loop->is_counted();
 
   // Check profitability
   int cost = 0;
@@ -662,6 +667,9 @@ Node *PhaseIdealLoop::conditional_move( Node *region ) {
     phis++;
     PhiNode* phi = out->as_Phi();
     BasicType bt = phi->type()->basic_type();
+    if (bt != T_INT && bt != T_LONG && bt != T_FLOAT && bt != T_DOUBLE) {
+      vector_cmove = false;
+    }
     switch (bt) {
     case T_DOUBLE:
     case T_FLOAT:
@@ -756,6 +764,9 @@ Node *PhaseIdealLoop::conditional_move( Node *region ) {
   // we are going to predict accurately all the time.
   if (C->use_cmove() && (cmp_op == Op_CmpF || cmp_op == Op_CmpD)) {
     //keep going
+  } else if (vector_cmove && phis == 1 &&
+             (cmp_op == Op_CmpI || cmp_op == Op_CmpL || cmp_op == Op_CmpF || cmp_op == Op_CmpD)) {
+    //keep going
   } else if (iff->_prob < infrequent_prob ||
       iff->_prob > (1.0f - infrequent_prob))
     return nullptr;
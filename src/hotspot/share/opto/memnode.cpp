@@ -1524,7 +1524,7 @@ static bool stable_phi(PhiNode* phi, PhaseGVN *phase) {
 }
 //------------------------------split_through_phi------------------------------
 // Split instance or boxed field load through Phi.
-Node* LoadNode::split_through_phi(PhaseGVN* phase) {
+Node* LoadNode::split_through_phi(PhaseGVN* phase, bool ignore_missing_instance_id) {
   if (req() > 3) {
     assert(is_LoadVector() && Opcode() != Op_LoadVector, "load has too many inputs");
     // LoadVector subclasses such as LoadVectorMasked have extra inputs that the logic below doesn't take into account
@@ -1535,7 +1535,8 @@ Node* LoadNode::split_through_phi(PhaseGVN* phase) {
   const TypeOopPtr *t_oop = phase->type(address)->isa_oopptr();
 
   assert((t_oop != nullptr) &&
-         (t_oop->is_known_instance_field() ||
+         (ignore_missing_instance_id ||
+          t_oop->is_known_instance_field() ||
           t_oop->is_ptr_to_boxed_value()), "invalid conditions");
 
   Compile* C = phase->C;
@@ -1547,7 +1548,7 @@ Node* LoadNode::split_through_phi(PhaseGVN* phase) {
                            phase->type(base)->higher_equal(TypePtr::NOTNULL);
 
   if (!((mem->is_Phi() || base_is_phi) &&
-        (load_boxed_values || t_oop->is_known_instance_field()))) {
+        (ignore_missing_instance_id || load_boxed_values || t_oop->is_known_instance_field()))) {
     return nullptr; // memory is not Phi
   }
 
@@ -1592,7 +1593,7 @@ Node* LoadNode::split_through_phi(PhaseGVN* phase) {
   }
 
   // Split through Phi (see original code in loopopts.cpp).
-  assert(C->have_alias_type(t_oop), "instance should have alias type");
+  assert(ignore_missing_instance_id || C->have_alias_type(t_oop), "instance should have alias type");
 
   // Do nothing here if Identity will find a value
   // (to avoid infinite chain of value phis generation).
@@ -499,7 +499,7 @@ Parse::Parse(JVMState* caller, ciMethod* parse_method, float expected_uses)
   // Always register dependence if JVMTI is enabled, because
   // either breakpoint setting or hotswapping of methods may
   // cause deoptimization.
-  if (C->env()->jvmti_can_hotswap_or_post_breakpoint()) {
+  if (C->env()->should_record_evol_dependencies()) {
     C->dependencies()->assert_evol_method(method());
   }
 
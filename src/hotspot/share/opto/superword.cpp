@@ -2063,7 +2063,9 @@ bool SuperWord::implemented(Node_List* p) {
       return false;
     } else if (p0->is_Cmp()) {
       // Cmp -> Bool -> Cmove
-      retValue = UseVectorCmov;
+      // VectorMaskCmp takes the Bool test as a signed or floating point one.
+      retValue = UseVectorCmov &&
+                 (opc == Op_CmpI || opc == Op_CmpL || opc == Op_CmpF || opc == Op_CmpD);
     } else if (requires_long_to_int_conversion(opc)) {
       // Java API for Long.bitCount/numberOfLeadingZeros/numberOfTrailingZeros
       // returns int type, but Vector API for them returns long type. To unify
@@ -2208,6 +2210,10 @@ bool SuperWord::profitable(Node_List* p) {
     if (cmp == nullptr || my_pack(cmp) == nullptr) {
       return false;
     }
+    // The mask lanes must line up with the blended lanes
+    if (type2aelembytes(velt_basic_type(cmp)) != type2aelembytes(velt_basic_type(p0))) {
+      return false;
+    }
   }
   return true;
 }
@@ -3036,6 +3042,18 @@ bool SuperWord::output() {
   return true;
 }
 
+// With a stride of vlen the trip counter overshoots the limit, so its final
+// value must not be used after the loop.
+bool SuperWord::is_used_outside_loop(Node* n) {
+  for (DUIterator_Fast imax, i = n->fast_outs(imax); i < imax; i++) {
+    Node* use = n->fast_out(i);
+    if (!lpt()->is_member(_phase->get_loop(_phase->ctrl_or_self(use)))) {
+      return true;
+    }
+  }
+  return false;
+}
+
 //-------------------------create_post_loop_vmask-------------------------
 // Check the post loop vectorizability and create a vector mask if yes.
 // Return null to bail out if post loop is not vectorizable.
@@ -3087,13 +3105,30 @@ Node* SuperWord::create_post_loop_vmask() {
     default: return nullptr;
   }
 
-  // Currently we can't remove this MaxVectorSize constraint. Without it,
-  // it's not guaranteed that the RCE'd post loop runs at most "vlen - 1"
-  // iterations, because the vector drain loop may not be cloned from the
-  // vectorized main loop. We should re-engineer PostLoopMultiversioning
-  // to fix this problem.
+  // If the exit test stops at or past the limit, the post loop can keep
+  // iterating with a stride of vlen, masking the lanes past the limit. It
+  // then handles any trip count. Otherwise the post loop is straightened to
+  // a single iteration, which is only correct if it runs at most "vlen - 1"
+  // iterations. That is not guaranteed without this MaxVectorSize constraint,
+  // because the vector drain loop may not be cloned from the vectorized main
+  // loop.
   int vlen = cl->slp_max_unroll();
-  if (unique_size * vlen != MaxVectorSize) {
+  BoolTest::mask exit_test = cl->loopexit()->test_trip();
+  bool masked_loop = ((cl->stride_con() > 0 && exit_test == BoolTest::lt) ||
+                      (cl->stride_con() < 0 && exit_test == BoolTest::gt)) &&
+                     !is_used_outside_loop(cl->phi()) && !is_used_outside_loop(cl->incr());
+  if (masked_loop) {
+    // The loop limit check predicate only guarantees that a stride of +/-1
+    // does not overflow the trip counter. With a stride of vlen the limit
+    // must be at least vlen - 1 away from the end of the int range.
+    const TypeInt* limit_t = _igvn.type(cl->limit())->is_int();
+    if (cl->stride_con() > 0) {
+      masked_loop = limit_t->_hi <= max_jint - (vlen - 1);
+    } else {
+      masked_loop = limit_t->_lo >= min_jint + (vlen - 1);
+    }
+  }
+  if (!masked_loop && unique_size * vlen != MaxVectorSize) {
     return nullptr;
   }
 
@@ -3109,6 +3144,36 @@ Node* SuperWord::create_post_loop_vmask() {
     return nullptr;
   }
 
+  if (masked_loop) {
+    // Each iteration handles the next vlen trips, or the ones that remain.
+    Node* remaining;
+    if (cl->stride_con() > 0) {
+      remaining = new SubINode(cl->limit(), cl->phi());
+    } else {
+      remaining = new SubINode(cl->phi(), cl->limit());
+    }
+    _igvn.register_new_node_with_optimizer(remaining);
+    Node* trips = new MinINode(remaining, _igvn.intcon(vlen));
+    _igvn.register_new_node_with_optimizer(trips);
+    Node* length = new ConvI2LNode(trips);
+    _igvn.register_new_node_with_optimizer(length);
+    Node* vmask = VectorMaskGenNode::make(length, vmask_bt);
+    _igvn.register_new_node_with_optimizer(vmask);
+
+    // The stride of a counted loop is the increment of its trip counter.
+    // The increment may be shared with other users, so only the trip
+    // counter phi and the exit test get a copy with the new stride.
+    Node* old_incr = cl->incr();
+    Node* new_incr = old_incr->clone();
+    new_incr->set_req(2, _igvn.intcon(cl->stride_con() * vlen));
+    _igvn.register_new_node_with_optimizer(new_incr);
+    _igvn.replace_input_of(cl->phi(), LoopNode::LoopBackControl, new_incr);
+    Node* cmp = cl->loopexit()->cmp_node();
+    assert(cmp->in(1) == old_incr, "exit test must use the trip counter increment");
+    _igvn.replace_input_of(cmp, 1, new_incr);
+    return vmask;
+  }
+
   // Create vector mask with the post loop trip count. Note there's another
   // vector drain loop which is cloned from main loop before super-unrolling
   // so the scalar post loop runs at most vlen-1 trips. Hence, this version
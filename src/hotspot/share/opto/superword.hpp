@@ -585,6 +585,7 @@ private:
   bool output();
   // Create vector mask for post loop vectorization
   Node* create_post_loop_vmask();
+  bool is_used_outside_loop(Node* n);
   // Create a vector operand for the nodes in pack p for operand: in(opd_idx)
   Node* vector_opd(Node_List* p, int opd_idx);
   // Can code be generated for pack p?
@@ -2830,6 +2830,14 @@ JNI_ENTRY(const jchar*, jni_GetStringCritical(JNIEnv *env, jstring string, jbool
   oop s = JNIHandles::resolve_non_null(string);
   jchar* ret;
   if (!java_lang_String::is_latin1(s)) {
+    // Now that a garbage collection can happen during the critical section,
+    // deduplication must not replace the value array: the old one would be
+    // unreachable while native code still accesses it, and the release
+    // would unpin the wrong array.
+    if (StringDedup::is_enabled()) {
+      NoSafepointVerifier nsv;
+      StringDedup::forbid_deduplication(s);
+    }
     typeArrayHandle s_value(thread, java_lang_String::value(s));
 
     // Pin value array
@@ -2866,8 +2874,8 @@ JNI_ENTRY(void, jni_ReleaseStringCritical(JNIEnv *env, jstring str, const jchar
     // This assumes that ReleaseStringCritical bookends GetStringCritical.
     FREE_C_HEAP_ARRAY(jchar, chars);
   } else {
-    // StringDedup can have replaced the value array, so don't fetch the array from 's'.
-    // Instead, we calculate the address based on the jchar array exposed with GetStringCritical.
+    // Calculate the address based on the jchar array exposed with GetStringCritical,
+    // the value array of 's' is the same since deduplication is forbidden for it.
     oop value = cast_to_oop((address)chars - arrayOopDesc::base_offset_in_bytes(T_CHAR));
 
     // Unpin value array
@@ -485,7 +485,7 @@ JVM_ENTRY_NO_ENV(jint, JVM_ActiveProcessorCount(void))
 JVM_END
 
 JVM_LEAF(jboolean, JVM_IsUseContainerSupport(void))
-#ifdef LINUX
+#if defined(LINUX) || defined(BSD)
   if (UseContainerSupport) {
     return JNI_TRUE;
   }
@@ -1834,7 +1834,7 @@ JVM_ENTRY(jobjectArray, JVM_GetRecordComponents(JNIEnv* env, jclass ofClass))
 }
 JVM_END
 
-static bool select_method(const methodHandle& method, bool want_constructor) {
+static bool select_method(const Method* method, bool want_constructor) {
   if (want_constructor) {
     return (method->is_initializer() && !method->is_static());
   } else {
@@ -1874,8 +1874,10 @@ static jobjectArray get_class_declared_methods_helper(
   GrowableArray<int>* idnums = new GrowableArray<int>(methods_length);
   int num_methods = 0;
 
+  // Nothing in this loop can safepoint, so there is no need for a
+  // methodHandle per method of the class.
   for (int i = 0; i < methods_length; i++) {
-    methodHandle method(THREAD, methods->at(i));
+    const Method* method = methods->at(i);
     if (select_method(method, want_constructor)) {
       if (!publicOnly || method->is_public()) {
         idnums->push(method->method_idnum());
@@ -4116,8 +4116,9 @@ void VM_RedefineClasses::flush_dependent_code() {
 
   DeoptimizationScope deopt_scope;
 
-  // This is the first redefinition, mark all the nmethods for deoptimization
-  if (!JvmtiExport::all_dependencies_are_recorded()) {
+  // This is the first redefinition, mark all the nmethods for deoptimization,
+  // unless the compilers have recorded the dependencies from startup anyway.
+  if (!JvmtiExport::all_dependencies_are_recorded() && !AlwaysRecordEvolDependencies) {
     CodeCache::mark_all_nmethods_for_evol_deoptimization(&deopt_scope);
     log_debug(redefine, class, nmethod)("Marked all nmethods for deopt");
   } else {
@@ -127,7 +127,7 @@ JvmtiTagMap* JvmtiTagMap::tag_map_for(JvmtiEnv* env) {
 }
 
 // iterate over all entries in the tag map.
-void JvmtiTagMap::entry_iterate(JvmtiTagMapKeyClosure* closure) {
+void JvmtiTagMap::entry_iterate(JvmtiTagMapEntryClosure* closure) {
   hashmap()->entry_iterate(closure);
 }
 
@@ -324,17 +324,11 @@ class TwoOopCallbackWrapper : public CallbackWrapper {
 
 // tag an object
 //
-// This function is performance critical. If many threads attempt to tag objects
-// around the same time then it's possible that the Mutex associated with the
-// tag map will be a hot lock.
+// This function is performance critical. Many threads may tag objects around
+// the same time, so the hashmap is updated without holding the tag map lock.
+// SetTag doesn't post ObjectFree events because the JavaThread would have to
+// transition to native for the callback.
 void JvmtiTagMap::set_tag(jobject object, jlong tag) {
-  MutexLocker ml(lock(), Mutex::_no_safepoint_check_flag);
-
-  // SetTag should not post events because the JavaThread has to
-  // transition to native for the callback and this cannot stop for
-  // safepoints with the hashmap lock held.
-  check_hashmap(nullptr);  /* don't collect dead objects */
-
   // resolve the object
   oop o = JNIHandles::resolve_non_null(object);
 
@@ -351,15 +345,8 @@ void JvmtiTagMap::set_tag(jobject object, jlong tag) {
   }
 }
 
-// get the tag for an object
+// get the tag for an object, the lookup doesn't need the tag map lock
 jlong JvmtiTagMap::get_tag(jobject object) {
-  MutexLocker ml(lock(), Mutex::_no_safepoint_check_flag);
-
-  // GetTag should not post events because the JavaThread has to
-  // transition to native for the callback and this cannot stop for
-  // safepoints with the hashmap lock held.
-  check_hashmap(nullptr); /* don't collect dead objects */
-
   // resolve the object
   oop o = JNIHandles::resolve_non_null(object);
 
@@ -1153,7 +1140,9 @@ void JvmtiTagMap::remove_dead_entries_locked(GrowableArray<jlong>* objects) {
     log_info(jvmti, table)("TagMap table needs cleaning%s",
                            ((objects != nullptr) ? " and posting" : ""));
     hashmap()->remove_dead_entries(objects);
-    _needs_cleaning = false;
+    // In a safepoint the dead entries are only cleared, they are unlinked
+    // by the next cleaning outside of a safepoint.
+    _needs_cleaning = SafepointSynchronize::is_at_safepoint();
   }
 }
 
@@ -1208,7 +1197,7 @@ void JvmtiTagMap::flush_object_free_events() {
 
 // support class for get_objects_with_tags
 
-class TagObjectCollector : public JvmtiTagMapKeyClosure {
+class TagObjectCollector : public JvmtiTagMapEntryClosure {
  private:
   JvmtiEnv* _env;
   JavaThread* _thread;
@@ -1240,14 +1229,15 @@ class TagObjectCollector : public JvmtiTagMapKeyClosure {
   // - if it matches then we create a JNI local reference to the object
   // and record the reference and tag value.
   // Always return true so the iteration continues.
-  bool do_entry(JvmtiTagMapKey& key, jlong& value) {
+  bool do_entry(JvmtiTagMapEntry* entry) {
+    jlong value = entry->tag();
     for (int i = 0; i < _tag_count; i++) {
       if (_tags[i] == value) {
         // The reference in this tag map could be the only (implicitly weak)
         // reference to that object. If we hand it out, we need to keep it live wrt
         // SATB marking similar to other j.l.ref.Reference referents. This is
         // achieved by using a phantom load in the object() accessor.
-        oop o = key.object();
+        oop o = entry->object();
         if (o == nullptr) {
           _some_dead_found = true;
           // skip this whole entry
@@ -32,7 +32,7 @@
 
 class JvmtiEnv;
 class JvmtiTagMapTable;
-class JvmtiTagMapKeyClosure;
+class JvmtiTagMapEntryClosure;
 
 class JvmtiTagMap :  public CHeapObj<mtServiceability> {
  private:
@@ -53,7 +53,7 @@ class JvmtiTagMap :  public CHeapObj<mtServiceability> {
 
   void check_hashmap(GrowableArray<jlong>* objects);
 
-  void entry_iterate(JvmtiTagMapKeyClosure* closure);
+  void entry_iterate(JvmtiTagMapEntryClosure* closure);
 
  public:
   // indicates if this tag map is locked
@@ -23,70 +23,126 @@
  */
 
 #include "precompiled.hpp"
+#include "gc/shared/collectedHeap.hpp"
+#include "logging/log.hpp"
 #include "memory/allocation.hpp"
 #include "memory/universe.hpp"
 #include "oops/oop.inline.hpp"
 #include "oops/weakHandle.inline.hpp"
 #include "prims/jvmtiExport.hpp"
 #include "prims/jvmtiTagMapTable.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/safepoint.hpp"
+#include "utilities/concurrentHashTable.inline.hpp"
+#include "utilities/growableArray.hpp"
 
+oop JvmtiTagMapEntry::object() const {
+  return _wh.resolve();
+}
+
+oop JvmtiTagMapEntry::object_no_keepalive() const {
+  return _wh.peek();
+}
+
+void JvmtiTagMapEntry::release_weak_handle() const {
+  _wh.release(JvmtiExport::weak_tag_storage());
+}
 
-JvmtiTagMapKey::JvmtiTagMapKey(oop obj) : _obj(obj) {}
+// The tag of an entry may be read by lock free lookups while it is updated.
+jlong JvmtiTagMapEntry::tag() const {
+  return Atomic::load(&_tag);
+}
 
-JvmtiTagMapKey::JvmtiTagMapKey(const JvmtiTagMapKey& src) {
-  // move object into WeakHandle when copying into the table
-  if (src._obj != nullptr) {
+void JvmtiTagMapEntry::set_tag(jlong tag) {
+  Atomic::store(&_tag, tag);
+}
 
-    // obj was read with AS_NO_KEEPALIVE, or equivalent, like during
-    // a heap walk.  The object needs to be kept alive when it is published.
-    Universe::heap()->keep_alive(src._obj);
+class JvmtiTagMapTableConfig : public AllStatic {
+ public:
+  typedef JvmtiTagMapEntry Value;
 
-    _wh = WeakHandle(JvmtiExport::weak_tag_storage(), src._obj);
-  } else {
-    // resizing needs to create a copy.
-    _wh = src._wh;
+  static uintx get_hash(Value const& value, bool* is_dead) {
+    oop obj = value.object_no_keepalive();
+    if (obj == nullptr) {
+      *is_dead = true;
+      return 0;
+    }
+    *is_dead = false;
+    return obj->identity_hash();
   }
-  // obj is always null after a copy.
-  _obj = nullptr;
+
+  // We use default allocation/deallocation but counted
+  static void* allocate_node(void* context, size_t size, Value const& value) {
+    static_cast<JvmtiTagMapTable*>(context)->item_added();
+    return AllocateHeap(size, mtServiceability);
+  }
+  static void free_node(void* context, void* memory, Value const& value) {
+    value.release_weak_handle();
+    FreeHeap(memory);
+    static_cast<JvmtiTagMapTable*>(context)->item_removed();
+  }
+};
+
+class JvmtiTagMapTableLookup : StackObj {
+ private:
+  oop   _obj;
+  uintx _hash;
+
+ public:
+  JvmtiTagMapTableLookup(oop obj) : _obj(obj), _hash(obj->identity_hash()) {}
+
+  uintx get_hash() const {
+    return _hash;
+  }
+  bool equals(JvmtiTagMapEntry* value) {
+    return value->object_no_keepalive() == _obj;
+  }
+  bool is_dead(JvmtiTagMapEntry* value) {
+    return value->object_no_keepalive() == nullptr;
+  }
+};
+
+static const size_t START_SIZE_LOG2 = 10;
+static const size_t END_SIZE_LOG2   = 30;
+static const size_t GROW_HINT       = 4;
+
+JvmtiTagMapTable::JvmtiTagMapTable() : _items_count(0) {
+  _table = new JvmtiTagMapTableHash(START_SIZE_LOG2, END_SIZE_LOG2, GROW_HINT,
+                                    false /* enable_statistics */,
+                                    Mutex::nosafepoint-2, this);
 }
 
-void JvmtiTagMapKey::release_weak_handle() const {
-  _wh.release(JvmtiExport::weak_tag_storage());
+JvmtiTagMapTable::~JvmtiTagMapTable() {
+  // Frees the remaining nodes and releases their weak handles.
+  delete _table;
 }
 
-oop JvmtiTagMapKey::object() const {
-  assert(_obj == nullptr, "Must have a handle and not object");
-  return _wh.resolve();
+void JvmtiTagMapTable::item_added() {
+  Atomic::inc(&_items_count);
 }
 
-oop JvmtiTagMapKey::object_no_keepalive() const {
-  assert(_obj == nullptr, "Must have a handle and not object");
-  return _wh.peek();
+void JvmtiTagMapTable::item_removed() {
+  Atomic::dec(&_items_count);
 }
 
-static const int INITIAL_TABLE_SIZE = 1007;
-static const int MAX_TABLE_SIZE     = 0x3fffffff;
+bool JvmtiTagMapTable::is_empty() const {
+  return Atomic::load(&_items_count) == 0;
+}
 
-JvmtiTagMapTable::JvmtiTagMapTable() : _table(INITIAL_TABLE_SIZE, MAX_TABLE_SIZE) {}
+void JvmtiTagMapTable::maybe_grow(Thread* thread) {
+  // Grow in place if no other thread is resizing or cleaning the table.
+  if (_table->grow(thread)) {
+    log_info(jvmti, table) ("JvmtiTagMap table resized to " SIZE_FORMAT " for " SIZE_FORMAT " entries",
+                            (size_t)1 << _table->get_size_log2(thread), Atomic::load(&_items_count));
+  }
+}
 
 void JvmtiTagMapTable::clear() {
-  struct RemoveAll {
-    bool do_entry(const JvmtiTagMapKey& entry, const jlong& tag) {
-      entry.release_weak_handle();
-      return true;
-    }
-  } remove_all;
-  // The unlink method of ResourceHashTable gets a pointer to a type whose 'do_entry(K,V)' method is callled
-  // while iterating over all the elements of the table. If the do_entry() method returns true the element
-  // will be removed.
-  // In this case, we always return true from do_entry to clear all the elements.
-  _table.unlink(&remove_all);
+  auto remove_all = [] (JvmtiTagMapEntry* entry) { return true; };
+  auto nop = [] (JvmtiTagMapEntry* entry) {};
+  _table->bulk_delete(Thread::current(), remove_all, nop);
 
-  assert(_table.number_of_entries() == 0, "should have removed all entries");
-}
-
-JvmtiTagMapTable::~JvmtiTagMapTable() {
-  clear();
+  assert(is_empty(), "should have removed all entries");
 }
 
 jlong JvmtiTagMapTable::find(oop obj) {
@@ -99,56 +155,76 @@ jlong JvmtiTagMapTable::find(oop obj) {
     return 0;
   }
 
-  JvmtiTagMapKey jtme(obj);
-  jlong* found = _table.get(jtme);
-  return found == nullptr ? 0 : *found;
+  JvmtiTagMapTableLookup lookup(obj);
+  jlong tag = 0;
+  auto get_tag = [&] (JvmtiTagMapEntry* entry) { tag = entry->tag(); };
+  _table->get(Thread::current(), lookup, get_tag);
+  return tag;
 }
 
 void JvmtiTagMapTable::add(oop obj, jlong tag) {
-  JvmtiTagMapKey new_entry(obj);
-  bool is_added;
-  if (obj->fast_no_hash_check()) {
-    // Can't be in the table so add it fast.
-    is_added = _table.put_when_absent(new_entry, tag);
-  } else {
-    jlong* value = _table.put_if_absent(new_entry, tag, &is_added);
-    *value = tag; // assign the new tag
+  Thread* thread = Thread::current();
+  // Objects in the table all have a hashcode, so check before the lookup
+  // installs one.
+  bool may_be_present = !obj->fast_no_hash_check();
+  JvmtiTagMapTableLookup lookup(obj);
+  auto update_tag = [&] (JvmtiTagMapEntry* entry) { entry->set_tag(tag); };
+
+  if (may_be_present && _table->get(thread, lookup, update_tag)) {
+    return;
   }
-  if (is_added) {
-    if (_table.maybe_grow(5, true /* use_large_table_sizes */)) {
-      int max_bucket_size = DEBUG_ONLY(_table.verify()) NOT_DEBUG(0);
-      log_info(jvmti, table) ("JvmtiTagMap table resized to %d for %d entries max bucket %d",
-                              _table.table_size(), _table.number_of_entries(), max_bucket_size);
-    }
+
+  // obj may have been read with AS_NO_KEEPALIVE, or equivalent, like during
+  // a heap walk.  The object needs to be kept alive when it is published.
+  Universe::heap()->keep_alive(obj);
+
+  // The table takes ownership of the WeakHandle, even if another thread
+  // added the object first and the tag of that entry is updated instead.
+  JvmtiTagMapEntry new_entry(WeakHandle(JvmtiExport::weak_tag_storage(), obj), tag);
+  bool grow_hint = false;
+  if (_table->insert_get(thread, lookup, new_entry, update_tag, &grow_hint) && grow_hint) {
+    maybe_grow(thread);
   }
 }
 
 void JvmtiTagMapTable::remove(oop obj) {
-  JvmtiTagMapKey jtme(obj);
-  auto clean = [] (const JvmtiTagMapKey& entry, jlong tag) {
-    entry.release_weak_handle();
-  };
-  _table.remove(jtme, clean);
+  if (is_empty() || obj->fast_no_hash_check()) {
+    return;
+  }
+  JvmtiTagMapTableLookup lookup(obj);
+  _table->remove(Thread::current(), lookup);
 }
 
-void JvmtiTagMapTable::entry_iterate(JvmtiTagMapKeyClosure* closure) {
-  _table.iterate(closure);
+void JvmtiTagMapTable::entry_iterate(JvmtiTagMapEntryClosure* closure) {
+  auto do_entry = [&] (JvmtiTagMapEntry* entry) { return closure->do_entry(entry); };
+  _table->do_scan(Thread::current(), do_entry);
 }
 
 void JvmtiTagMapTable::remove_dead_entries(GrowableArray<jlong>* objects) {
-  struct IsDead {
-    GrowableArray<jlong>* _objects;
-    IsDead(GrowableArray<jlong>* objects) : _objects(objects) {}
-    bool do_entry(const JvmtiTagMapKey& entry, jlong tag) {
-      if (entry.object_no_keepalive() == nullptr) {
-        if (_objects != nullptr) {
-          _objects->append(tag);
+  if (SafepointSynchronize::is_at_safepoint()) {
+    // Nodes can't be unlinked in a safepoint. Collect the tags of the dead
+    // entries and clear them so they are not posted again, the entries
+    // themselves are removed by the next concurrent cleaning.
+    auto collect_dead = [&] (JvmtiTagMapEntry* entry) {
+      if (entry->object_no_keepalive() == nullptr && entry->tag() != 0) {
+        if (objects != nullptr) {
+          objects->append(entry->tag());
         }
-        entry.release_weak_handle();
-        return true;
+        entry->set_tag(0);
       }
-      return false;;
+      return true;
+    };
+    _table->do_safepoint_scan(collect_dead);
+    return;
+  }
+
+  auto is_dead = [] (JvmtiTagMapEntry* entry) {
+    return entry->object_no_keepalive() == nullptr;
+  };
+  auto collect_tag = [&] (JvmtiTagMapEntry* entry) {
+    if (objects != nullptr && entry->tag() != 0) {
+      objects->append(entry->tag());
     }
-  } is_dead(objects);
-  _table.unlink(&is_dead);
+  };
+  _table->bulk_delete(Thread::current(), is_dead, collect_tag);
 }
@@ -25,54 +25,47 @@
 #ifndef SHARE_VM_PRIMS_TAGMAPTABLE_HPP
 #define SHARE_VM_PRIMS_TAGMAPTABLE_HPP
 
-#include "gc/shared/collectedHeap.hpp"
 #include "memory/allocation.hpp"
 #include "oops/weakHandle.hpp"
-#include "utilities/resizeableResourceHash.hpp"
+#include "utilities/concurrentHashTable.hpp"
 
 class JvmtiEnv;
-class JvmtiTagMapKeyClosure;
+class JvmtiTagMapEntryClosure;
+class JvmtiTagMapTableConfig;
+template <typename T> class GrowableArray;
 
-// The oop is needed for lookup rather than creating a WeakHandle during
-// lookup because the HeapWalker may walk soon to be dead objects and
-// creating a WeakHandle for an otherwise dead object makes G1 unhappy.
+// An entry holds a WeakHandle to the tagged object and its tag.
 //
-// This class is the Key type for inserting in ResizeableResourceHashTable
-// Its get_hash() and equals() methods are also used for getting the hash
-// value of a Key and comparing two Keys, respectively.
-class JvmtiTagMapKey : public CHeapObj<mtServiceability> {
+// Lookups are done with the oop rather than by creating a WeakHandle
+// because the HeapWalker may walk soon to be dead objects and creating
+// a WeakHandle for an otherwise dead object makes G1 unhappy.
+class JvmtiTagMapEntry {
   WeakHandle _wh;
-  oop _obj; // temporarily hold obj while searching
+  jlong _tag;
  public:
-  JvmtiTagMapKey(oop obj);
-  JvmtiTagMapKey(const JvmtiTagMapKey& src);
-  JvmtiTagMapKey& operator=(const JvmtiTagMapKey&) = delete;
+  JvmtiTagMapEntry(WeakHandle wh, jlong tag) : _wh(wh), _tag(tag) {}
 
   oop object() const;
   oop object_no_keepalive() const;
   void release_weak_handle() const;
 
-  static unsigned get_hash(const JvmtiTagMapKey& entry) {
-    assert(entry._obj != nullptr, "must lookup obj to hash");
-    return entry._obj->identity_hash();
-  }
-
-  static bool equals(const JvmtiTagMapKey& lhs, const JvmtiTagMapKey& rhs) {
-    oop lhs_obj = lhs._obj != nullptr ? lhs._obj : lhs.object_no_keepalive();
-    oop rhs_obj = rhs._obj != nullptr ? rhs._obj : rhs.object_no_keepalive();
-    return lhs_obj == rhs_obj;
-  }
+  jlong tag() const;
+  void set_tag(jlong tag);
 };
 
-typedef
-ResizeableResourceHashtable <JvmtiTagMapKey, jlong,
-                              AnyObj::C_HEAP, mtServiceability,
-                              JvmtiTagMapKey::get_hash,
-                              JvmtiTagMapKey::equals> ResizableResourceHT;
+typedef ConcurrentHashTable<JvmtiTagMapTableConfig, mtServiceability> JvmtiTagMapTableHash;
 
+// The table is a ConcurrentHashTable so lookups do not need a lock and may
+// run concurrently with insertions, removals and cleaning of dead entries.
 class JvmtiTagMapTable : public CHeapObj<mtServiceability> {
+  friend class JvmtiTagMapTableConfig;
  private:
-  ResizableResourceHT _table;
+  JvmtiTagMapTableHash* _table;
+  volatile size_t _items_count;
+
+  void item_added();
+  void item_removed();
+  void maybe_grow(Thread* thread);
 
  public:
   JvmtiTagMapTable();
@@ -84,9 +77,9 @@ class JvmtiTagMapTable : public CHeapObj<mtServiceability> {
   void remove(oop obj);
 
   // iterate over all entries in the hashmap
-  void entry_iterate(JvmtiTagMapKeyClosure* closure);
+  void entry_iterate(JvmtiTagMapEntryClosure* closure);
 
-  bool is_empty() const { return _table.number_of_entries() == 0; }
+  bool is_empty() const;
 
   // Cleanup cleared entries and store dead object tags in objects array
   void remove_dead_entries(GrowableArray<jlong>* objects);
@@ -94,9 +87,9 @@ class JvmtiTagMapTable : public CHeapObj<mtServiceability> {
 };
 
 // A supporting class for iterating over all entries in Hashmap
-class JvmtiTagMapKeyClosure {
+class JvmtiTagMapEntryClosure {
  public:
-  virtual bool do_entry(JvmtiTagMapKey& key, jlong& value) = 0;
+  virtual bool do_entry(JvmtiTagMapEntry* entry) = 0;
 };
 
 #endif // SHARE_VM_PRIMS_TAGMAPTABLE_HPP
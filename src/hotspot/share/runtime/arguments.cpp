@@ -61,6 +61,7 @@
 #include "utilities/align.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/defaultStream.hpp"
+#include "utilities/hardwareCounters.hpp"
 #include "utilities/macros.hpp"
 #include "utilities/parseInteger.hpp"
 #include "utilities/powerOfTwo.hpp"
@@ -1916,6 +1917,12 @@ bool Arguments::check_vm_args_consistency() {
   }
 #endif
 
+  // Monitors only locking is meant for testing, unlike the other modes.
+  if (LockingMode == LM_MONITOR && !UnlockExperimentalVMOptions) {
+    jio_fprintf(defaultStream::error_stream(),
+                "LockingMode == 0 (LM_MONITOR) is experimental and must be enabled via -XX:+UnlockExperimentalVMOptions");
+    return false;
+  }
 #if !defined(X86) && !defined(AARCH64) && !defined(PPC64) && !defined(RISCV64) && !defined(S390)
   if (LockingMode == LM_MONITOR) {
     jio_fprintf(defaultStream::error_stream(),
@@ -1931,6 +1938,14 @@ bool Arguments::check_vm_args_consistency() {
     return false;
   }
 #endif
+#if (defined(X86) || defined(PPC64)) && !defined(ZERO)
+  if (LockingMode == LM_LIGHTWEIGHT && UseRTMForStackLocks) {
+    jio_fprintf(defaultStream::error_stream(),
+                "LockingMode == 2 (LM_LIGHTWEIGHT) and -XX:+UseRTMForStackLocks are mutually exclusive");
+
+    return false;
+  }
+#endif
   if (VerifyHeavyMonitors && LockingMode != LM_MONITOR) {
     jio_fprintf(defaultStream::error_stream(),
                 "-XX:+VerifyHeavyMonitors requires LockingMode == 0 (LM_MONITOR)");
@@ -2090,6 +2105,8 @@ jint Arguments::parse_vm_init_args(const JavaVMInitArgs *vm_options_args,
 
   SystemMemoryBarrier::initialize();
 
+  HardwareCounters::initialize();
+
   // Do final processing now that all arguments have been parsed
   result = finalize_vm_init_args(patch_mod_javabase);
   if (result != JNI_OK) {
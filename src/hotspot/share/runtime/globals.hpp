@@ -171,6 +171,12 @@ const int ObjectAlignmentInBytes = 8;
   product(uint, HandshakeTimeout, 0, DIAGNOSTIC,                            \
           "If nonzero set a timeout in milliseconds for handshakes")        \
                                                                             \
+  product(uint, ParallelHandshakeThreads, 0, EXPERIMENTAL,                  \
+          "Number of worker threads that help the VM thread process "       \
+          "handshakes with all threads on behalf of blocked threads "       \
+          "(0 means the VM thread does it alone)")                          \
+          range(0, 256)                                                     \
+                                                                            \
   product(bool, AlwaysSafeConstructors, false, EXPERIMENTAL,                \
           "Force safe construction, as if all fields are final.")           \
                                                                             \
@@ -456,6 +462,11 @@ const int ObjectAlignmentInBytes = 8;
   product(bool, BytecodeVerificationLocal, false, DIAGNOSTIC,               \
           "Enable the Java bytecode verifier for local classes")            \
                                                                             \
+  product(ccstr, BackgroundLinkClassList, nullptr, EXPERIMENTAL,            \
+          "Load and link the classes named in this class list on a "        \
+          "background thread during startup. Ignored when dumping a CDS "   \
+          "archive")                                                        \
+                                                                            \
   develop(bool, VerifyStackAtCalls, false,                                  \
           "Verify that the stack pointer is unchanged after calls")         \
                                                                             \
@@ -565,6 +576,12 @@ const int ObjectAlignmentInBytes = 8;
   product(ccstr, NativeMemoryTracking, DEBUG_ONLY("summary") NOT_DEBUG("off"), \
           "Native memory tracking options")                                 \
                                                                             \
+  product(size_t, NativeMemoryTrackingSampleInterval, 0,                    \
+          "With NativeMemoryTracking=detail, record the call site of "      \
+          "malloc allocations only for one in this many bytes allocated "   \
+          "on average, chosen at random. The summary stays exact. "         \
+          "0 records every call site.")                                     \
+                                                                            \
   product(bool, PrintNMTStatistics, false, DIAGNOSTIC,                      \
           "Print native memory tracking summary data if it is on")          \
                                                                             \
@@ -706,6 +723,13 @@ const int ObjectAlignmentInBytes = 8;
                "Do JVMTI virtual thread mount/unmount transitions "         \
                "(disabling this flag implies no JVMTI events are posted)")  \
                                                                             \
+  product(bool, AlwaysRecordEvolDependencies, true, EXPERIMENTAL,           \
+          "Unconditionally record nmethod dependencies on methods that "    \
+          "may be redefined, independently of the JVMTI "                   \
+          "can_redefine_classes and can_retransform_classes "               \
+          "capabilities, so that the first redefinition does not "          \
+          "deoptimize all compiled code")                                   \
+                                                                            \
   /* notice: the max range value here is max_jint, not max_intx  */         \
   /* because of overflow issue                                   */         \
   product(intx, AsyncDeflationInterval, 250, DIAGNOSTIC,                    \
@@ -937,6 +961,17 @@ const int ObjectAlignmentInBytes = 8;
              "Reduce the number of parallel compiler threads when they "    \
              "are not used")                                                \
                                                                             \
+  product(intx, CompilerThreadLatencyTarget, 0, EXPERIMENTAL,               \
+          "Start another compiler thread, even if the compile queue is "    \
+          "short, when a task waited in it for longer than this many "      \
+          "milliseconds. 0 disables")                                       \
+          range(0, max_intx)                                                \
+                                                                            \
+  product(bool, ThrottleCompilerThreadsOnLoad, false, EXPERIMENTAL,         \
+          "Do not start more compiler threads than there are idle "         \
+          "processors, as given by the current active processor count and " \
+          "the system load average")                                        \
+                                                                            \
   product(bool, TraceCompilerThreads, false, DIAGNOSTIC,                    \
              "Trace creation and removal of compiler threads")              \
                                                                             \
@@ -1297,6 +1332,14 @@ const int ObjectAlignmentInBytes = 8;
   product(bool, UseSystemMemoryBarrier, false,                              \
           "Try to enable system memory barrier if supported by OS")         \
                                                                             \
+  product(bool, UsePerfEventCounters, false, DIAGNOSTIC,                    \
+          "Count hardware events (cycles, instructions, cache and TLB "     \
+          "misses) of the current thread during GC phases and VM "          \
+          "operations, if supported by the OS. The counts are added to "    \
+          "the GC phase log lines and logged with -Xlog:vmoperation+perf. " \
+          "Only serial phases are counted, phases that hand work to GC "    \
+          "worker threads are reported as not counted")                     \
+                                                                            \
   product(intx, NmethodSweepActivity, 4,                                    \
           "Removes cold nmethods from code cache if > 0. Higher values "    \
           "result in more aggressive sweeping")                             \
@@ -1550,6 +1593,16 @@ const int ObjectAlignmentInBytes = 8;
           "Size of code heap with profiled methods (in bytes)")             \
           range(0, max_uintx)                                               \
                                                                             \
+  product(uintx, HotCodeHeapSize, 0, EXPERIMENTAL,                          \
+          "Size of the code heap for hot C2 nmethods, taken from the "      \
+          "non-profiled code heap (in bytes). 0 disables the hot heap")     \
+          range(0, max_uintx)                                               \
+                                                                            \
+  product(intx, HotCodeHeapThreshold, 100000, EXPERIMENTAL,                 \
+          "Minimum number of invocations and backedges of a method for "    \
+          "its C2 code to be placed in the hot code heap")                  \
+          range(0, max_jint)                                                \
+                                                                            \
   product_pd(uintx, NonNMethodCodeHeapSize,                                 \
           "Size of code heap with non-nmethods (in bytes)")                 \
           constraint(VMPageSizeConstraintFunc, AtParse)                     \
@@ -1973,9 +2026,10 @@ const int ObjectAlignmentInBytes = 8;
              "Mark all threads after a safepoint, and clear on a modify "   \
              "fence. Add cleanliness checks.")                              \
                                                                             \
-  product(int, LockingMode, LM_LEGACY, EXPERIMENTAL,                        \
+  product(int, LockingMode, LM_LEGACY,                                      \
           "Select locking mode: "                                           \
-          "0: monitors only (LM_MONITOR), "                                 \
+          "0: monitors only (LM_MONITOR, experimental, needs "              \
+          "-XX:+UnlockExperimentalVMOptions), "                             \
           "1: monitors & legacy stack-locking (LM_LEGACY, default), "       \
           "2: monitors & new lightweight locking (LM_LIGHTWEIGHT)")         \
           range(0, 2)                                                       \
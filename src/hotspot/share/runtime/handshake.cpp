@@ -25,6 +25,7 @@
 #include "precompiled.hpp"
 #include "classfile/javaClasses.hpp"
 #include "classfile/vmSymbols.hpp"
+#include "gc/shared/workerThread.hpp"
 #include "jvm_io.h"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
@@ -155,8 +156,8 @@ class HandshakeSpinYield : public StackObj {
     _spin_time_ns = _spin_time_ns > max_spin_time_ns ? max_spin_time_ns : _spin_time_ns;
   }
 
-  void add_result(HandshakeState::ProcessResult pr) {
-    _result_count[current_result_pos()][pr]++;
+  void add_result(HandshakeState::ProcessResult pr, int count = 1) {
+    _result_count[current_result_pos()][pr] += count;
   }
 
   void process() {
@@ -233,6 +234,62 @@ static void log_handshake_info(jlong start_time_ns, const char* name, int target
   }
 }
 
+// Lets worker threads try to process a handshake operation for all threads
+// in a ThreadsList, in chunks claimed from a shared index. The handshake
+// closures must already cope with being executed concurrently for different
+// targets, since each target may also process the operation itself.
+class ParallelHandshakeTask : public WorkerTask {
+  HandshakeOperation* const _op;
+  ThreadsList* const        _list;
+  volatile uint             _next;
+  volatile int              _result_count[HandshakeState::_number_states];
+
+ public:
+  static const uint ChunkSize = 64;
+
+  ParallelHandshakeTask(HandshakeOperation* op, ThreadsList* list) :
+    WorkerTask("Parallel Handshake"), _op(op), _list(list), _next(0), _result_count() {}
+
+  void work(uint worker_id) {
+    int result_count[HandshakeState::_number_states] = {};
+    const uint length = _list->length();
+    for (uint start = Atomic::fetch_then_add(&_next, ChunkSize);
+         start < length;
+         start = Atomic::fetch_then_add(&_next, ChunkSize)) {
+      const uint end = MIN2(start + ChunkSize, length);
+      for (uint i = start; i < end; i++) {
+        result_count[_list->thread_at(i)->handshake_state()->try_process(_op)]++;
+      }
+    }
+    for (int i = 0; i < HandshakeState::_number_states; i++) {
+      if (result_count[i] != 0) {
+        Atomic::add(&_result_count[i], result_count[i]);
+      }
+    }
+  }
+
+  int result_count(HandshakeState::ProcessResult pr) const {
+    return Atomic::load(&_result_count[pr]);
+  }
+};
+
+static WorkerThreads* _handshake_workers = nullptr;
+
+// Returns the number of workers to use for processing a handshake with the
+// given number of target threads, or 0 if the VM thread should do it alone.
+static uint handshake_workers_for(int number_of_threads) {
+  assert(Thread::current()->is_VM_thread(), "only the VM thread creates workers");
+  const uint wanted = MIN2(ParallelHandshakeThreads, (uint)number_of_threads / ParallelHandshakeTask::ChunkSize);
+  if (wanted < 2) {
+    return 0;
+  }
+  if (_handshake_workers == nullptr) {
+    _handshake_workers = new WorkerThreads("Handshake Worker", ParallelHandshakeThreads);
+  }
+  const uint active = _handshake_workers->set_active_workers(wanted);
+  return active < 2 ? 0 : active;
+}
+
 class VM_HandshakeAllThreads: public VM_Operation {
   HandshakeOperation* const _op;
  public:
@@ -262,7 +319,8 @@ class VM_HandshakeAllThreads: public VM_Operation {
     // _op was created with a count == 1 so don't double count.
     _op->add_target_count(number_of_threads_issued - 1);
 
-    log_trace(handshake)("Threads signaled, begin processing blocked threads by VMThread");
+    const uint workers = handshake_workers_for(number_of_threads_issued);
+    log_trace(handshake)("Threads signaled, begin processing blocked threads by VMThread and %u workers", workers);
     HandshakeSpinYield hsy(start_time_ns);
     // Keeps count on how many of own emitted handshakes
     // this thread execute.
@@ -274,14 +332,24 @@ class VM_HandshakeAllThreads: public VM_Operation {
       // Have VM thread perform the handshake operation for blocked threads.
       // Observing a blocked state may of course be transient but the processing is guarded
       // by mutexes and we optimistically begin by working on the blocked threads
-      jtiwh.rewind();
-      for (JavaThread* thr = jtiwh.next(); thr != nullptr; thr = jtiwh.next()) {
-        // A new thread on the ThreadsList will not have an operation,
-        // hence it is skipped in handshake_try_process.
-        HandshakeState::ProcessResult pr = thr->handshake_state()->try_process(_op);
-        hsy.add_result(pr);
-        if (pr == HandshakeState::_succeeded) {
-          emitted_handshakes_executed++;
+      if (workers > 0) {
+        ParallelHandshakeTask task(_op, jtiwh.list());
+        _handshake_workers->run_task(&task);
+        for (int i = 0; i < HandshakeState::_number_states; i++) {
+          HandshakeState::ProcessResult pr = static_cast<HandshakeState::ProcessResult>(i);
+          hsy.add_result(pr, task.result_count(pr));
+        }
+        emitted_handshakes_executed += task.result_count(HandshakeState::_succeeded);
+      } else {
+        jtiwh.rewind();
+        for (JavaThread* thr = jtiwh.next(); thr != nullptr; thr = jtiwh.next()) {
+          // A new thread on the ThreadsList will not have an operation,
+          // hence it is skipped in handshake_try_process.
+          HandshakeState::ProcessResult pr = thr->handshake_state()->try_process(_op);
+          hsy.add_result(pr);
+          if (pr == HandshakeState::_succeeded) {
+            emitted_handshakes_executed++;
+          }
         }
       }
       hsy.process();
@@ -85,6 +85,7 @@ void vmStructs_init() NOT_DEBUG_RETURN;
 void vtableStubs_init();
 void InlineCacheBuffer_init();
 void compilerOracle_init();
+void compilePlan_init();
 bool compileBroker_init();
 void dependencyContext_init();
 void dependencies_init();
@@ -159,6 +160,7 @@ jint init_globals2() {
   vtableStubs_init();
   InlineCacheBuffer_init();
   compilerOracle_init();
+  compilePlan_init();
   dependencyContext_init();
   dependencies_init();
 
@@ -418,6 +418,7 @@ JavaThread::JavaThread() :
   _current_waiting_monitor(nullptr),
   _active_handles(nullptr),
   _free_handle_block(nullptr),
+  _jni_handle_cache(nullptr),
   _Stalled(0),
 
   _monitor_chunks(nullptr),
@@ -620,6 +621,14 @@ JavaThread::~JavaThread() {
   // Enqueue OopHandles for release by the service thread.
   add_oop_handles_for_release();
 
+  // Return cached global handle entries. Done here rather than in exit,
+  // as JVMTI and other cleanup may still delete global handles after that.
+  if (_jni_handle_cache != nullptr) {
+    _jni_handle_cache->flush();
+    delete _jni_handle_cache;
+    _jni_handle_cache = nullptr;
+  }
+
   // Return the sleep event to the free list
   ParkEvent::Release(_SleepEvent);
   _SleepEvent = nullptr;
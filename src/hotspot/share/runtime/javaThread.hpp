@@ -53,6 +53,7 @@ class AsyncExceptionHandshake;
 class ContinuationEntry;
 class DeoptResourceMark;
 class JNIHandleBlock;
+class JNIHandleCache;
 class JVMCIRuntime;
 
 class JvmtiDeferredUpdates;
@@ -157,6 +158,9 @@ class JavaThread: public Thread {
   // One-element thread local free list
   JNIHandleBlock* _free_handle_block;
 
+  // Free global and weak global handle entries, created on first use
+  JNIHandleCache* _jni_handle_cache;
+
  public:
   volatile intptr_t _Stalled;
 
@@ -189,6 +193,8 @@ class JavaThread: public Thread {
   void set_active_handles(JNIHandleBlock* block) { _active_handles = block; }
   JNIHandleBlock* free_handle_block() const      { return _free_handle_block; }
   void set_free_handle_block(JNIHandleBlock* block) { _free_handle_block = block; }
+  JNIHandleCache* jni_handle_cache() const       { return _jni_handle_cache; }
+  void set_jni_handle_cache(JNIHandleCache* cache) { _jni_handle_cache = cache; }
 
   void push_jni_handle_block();
   void pop_jni_handle_block();
@@ -89,7 +89,9 @@ jobject JNIHandles::make_global(Handle obj, AllocFailType alloc_failmode) {
   if (!obj.is_null()) {
     // ignore null handles
     assert(oopDesc::is_oop(obj()), "not an oop");
-    oop* ptr = global_handles()->allocate();
+    JNIHandleCache* cache = JNIHandleCache::current();
+    oop* ptr = (cache != nullptr) ? cache->_global.allocate(global_handles())
+                                  : global_handles()->allocate();
     // Return null on allocation failure.
     if (ptr != nullptr) {
       assert(NativeAccess<AS_NO_KEEPALIVE>::oop_load(ptr) == oop(nullptr), "invariant");
@@ -111,7 +113,9 @@ jweak JNIHandles::make_weak_global(Handle obj, AllocFailType alloc_failmode) {
   if (!obj.is_null()) {
     // ignore null handles
     assert(oopDesc::is_oop(obj()), "not an oop");
-    oop* ptr = weak_global_handles()->allocate();
+    JNIHandleCache* cache = JNIHandleCache::current();
+    oop* ptr = (cache != nullptr) ? cache->_weak_global.allocate(weak_global_handles())
+                                  : weak_global_handles()->allocate();
     // Return nullptr on allocation failure.
     if (ptr != nullptr) {
       assert(NativeAccess<AS_NO_KEEPALIVE>::oop_load(ptr) == oop(nullptr), "invariant");
@@ -148,7 +152,12 @@ void JNIHandles::destroy_global(jobject handle) {
   if (handle != nullptr) {
     oop* oop_ptr = global_ptr(handle);
     NativeAccess<>::oop_store(oop_ptr, (oop)nullptr);
-    global_handles()->release(oop_ptr);
+    JNIHandleCache* cache = JNIHandleCache::current();
+    if (cache != nullptr) {
+      cache->_global.release(global_handles(), oop_ptr);
+    } else {
+      global_handles()->release(oop_ptr);
+    }
   }
 }
 
@@ -157,8 +166,64 @@ void JNIHandles::destroy_weak_global(jweak handle) {
   if (handle != nullptr) {
     oop* oop_ptr = weak_global_ptr(handle);
     NativeAccess<ON_PHANTOM_OOP_REF>::oop_store(oop_ptr, (oop)nullptr);
-    weak_global_handles()->release(oop_ptr);
+    JNIHandleCache* cache = JNIHandleCache::current();
+    if (cache != nullptr) {
+      cache->_weak_global.release(weak_global_handles(), oop_ptr);
+    } else {
+      weak_global_handles()->release(oop_ptr);
+    }
+  }
+}
+
+
+JNIHandleCache* JNIHandleCache::current() {
+  // Keep the checked JNI mode precise about deleted handles, which the
+  // cache would keep allocated in the storage.
+  if (CheckJNICalls) {
+    return nullptr;
+  }
+  Thread* thread = Thread::current_or_null();
+  if (thread == nullptr || !thread->is_Java_thread()) {
+    return nullptr;
   }
+  JavaThread* jt = JavaThread::cast(thread);
+  JNIHandleCache* cache = jt->jni_handle_cache();
+  if (cache == nullptr) {
+    cache = new JNIHandleCache();
+    jt->set_jni_handle_cache(cache);
+  }
+  return cache;
+}
+
+oop* JNIHandleCache::Entries::allocate(OopStorage* storage) {
+  if (_count == 0) {
+    _count = storage->allocate(_ptrs, refill_count);
+    if (_count == 0) {
+      return nullptr;
+    }
+  }
+  return _ptrs[--_count];
+}
+
+void JNIHandleCache::Entries::release(OopStorage* storage, oop* ptr) {
+  if (_count == capacity) {
+    // Keep half, so alternating allocate and release doesn't thrash.
+    storage->release(&_ptrs[refill_count], capacity - refill_count);
+    _count = refill_count;
+  }
+  _ptrs[_count++] = ptr;
+}
+
+void JNIHandleCache::Entries::flush(OopStorage* storage) {
+  if (_count > 0) {
+    storage->release(_ptrs, _count);
+    _count = 0;
+  }
+}
+
+void JNIHandleCache::flush() {
+  _global.flush(JNIHandles::global_handles());
+  _weak_global.flush(JNIHandles::weak_global_handles());
 }
 
 
@@ -36,6 +36,7 @@ class Thread;
 
 class JNIHandles : AllStatic {
   friend class VMStructs;
+  friend class JNIHandleCache;
  private:
   // These are used by the serviceability agent.
   static OopStorage* _global_handles;
@@ -131,6 +132,45 @@ public:
 };
 
 
+// Per-thread cache of free global and weak global entries, in front of
+// the OopStorage of each kind.  Entries are taken from the storage and
+// handed back to it in bulk, so that a thread creating and deleting
+// global refs at a high rate mostly avoids the storage's allocation
+// mutex and its shared release path.  Cached entries are allocated
+// entries of the storage holding null, which the GC skips over.
+// Only used by the owning thread, so no locking.
+
+class JNIHandleCache : public CHeapObj<mtInternal> {
+ private:
+  static const size_t capacity = 32;            // Entries per kind
+  static const size_t refill_count = capacity / 2;
+
+  class Entries {
+    size_t _count;
+    oop*   _ptrs[capacity];
+
+   public:
+    Entries() : _count(0) {}
+    oop* allocate(OopStorage* storage);
+    void release(OopStorage* storage, oop* ptr);
+    void flush(OopStorage* storage);
+  };
+
+  Entries _global;
+  Entries _weak_global;
+
+  friend class JNIHandles;
+
+  // The cache of the current thread, created on first use, or null if
+  // the current thread does not have one.
+  static JNIHandleCache* current();
+
+ public:
+  // Returns all cached entries to their storage.
+  void flush();
+};
+
+
 
 // JNI handle blocks holding local/global JNI handles
 
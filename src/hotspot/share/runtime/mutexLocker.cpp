@@ -122,6 +122,7 @@ Mutex*   JfrStacktrace_lock           = nullptr;
 Monitor* JfrMsg_lock                  = nullptr;
 Mutex*   JfrBuffer_lock               = nullptr;
 Monitor* JfrThreadSampler_lock        = nullptr;
+Mutex*   JfrCPUTimer_lock             = nullptr;
 #endif
 
 #ifndef SUPPORTS_NATIVE_CX8
@@ -296,6 +297,7 @@ void mutex_init() {
   MUTEX_DEFN(JfrMsg_lock                     , PaddedMonitor, event);
   MUTEX_DEFN(JfrStacktrace_lock              , PaddedMutex  , event);
   MUTEX_DEFN(JfrThreadSampler_lock           , PaddedMonitor, nosafepoint);
+  MUTEX_DEFN(JfrCPUTimer_lock                , PaddedMutex  , nosafepoint);
 #endif
 
 #ifndef SUPPORTS_NATIVE_CX8
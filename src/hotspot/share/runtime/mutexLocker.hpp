@@ -134,6 +134,7 @@ extern Mutex*   JfrStacktrace_lock;              // used to guard access to the
 extern Monitor* JfrMsg_lock;                     // protects JFR messaging
 extern Mutex*   JfrBuffer_lock;                  // protects JFR buffer operations
 extern Monitor* JfrThreadSampler_lock;           // used to suspend/resume JFR thread sampler
+extern Mutex*   JfrCPUTimer_lock;                // protects creation and deletion of JFR CPU-time timers
 #endif
 
 #ifndef SUPPORTS_NATIVE_CX8
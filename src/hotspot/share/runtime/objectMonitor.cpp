@@ -57,6 +57,7 @@
 #include "utilities/preserveException.hpp"
 #if INCLUDE_JFR
 #include "jfr/support/jfrFlush.hpp"
+#include "jfr/support/jfrMonitorContentionSummary.hpp"
 #endif
 
 #ifdef DTRACE_ENABLED
@@ -386,6 +387,7 @@ bool ObjectMonitor::enter(JavaThread* current) {
     // belong to the same object.
     event.set_address((uintptr_t)this);
   }
+  JFR_ONLY(JfrMonitorContentionSample contention_sample(object()->klass(), current);)
 
   { // Change java thread status to indicate blocked on monitor enter.
     JavaThreadBlockedOnMonitorEnterState jtbmes(current, this);
@@ -2134,10 +2136,11 @@ void ObjectMonitor::Initialize() {
 
   if (UsePerfData) {
     EXCEPTION_MARK;
-#define NEWPERFCOUNTER(n)                                                \
-  {                                                                      \
-    n = PerfDataManager::create_counter(SUN_RT, #n, PerfData::U_Events,  \
-                                        CHECK);                          \
+    // The counters are updated by many threads, keep them apart.
+#define NEWPERFCOUNTER(n)                                                       \
+  {                                                                             \
+    n = PerfDataManager::create_padded_counter(SUN_RT, #n, PerfData::U_Events,  \
+                                               CHECK);                          \
   }
 #define NEWPERFVARIABLE(n)                                                \
   {                                                                       \
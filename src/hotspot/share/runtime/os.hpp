@@ -219,6 +219,10 @@ class os: AllStatic {
   static void   pd_free_memory(char *addr, size_t bytes, size_t alignment_hint);
   static void   pd_realign_memory(char *addr, size_t bytes, size_t alignment_hint);
 
+  // Returns 0 if pretouching is done via platform dependent method, or otherwise
+  // returns page_size that should be used for the common method.
+  static size_t pd_pretouch_memory(void* first, void* last, size_t page_size);
+
   static char*  pd_reserve_memory_special(size_t size, size_t alignment, size_t page_size,
 
                                           char* addr, bool executable);
@@ -235,12 +239,14 @@ class os: AllStatic {
   static void initialize_initial_active_processor_count();
 
   LINUX_ONLY(static void pd_init_container_support();)
+  BSD_ONLY(static void pd_init_container_support();)
 
  public:
   static void init(void);                      // Called before command line parsing
 
   static void init_container_support() {       // Called during command line parsing.
      LINUX_ONLY(pd_init_container_support();)
+     BSD_ONLY(pd_init_container_support();)
   }
 
   static void init_before_ergo(void);          // Called after command line parsing
@@ -318,6 +324,9 @@ class os: AllStatic {
   // aggressively (e.g. clear caches) so that it becomes available.
   static julong available_memory();
   static julong free_memory();
+  // Share of recent wall clock time, in percent, in which tasks were stalled
+  // waiting for memory (Linux pressure stall information), or -1 if unknown.
+  static double memory_pressure();
 
   static julong physical_memory();
   static bool has_allocatable_memory_limit(size_t* limit);
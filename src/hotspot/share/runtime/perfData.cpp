@@ -34,6 +34,7 @@
 #include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
 #include "runtime/perfData.inline.hpp"
+#include "utilities/align.hpp"
 #include "utilities/exceptions.hpp"
 #include "utilities/globalDefinitions.hpp"
 
@@ -120,7 +121,7 @@ PerfData::~PerfData() {
   }
 }
 
-void PerfData::create_entry(BasicType dtype, size_t dsize, size_t vlen) {
+void PerfData::create_entry(BasicType dtype, size_t dsize, size_t vlen, bool padded) {
 
   size_t dlen = vlen==0 ? 1 : vlen;
 
@@ -131,6 +132,13 @@ void PerfData::create_entry(BasicType dtype, size_t dsize, size_t vlen) {
   size_t data_start = size;
   size += (dsize * dlen);
 
+  if (padded) {
+    // reserve room to move the data to the next cache line boundary once
+    // the entry is allocated, and to leave the rest of that line unused.
+    size = data_start + DEFAULT_CACHE_LINE_SIZE +
+           align_up(dsize * dlen, (size_t)DEFAULT_CACHE_LINE_SIZE);
+  }
+
   // align size to assure allocation in units of 8 bytes
   int align = sizeof(jlong) - 1;
   size = ((size + align) & ~align);
@@ -146,7 +154,12 @@ void PerfData::create_entry(BasicType dtype, size_t dsize, size_t vlen) {
   // compute the addresses for the name and data
   char* cname = psmp + sizeof(PerfDataEntry);
 
-  // data is in the last dsize*dlen bytes of the entry
+  if (padded) {
+    data_start = align_up((uintptr_t)psmp + data_start, (uintptr_t)DEFAULT_CACHE_LINE_SIZE) - (uintptr_t)psmp;
+  }
+
+  // data is in the last dsize*dlen bytes of the entry, or at the start
+  // of its own cache line(s) for a padded entry
   void* valuep = (void*) (psmp + data_start);
 
   assert(is_on_c_heap() || PerfMemory::contains(cname), "just checking");
@@ -185,10 +198,11 @@ void PerfData::create_entry(BasicType dtype, size_t dsize, size_t vlen) {
   PerfMemory::mark_updated();
 }
 
-PerfLong::PerfLong(CounterNS ns, const char* namep, Units u, Variability v)
+PerfLong::PerfLong(CounterNS ns, const char* namep, Units u, Variability v,
+                   bool padded)
                  : PerfData(ns, namep, u, v) {
 
-  create_entry(T_LONG, sizeof(jlong));
+  create_entry(T_LONG, sizeof(jlong), 0, padded);
 }
 
 PerfLongVariant::PerfLongVariant(CounterNS ns, const char* namep, Units u,
@@ -461,6 +475,25 @@ PerfLongCounter* PerfDataManager::create_long_counter(CounterNS ns,
   return p;
 }
 
+PerfLongCounter* PerfDataManager::create_padded_counter(CounterNS ns,
+                                                        const char* name,
+                                                        PerfData::Units u,
+                                                        TRAPS) {
+
+  PerfLongCounter* p = new PerfLongCounter(ns, name, u, (jlong)0,
+                                           true /* padded */);
+
+  if (!p->is_valid()) {
+    // allocation of native resources failed.
+    delete p;
+    THROW_0(vmSymbols::java_lang_OutOfMemoryError());
+  }
+
+  add_item(p, false);
+
+  return p;
+}
+
 PerfLongCounter* PerfDataManager::create_long_counter(CounterNS ns,
                                                       const char* name,
                                                       PerfData::Units u,
@@ -295,8 +295,11 @@ class PerfData : public CHeapObj<mtInternal> {
 
     // create the entry for the PerfData item in the PerfData memory region.
     // this region is maintained separately from the PerfData objects to
-    // facilitate its use by external processes.
-    void create_entry(BasicType dtype, size_t dsize, size_t dlen = 0);
+    // facilitate its use by external processes. the data of a padded entry
+    // is placed on cache line(s) of its own, so that items updated by many
+    // threads do not false share with their neighbors.
+    void create_entry(BasicType dtype, size_t dsize, size_t dlen = 0,
+                      bool padded = false);
 
     // sample the data item given at creation time and write its value
     // into the its corresponding PerfMemory location.
@@ -355,7 +358,8 @@ class PerfLong : public PerfData {
 
   protected:
 
-    PerfLong(CounterNS ns, const char* namep, Units u, Variability v);
+    PerfLong(CounterNS ns, const char* namep, Units u, Variability v,
+             bool padded = false);
 
   public:
     // returns the value of the data portion of the item in the
@@ -400,8 +404,8 @@ class PerfLongVariant : public PerfLong {
     PerfLongSampleHelper* _sample_helper;
 
     PerfLongVariant(CounterNS ns, const char* namep, Units u, Variability v,
-                    jlong initial_value=0)
-                   : PerfLong(ns, namep, u, v) {
+                    jlong initial_value=0, bool padded=false)
+                   : PerfLong(ns, namep, u, v, padded) {
       if (is_valid()) *(jlong*)_valuep = initial_value;
     }
 
@@ -432,9 +436,9 @@ class PerfLongCounter : public PerfLongVariant {
   protected:
 
     PerfLongCounter(CounterNS ns, const char* namep, Units u,
-                    jlong initial_value=0)
+                    jlong initial_value=0, bool padded=false)
                    : PerfLongVariant(ns, namep, u, V_Monotonic,
-                                     initial_value) { }
+                                     initial_value, padded) { }
 
     PerfLongCounter(CounterNS ns, const char* namep, Units u,
                     PerfLongSampleHelper* sample_helper)
@@ -748,6 +752,11 @@ class PerfDataManager : AllStatic {
                                                 PerfLongSampleHelper* sh,
                                                 TRAPS);
 
+    // a counter whose data is on a cache line of its own, for counters
+    // that are updated by many threads.
+    static PerfLongCounter* create_padded_counter(CounterNS ns, const char* name,
+                                                  PerfData::Units u, TRAPS);
+
 
     // these creation methods are provided for ease of use. These allow
     // Long performance data types to be created with a shorthand syntax.
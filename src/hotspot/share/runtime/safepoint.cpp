@@ -40,6 +40,7 @@
 #include "gc/shared/workerUtils.hpp"
 #include "interpreter/interpreter.hpp"
 #include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrThreadId.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
@@ -95,12 +96,16 @@ static void post_safepoint_synchronize_event(EventSafepointStateSynchronization&
                                              uint64_t safepoint_id,
                                              int initial_number_of_threads,
                                              int threads_waiting_to_block,
-                                             uint64_t iterations) {
+                                             uint64_t iterations,
+                                             JavaThread* last_running,
+                                             address last_running_pc) {
   if (event.should_commit()) {
     event.set_safepointId(safepoint_id);
     event.set_initialThreadCount(initial_number_of_threads);
     event.set_runningThreadCount(threads_waiting_to_block);
     event.set_iterations(iterations);
+    event.set_lastThread(last_running != nullptr ? JFR_JVM_THREAD_ID(last_running) : 0);
+    event.set_lastThreadPc((u8)last_running_pc);
     event.commit();
   }
 }
@@ -215,7 +220,8 @@ static void back_off(int64_t start_time) {
   }
 }
 
-int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int nof_threads, int* initial_running)
+int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int nof_threads, int* initial_running,
+                                              JavaThread** last_running)
 {
   JavaThreadIteratorWithHandle jtiwh;
 
@@ -245,6 +251,7 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
   DEBUG_ONLY(assert_list_is_valid(tss_head, still_running);)
 
   *initial_running = still_running;
+  *last_running = nullptr;
 
   // If there is no thread still running, we are already done.
   if (still_running <= 0) {
@@ -266,7 +273,10 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
     while (cur_tss != nullptr) {
       assert(cur_tss->is_running(), "Illegal initial state");
       if (thread_not_running(cur_tss)) {
-        --still_running;
+        if (--still_running == 0) {
+          // This thread kept the safepoint waiting the longest.
+          *last_running = cur_tss->thread();
+        }
         *p_prev = nullptr;
         ThreadSafepointState *tmp = cur_tss;
         cur_tss = cur_tss->get_next();
@@ -385,14 +395,21 @@ void SafepointSynchronize::begin() {
 
   EventSafepointStateSynchronization sync_event;
   int initial_running = 0;
+  JavaThread* last_running = nullptr;
 
   // Arms the safepoint, _current_jni_active_count and _waiting_to_block must be set before.
   arm_safepoint();
 
   // Will spin until all threads are safe.
-  int iterations = synchronize_threads(safepoint_limit_time, nof_threads, &initial_running);
+  int iterations = synchronize_threads(safepoint_limit_time, nof_threads, &initial_running, &last_running);
   assert(_waiting_to_block == 0, "No thread should be running");
 
+  // The threads are stopped now, so the last Java frame of the straggler can be read.
+  address last_running_pc = nullptr;
+  if (last_running != nullptr && last_running->has_last_Java_frame()) {
+    last_running_pc = last_running->last_Java_pc();
+  }
+
 #ifndef PRODUCT
   // Mark all threads
   if (VerifyCrossModifyFence) {
@@ -435,9 +452,11 @@ void SafepointSynchronize::begin() {
   post_safepoint_synchronize_event(sync_event,
                                    _safepoint_id,
                                    initial_running,
-                                   _waiting_to_block, iterations);
+                                   _waiting_to_block, iterations,
+                                   last_running, last_running_pc);
 
   SafepointTracing::synchronized(nof_threads, initial_running, _nof_threads_hit_polling_page);
+  SafepointTracing::last_running(last_running, last_running_pc);
 
   // We do the safepoint cleanup first since a GC related safepoint
   // needs cleanup to be completed before running the GC op.
@@ -1127,6 +1146,31 @@ void SafepointTracing::synchronized(int nof_threads, int nof_running, int traps)
   RuntimeService::record_safepoint_synchronized(_last_safepoint_sync_time_ns - _last_safepoint_begin_time_ns);
 }
 
+// Logs the thread that reached the safepoint last, which is the one that
+// determined the time to safepoint, and where it stopped.
+void SafepointTracing::last_running(JavaThread* thread, address pc) {
+  if (thread == nullptr || !log_is_enabled(Debug, safepoint)) {
+    return;
+  }
+  ResourceMark rm;
+  const char* where = "no Java frame";
+  if (pc != nullptr) {
+    CodeBlob* cb = CodeCache::find_blob(pc);
+    if (cb == nullptr) {
+      where = "unknown code";
+    } else if (cb->is_nmethod()) {
+      where = cb->as_nmethod()->method()->external_name();
+    } else {
+      where = cb->name();
+    }
+  }
+  log_debug(safepoint)("Last thread to reach safepoint: \"%s\" " INTPTR_FORMAT ", "
+                       "Reaching safepoint: " JLONG_FORMAT " ns, pc: " INTPTR_FORMAT " (%s)",
+                       thread->name(), p2i(thread),
+                       _last_safepoint_sync_time_ns - _last_safepoint_begin_time_ns,
+                       p2i(pc), where);
+}
+
 void SafepointTracing::cleanup() {
   _last_safepoint_cleanup_time_ns = os::javaTimeNanos();
 }
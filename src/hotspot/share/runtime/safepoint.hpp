@@ -113,7 +113,8 @@ class SafepointSynchronize : AllStatic {
 
   // Helper methods for safepoint procedure:
   static void arm_safepoint();
-  static int synchronize_threads(jlong safepoint_limit_time, int nof_threads, int* initial_running);
+  static int synchronize_threads(jlong safepoint_limit_time, int nof_threads, int* initial_running,
+                                 JavaThread** last_running);
   static void disarm_safepoint();
   static void increment_jni_active_count();
   static void decrement_waiting_to_block();
@@ -267,6 +268,7 @@ public:
 
   static void begin(VM_Operation::VMOp_Type type);
   static void synchronized(int nof_threads, int nof_running, int traps);
+  static void last_running(JavaThread* thread, address pc);
   static void cleanup();
   static void end();
 
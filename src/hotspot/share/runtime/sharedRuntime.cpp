@@ -30,6 +30,7 @@
 #include "code/codeCache.hpp"
 #include "code/compiledIC.hpp"
 #include "code/icBuffer.hpp"
+#include "code/jitDump.hpp"
 #include "code/compiledMethod.inline.hpp"
 #include "code/scopeDesc.hpp"
 #include "code/vtableStubs.hpp"
@@ -3121,6 +3122,11 @@ void AdapterHandlerLibrary::create_native_wrapper(const methodHandle& method) {
       CompileTask::print(tty, nm, msg);
     }
     nm->post_compiled_method_load_event();
+#ifdef LINUX
+    if (WriteJitDump) {
+      JitDump::write_nmethod(nm);
+    }
+#endif
   }
 }
 
@@ -1722,6 +1722,14 @@ size_t ObjectSynchronizer::deflate_idle_monitors() {
   OM_PERFDATA_OP(MonExtant, set_value(_in_use_list.count()));
   OM_PERFDATA_OP(Deflations, inc(deflated_count));
 
+  if (deflated_count >= (size_t)MonitorDeflationMax && current->is_monitor_deflation_thread()) {
+    // The in-use list was only partially processed, so there are likely more
+    // idle ObjectMonitors. Deflate the next chunk right away instead of waiting
+    // for the next interval, so the in-use list does not keep growing.
+    log_info(monitorinflation)("Async deflation reached MonitorDeflationMax, continuing with the next chunk");
+    set_is_async_deflation_requested(true);
+  }
+
   GVars.stw_random = os::random();
 
   if (deflated_count != 0) {
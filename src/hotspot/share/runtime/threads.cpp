@@ -26,6 +26,7 @@
 #include "precompiled.hpp"
 #include "cds/cds_globals.hpp"
 #include "cds/metaspaceShared.hpp"
+#include "classfile/backgroundClassLinker.hpp"
 #include "classfile/classLoader.hpp"
 #include "classfile/javaClasses.hpp"
 #include "classfile/javaThreadStatus.hpp"
@@ -777,6 +778,9 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
 
   JFR_ONLY(Jfr::on_create_vm_3();)
 
+  // Start verifying the application classes early, once the system class loader is set up.
+  BackgroundClassLinker::initialize();
+
 #if INCLUDE_MANAGEMENT
   Management::initialize(THREAD);
 
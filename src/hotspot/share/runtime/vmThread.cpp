@@ -49,6 +49,7 @@
 #include "runtime/vmOperations.hpp"
 #include "utilities/dtrace.hpp"
 #include "utilities/events.hpp"
+#include "utilities/hardwareCounters.hpp"
 #include "utilities/vmError.hpp"
 
 
@@ -277,12 +278,25 @@ void VMThread::evaluate_operation(VM_Operation* op) {
                      (char *) op->name(), strlen(op->name()),
                      op->evaluate_at_safepoint() ? 0 : 1);
 
+    LogTarget(Info, vmoperation, perf) lt;
+    HardwareCounters hw_counters;
+    if (lt.is_enabled()) {
+      hw_counters.start();
+    }
+
     EventExecuteVMOperation event;
     op->evaluate();
     if (event.should_commit()) {
       post_vm_operation_event(&event, op);
     }
 
+    if (hw_counters.is_active()) {
+      LogStream ls(lt);
+      ls.print("%s", op->name());
+      hw_counters.print_on(&ls);
+      ls.cr();
+    }
+
     HOTSPOT_VMOPS_END(
                      (char *) op->name(), strlen(op->name()),
                      op->evaluate_at_safepoint() ? 0 : 1);
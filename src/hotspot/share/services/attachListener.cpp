@@ -34,11 +34,13 @@
 #include "prims/jvmtiAgentList.hpp"
 #include "prims/jvmtiExport.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/flags/jvmFlag.hpp"
 #include "runtime/globals.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/java.hpp"
 #include "runtime/javaCalls.hpp"
+#include "runtime/javaThread.hpp"
 #include "runtime/os.hpp"
 #include "runtime/vmOperations.hpp"
 #include "services/attachListener.hpp"
@@ -371,6 +373,91 @@ static AttachOperationFunctionInfo funcs[] = {
 
 
 
+// Looks up the function for the operation, runs it and sends the result and
+// output to the client.
+static void execute_operation(AttachOperation* op) {
+  ResourceMark rm;
+  bufferedStream st;
+  jint res = JNI_OK;
+
+  // handle special detachall operation
+  if (strcmp(op->name(), AttachOperation::detachall_operation_name()) == 0) {
+    AttachListener::detachall();
+  } else {
+    // find the function to dispatch too
+    AttachOperationFunctionInfo* info = nullptr;
+    for (int i=0; funcs[i].name != nullptr; i++) {
+      const char* name = funcs[i].name;
+      assert(strlen(name) <= AttachOperation::name_length_max, "operation <= name_length_max");
+      if (strcmp(op->name(), name) == 0) {
+        info = &(funcs[i]);
+        break;
+      }
+    }
+
+    // check for platform dependent attach operation
+    if (info == nullptr) {
+      info = AttachListener::pd_find_operation(op->name());
+    }
+
+    if (info != nullptr) {
+      // dispatch to the function that implements this operation
+      res = (info->func)(op, &st);
+    } else {
+      st.print("Operation %s not recognized!", op->name());
+      res = JNI_ERR;
+    }
+  }
+
+  // operation complete - send result and output to client
+  op->complete(res, &st);
+}
+
+// Diagnostic commands can take long, for example GC.class_histogram on a large
+// heap. So that they do not hold up the operations queued behind them, jcmd
+// operations run on a worker thread of their own. Diagnostic commands already
+// run concurrently when invoked through the DiagnosticCommand MBean. When
+// max_jcmd_workers are busy, or a worker cannot be started, the operation runs
+// on the Attach Listener thread as before.
+static const int max_jcmd_workers = 4;
+static volatile int _jcmd_workers = 0;
+
+class AttachWorkerThread : public JavaThread {
+ private:
+  AttachOperation* const _op;
+
+  static void thread_entry(JavaThread* thread, TRAPS) {
+    AttachWorkerThread* const worker = static_cast<AttachWorkerThread*>(thread);
+    execute_operation(worker->_op);
+    Atomic::dec(&_jcmd_workers);
+  }
+
+ public:
+  AttachWorkerThread(AttachOperation* op) : JavaThread(&thread_entry), _op(op) {}
+};
+
+static bool start_jcmd_worker(AttachOperation* op, TRAPS) {
+  if (Atomic::add(&_jcmd_workers, 1) > max_jcmd_workers) {
+    Atomic::dec(&_jcmd_workers);
+    return false;
+  }
+  Handle thread_oop = JavaThread::create_system_thread_object("Attach Listener Worker", THREAD);
+  if (HAS_PENDING_EXCEPTION) {
+    CLEAR_PENDING_EXCEPTION;
+    Atomic::dec(&_jcmd_workers);
+    return false;
+  }
+  AttachWorkerThread* const worker = new AttachWorkerThread(op);
+  if (worker->osthread() == nullptr) {
+    // The new thread is not known to Thread-SMR yet so we can just delete.
+    delete worker;
+    Atomic::dec(&_jcmd_workers);
+    return false;
+  }
+  JavaThread::start_internal_daemon(THREAD, worker, thread_oop, NoPriority);
+  return true;
+}
+
 // The Attach Listener threads services a queue. It dequeues an operation
 // from the queue, examines the operation name (command), and dispatches
 // to the corresponding function to perform the operation.
@@ -395,41 +482,10 @@ static void attach_listener_thread_entry(JavaThread* thread, TRAPS) {
       return;   // dequeue failed or shutdown
     }
 
-    ResourceMark rm;
-    bufferedStream st;
-    jint res = JNI_OK;
-
-    // handle special detachall operation
-    if (strcmp(op->name(), AttachOperation::detachall_operation_name()) == 0) {
-      AttachListener::detachall();
-    } else {
-      // find the function to dispatch too
-      AttachOperationFunctionInfo* info = nullptr;
-      for (int i=0; funcs[i].name != nullptr; i++) {
-        const char* name = funcs[i].name;
-        assert(strlen(name) <= AttachOperation::name_length_max, "operation <= name_length_max");
-        if (strcmp(op->name(), name) == 0) {
-          info = &(funcs[i]);
-          break;
-        }
-      }
-
-      // check for platform dependent attach operation
-      if (info == nullptr) {
-        info = AttachListener::pd_find_operation(op->name());
-      }
-
-      if (info != nullptr) {
-        // dispatch to the function that implements this operation
-        res = (info->func)(op, &st);
-      } else {
-        st.print("Operation %s not recognized!", op->name());
-        res = JNI_ERR;
-      }
+    if (strcmp(op->name(), "jcmd") == 0 && start_jcmd_worker(op, THREAD)) {
+      continue;
     }
-
-    // operation complete - send result and output to client
-    op->complete(res, &st);
+    execute_operation(op);
   }
 
   ShouldNotReachHere();
@@ -46,16 +46,20 @@
 #include "runtime/fieldDescriptor.inline.hpp"
 #include "runtime/flags/jvmFlag.hpp"
 #include "runtime/handles.inline.hpp"
+#include "runtime/handshake.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/javaCalls.hpp"
 #include "runtime/jniHandles.hpp"
+#include "runtime/nonJavaThread.hpp"
 #include "runtime/os.hpp"
+#include "runtime/threadSMR.inline.hpp"
 #include "runtime/vmOperations.hpp"
 #include "runtime/vm_version.hpp"
 #include "services/diagnosticArgument.hpp"
 #include "services/diagnosticCommand.hpp"
 #include "services/diagnosticFramework.hpp"
 #include "services/heapDumper.hpp"
+#include "services/heapDumperCompression.hpp"
 #include "services/management.hpp"
 #include "services/nmtDCmd.hpp"
 #include "services/writeableFlags.hpp"
@@ -63,6 +67,9 @@
 #include "utilities/events.hpp"
 #include "utilities/formatBuffer.hpp"
 #include "utilities/macros.hpp"
+#if INCLUDE_EPSILONGC
+#include "gc/epsilon/epsilonArenaDCmd.hpp"
+#endif
 #ifdef LINUX
 #include "trimCHeapDCmd.hpp"
 #include "mallocInfoDcmd.hpp"
@@ -102,6 +109,9 @@ void DCmd::register_dcmds(){
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<RunFinalizationDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<HeapInfoDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<FinalizerInfoDCmd>(full_export, true, false));
+#if INCLUDE_EPSILONGC
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<EpsilonArenaDCmd>(full_export, UseEpsilonGC && EpsilonArenas, false));
+#endif // INCLUDE_EPSILONGC
 #if INCLUDE_SERVICES
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<HeapDumpDCmd>(DCmd_Source_Internal | DCmd_Source_AttachAPI, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ClassHistogramDCmd>(full_export, true, false));
@@ -469,11 +479,21 @@ HeapDumpDCmd::HeapDumpDCmd(outputStream* output, bool heap) :
                "using the given compression level. 1 (recommended) is the fastest, "
                "9 the strongest compression.", "INT", false, "1"),
   _overwrite("-overwrite", "If specified, the dump file will be overwritten if it exists",
-           "BOOLEAN", false, "false") {
+           "BOOLEAN", false, "false"),
+  _compressor("-compressor", "The compression format used with -gz: gzip, zstd or lz4. "
+                             "zstd and lz4 need the corresponding library to be installed.",
+              "STRING", false, "gzip"),
+  _parallel("-parallel", "Number of parallel threads to use for heap dumping. "
+                         "1 (the default) means use one thread. "
+                         "For any other value the VM will try to use the specified number of "
+                         "threads, but might use fewer.",
+            "INT", false, "1") {
   _dcmdparser.add_dcmd_option(&_all);
   _dcmdparser.add_dcmd_argument(&_filename);
   _dcmdparser.add_dcmd_option(&_gzip);
   _dcmdparser.add_dcmd_option(&_overwrite);
+  _dcmdparser.add_dcmd_option(&_compressor);
+  _dcmdparser.add_dcmd_option(&_parallel);
 }
 
 void HeapDumpDCmd::execute(DCmdSource source, TRAPS) {
@@ -488,11 +508,23 @@ void HeapDumpDCmd::execute(DCmdSource source, TRAPS) {
     }
   }
 
+  if (!AbstractCompressor::is_valid_name(_compressor.value())) {
+    output()->print_cr("Unknown compression format (gzip, zstd or lz4): %s", _compressor.value());
+    return;
+  }
+
+  jlong num = _parallel.value();
+  if (num < 1) {
+    output()->print_cr("Parallel thread number out of range (>=1): " JLONG_FORMAT, num);
+    return;
+  }
+
   // Request a full GC before heap dump if _all is false
   // This helps reduces the amount of unreachable objects in the dump
   // and makes it easier to browse.
   HeapDumper dumper(!_all.value() /* request GC if _all is false*/);
-  dumper.dump(_filename.value(), output(), (int) level, _overwrite.value());
+  dumper.dump(_filename.value(), output(), (int) level, _overwrite.value(), (uint) num,
+              _compressor.value(), num > 1 /* segmented */);
 }
 
 ClassHistogramDCmd::ClassHistogramDCmd(outputStream* output, bool heap) :
@@ -530,12 +562,60 @@ void ClassHistogramDCmd::execute(DCmdSource source, TRAPS) {
 ThreadDumpDCmd::ThreadDumpDCmd(outputStream* output, bool heap) :
                                DCmdWithParser(output, heap),
   _locks("-l", "print java.util.concurrent locks", "BOOLEAN", false, "false"),
-  _extended("-e", "print extended thread information", "BOOLEAN", false, "false") {
+  _extended("-e", "print extended thread information", "BOOLEAN", false, "false"),
+  _handshake("-handshake", "print each thread in its own handshake instead of in a single safepoint. "
+             "The threads are not printed at the same point in time, and -l and deadlock "
+             "detection are not available", "BOOLEAN", false, "false") {
   _dcmdparser.add_dcmd_option(&_locks);
   _dcmdparser.add_dcmd_option(&_extended);
+  _dcmdparser.add_dcmd_option(&_handshake);
+}
+
+class PrintThreadHandshakeClosure : public HandshakeClosure {
+  outputStream* _out;
+  bool _print_extended_info;
+ public:
+  PrintThreadHandshakeClosure(outputStream* out, bool print_extended_info)
+    : HandshakeClosure("PrintThread"), _out(out), _print_extended_info(print_extended_info) {}
+
+  void do_thread(Thread* thread) {
+    JavaThread* jt = JavaThread::cast(thread);
+    ResourceMark rm;
+    jt->print_on(_out, _print_extended_info);
+    jt->print_stack_on(_out);
+    _out->cr();
+  }
+};
+
+// Only one thread at a time is stopped, so the pause does not grow with the
+// number of threads and no snapshots of all threads need to be kept.
+void ThreadDumpDCmd::print_threads_with_handshakes() {
+  char buf[32];
+  output()->print_raw_cr(os::local_time_string(buf, sizeof(buf)));
+  output()->print_cr("Full thread dump %s (%s %s), threads printed one at a time:",
+                     VM_Version::vm_name(),
+                     VM_Version::vm_release(),
+                     VM_Version::vm_info_string());
+  output()->cr();
+
+  ThreadsListHandle tlh;
+  for (uint i = 0; i < tlh.list()->length(); i++) {
+    PrintThreadHandshakeClosure cl(output(), _extended.value());
+    Handshake::execute(&cl, &tlh, tlh.list()->thread_at(i));
+  }
+
+  for (NonJavaThread::Iterator njti; !njti.end(); njti.step()) {
+    njti.current()->print_on(output());
+    output()->cr();
+  }
 }
 
 void ThreadDumpDCmd::execute(DCmdSource source, TRAPS) {
+  if (_handshake.value()) {
+    print_threads_with_handshakes();
+    return;
+  }
+
   // thread stacks and JNI global handles
   VM_PrintThreads op1(output(), _locks.value(), _extended.value(), true /* print JNI handle info */);
   VMThread::execute(&op1);
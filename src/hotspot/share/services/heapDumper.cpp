@@ -625,6 +625,9 @@ class DumpWriter : public AbstractDumpWriter {
 
   char const* error() const override    { return _backend.error(); }
 
+  // Returns true if the written data is compressed.
+  bool is_compressed() const            { return _backend.is_compressed(); }
+
   // Called by threads used for parallel writing.
   void writer_loop()                    { _backend.thread_loop(); }
   // Called when finish to release the threads.
@@ -1930,6 +1933,13 @@ class VM_HeapDumper : public VM_GC_Operation, public WorkerTask {
   DumperController*       _dumper_controller;
   ParallelObjectIterator* _poi;
   HeapDumpLargeObjectList* _large_object_list;
+  // segmented heap dump support
+  const char*             _path;
+  const char*             _compressor_name;
+  int                     _compression;
+  bool                    _segmented;
+  uint                    _num_segments;
+  char const* volatile    _segment_error;
 
   // VMDumperType is for thread that dumps both heap and non-heap data.
   static const size_t VMDumperType = 0;
@@ -1971,7 +1981,12 @@ class VM_HeapDumper : public VM_GC_Operation, public WorkerTask {
     }
     // Prepare parallel writer.
     if (_num_dumper_threads > 1) {
-      ParDumpWriter::before_work();
+      if (_segmented) {
+        // Each heap-only dumper thread writes a segment file of its own.
+        _num_segments = _num_dumper_threads - 1;
+      } else {
+        ParDumpWriter::before_work();
+      }
       // Number of dumper threads that only iterate heap.
       uint _heap_only_dumper_threads = _num_dumper_threads - 1 /* VMDumper thread */;
       _dumper_controller = new (std::nothrow) DumperController(_heap_only_dumper_threads);
@@ -1979,11 +1994,20 @@ class VM_HeapDumper : public VM_GC_Operation, public WorkerTask {
   }
 
   void finish_parallel_dump() {
-    if (_num_dumper_threads > 1) {
+    if (_num_dumper_threads > 1 && !_segmented) {
       ParDumpWriter::after_work();
     }
   }
 
+  void set_segment_error(char const* error) {
+    if (error != nullptr) {
+      Atomic::cmpxchg(&_segment_error, (char const*)nullptr, error);
+    }
+  }
+
+  // Dumps this dumper thread's part of the heap to its own segment file.
+  void dump_heap_segment(uint worker_id);
+
   // accessors and setters
   static VM_HeapDumper* dumper()         {  assert(_global_dumper != nullptr, "Error"); return _global_dumper; }
   static DumpWriter* writer()            {  assert(_global_writer != nullptr, "Error"); return _global_writer; }
@@ -2021,7 +2045,11 @@ class VM_HeapDumper : public VM_GC_Operation, public WorkerTask {
   void dump_large_objects(ObjectClosure* writer);
 
  public:
-  VM_HeapDumper(DumpWriter* writer, bool gc_before_heap_dump, bool oome, uint num_dump_threads) :
+  // If segmented is true, parallel dumper threads write their part of the heap into
+  // separate segment files next to 'path', which are merged by merge_segments().
+  VM_HeapDumper(DumpWriter* writer, bool gc_before_heap_dump, bool oome, uint num_dump_threads,
+                const char* path = nullptr, const char* compressor_name = nullptr,
+                int compression = -1, bool segmented = false) :
     VM_GC_Operation(0 /* total collections,      dummy, ignored */,
                     GCCause::_heap_dump /* GC Cause */,
                     0 /* total full collections, dummy, ignored */,
@@ -2036,6 +2064,12 @@ class VM_HeapDumper : public VM_GC_Operation, public WorkerTask {
     _dumper_controller = nullptr;
     _poi = nullptr;
     _large_object_list = new (std::nothrow) HeapDumpLargeObjectList();
+    _path = path;
+    _compressor_name = compressor_name;
+    _compression = compression;
+    _segmented = segmented && path != nullptr;
+    _num_segments = 0;
+    _segment_error = nullptr;
     if (oome) {
       assert(!Thread::current()->is_VM_thread(), "Dump from OutOfMemoryError cannot be called by the VMThread");
       // get OutOfMemoryError zero-parameter constructor
@@ -2069,6 +2103,18 @@ class VM_HeapDumper : public VM_GC_Operation, public WorkerTask {
   virtual bool doit_prologue();
   void doit();
   void work(uint worker_id);
+
+  // Returns the path of the segment file written by the given dumper.
+  static void segment_path(const char* path, uint segment, char* buf, size_t buf_len) {
+    jio_snprintf(buf, buf_len, "%s.p%u", path, segment);
+  }
+
+  // Appends the segment files to the dump file, removes them and writes
+  // the HPROF_HEAP_DUMP_END record. Must be called after the operation
+  // finished. Returns null on success and an error message otherwise.
+  char const* merge_segments(julong* bytes_written);
+
+  uint num_segments() const { return _num_segments; }
 };
 
 VM_HeapDumper* VM_HeapDumper::_global_dumper = nullptr;
@@ -2308,6 +2354,9 @@ void VM_HeapDumper::doit() {
     _num_writer_threads=1;
     work(0);
   } else {
+    // Compression is CPU bound, use all workers to compress in parallel.
+    uint num_workers = writer()->is_compressed() ? workers->max_workers() : workers->active_workers();
+    WithActiveWorkers with_active_workers(workers, num_workers);
     prepare_parallel_dump(workers->active_workers());
     if (_num_dumper_threads > 1) {
       ParallelObjectIterator poi(_num_dumper_threads);
@@ -2333,8 +2382,19 @@ void VM_HeapDumper::work(uint worker_id) {
     }
     if (_num_dumper_threads > 1 && get_worker_type(worker_id) == DumperType) {
       _dumper_controller->wait_for_start_signal();
+      if (_segmented) {
+        dump_heap_segment(worker_id);
+        _dumper_controller->dumper_complete();
+        return;
+      }
     }
   } else {
+    if (_num_dumper_threads > 1 && _segmented) {
+      // Segment files are independent of the main file, so the dumper
+      // threads can iterate the heap while the non-heap data is written.
+      _dumper_controller->start_dump();
+    }
+
     // The worker 0 on all non-heap data dumping and part of heap iteration.
     // Write the file header - we always use 1.0.2
     const char* header = "JAVA PROFILE 1.0.2";
@@ -2389,6 +2449,16 @@ void VM_HeapDumper::work(uint worker_id) {
     ResourceMark rm;
     HeapObjectDumper obj_dumper(writer());
     Universe::heap()->object_iterate(&obj_dumper);
+  } else if (_segmented) {
+    assert(get_worker_type(worker_id) == VMDumperType, "must be");
+    // The DumperType threads write to their segment files, so this
+    // thread can write its part of the heap to the main file directly.
+    {
+      ResourceMark rm;
+      HeapObjectDumper obj_dumper(writer(), _large_object_list);
+      _poi->object_iterate(&obj_dumper, worker_id);
+    }
+    _dumper_controller->wait_all_dumpers_complete();
   } else {
     assert(get_worker_type(worker_id) == DumperType
           || get_worker_type(worker_id) == VMDumperType,
@@ -2427,12 +2497,109 @@ void VM_HeapDumper::work(uint worker_id) {
   ResourceMark rm;
   HeapObjectDumper obj_dumper(writer());
   dump_large_objects(&obj_dumper);
-  // Writes the HPROF_HEAP_DUMP_END record.
-  DumperSupport::end_of_dump(writer());
+  if (_num_segments > 0) {
+    // The HPROF_HEAP_DUMP_END record is written after the segments are merged.
+    writer()->finish_dump_segment();
+  } else {
+    // Writes the HPROF_HEAP_DUMP_END record.
+    DumperSupport::end_of_dump(writer());
+  }
   // We are done with writing. Release the worker threads.
   writer()->deactivate();
 }
 
+void VM_HeapDumper::dump_heap_segment(uint worker_id) {
+  char path[JVM_MAXPATHLEN];
+  segment_path(_path, worker_id, path, sizeof(path));
+
+  AbstractCompressor* compressor = nullptr;
+  if (_compression > 0) {
+    compressor = AbstractCompressor::create(_compressor_name, _compression);
+    if (compressor == nullptr) {
+      set_segment_error("Could not allocate compressor");
+    }
+  }
+
+  // The backend has no writer threads, so this thread compresses and
+  // writes its own buffers.
+  DumpWriter segment_writer(new (std::nothrow) FileWriter(path, true /* overwrite */), compressor);
+  if (segment_writer.error() == nullptr) {
+    ResourceMark rm;
+    HeapObjectDumper obj_dumper(&segment_writer, _large_object_list);
+    _poi->object_iterate(&obj_dumper, worker_id);
+    segment_writer.finish_dump_segment();
+  }
+  set_segment_error(segment_writer.error());
+  segment_writer.deactivate();
+}
+
+char const* VM_HeapDumper::merge_segments(julong* bytes_written) {
+  const size_t buf_size = 1 * M;
+  char* buf = (char*)os::malloc(buf_size, mtInternal);
+  char const* err = Atomic::load(&_segment_error);
+
+  if (buf == nullptr && err == nullptr) {
+    err = "Could not allocate buffer for merging";
+  }
+
+  int out_fd = -1;
+  if (err == nullptr) {
+    out_fd = os::open(_path, O_WRONLY | O_APPEND | O_BINARY, 0);
+    if (out_fd < 0) {
+      err = os::strerror(errno);
+    }
+  }
+
+  // Segment ids are the worker ids of the heap-only dumper threads.
+  for (uint segment = 1; segment <= _num_segments; segment++) {
+    char path[JVM_MAXPATHLEN];
+    segment_path(_path, segment, path, sizeof(path));
+
+    if (err == nullptr) {
+      int in_fd = os::open(path, O_RDONLY | O_BINARY, 0);
+      if (in_fd < 0) {
+        err = os::strerror(errno);
+      } else {
+        ssize_t n;
+        while ((n = os::read(in_fd, buf, buf_size)) > 0) {
+          if (!os::write(out_fd, buf, (size_t)n)) {
+            err = os::strerror(errno);
+            break;
+          }
+          *bytes_written += (julong)n;
+        }
+        if (n < 0 && err == nullptr) {
+          err = os::strerror(errno);
+        }
+        ::close(in_fd);
+      }
+    }
+    remove(path);
+  }
+
+  if (out_fd >= 0) {
+    ::close(out_fd);
+  }
+  os::free(buf);
+
+  if (err == nullptr) {
+    AbstractCompressor* compressor = nullptr;
+    if (_compression > 0) {
+      compressor = AbstractCompressor::create(_compressor_name, _compression);
+    }
+    DumpWriter end_writer(new (std::nothrow) FileWriter(_path, false, true /* append */), compressor);
+    if (end_writer.error() == nullptr) {
+      // Writes the HPROF_HEAP_DUMP_END record.
+      DumperSupport::end_of_dump(&end_writer);
+    }
+    end_writer.deactivate();
+    *bytes_written += end_writer.bytes_written();
+    err = end_writer.error();
+  }
+
+  return err;
+}
+
 void VM_HeapDumper::dump_stack_traces() {
   // write a HPROF_TRACE record without any frames to be referenced as object alloc sites
   DumperSupport::write_header(writer(), HPROF_TRACE, 3*sizeof(u4));
@@ -2497,7 +2664,8 @@ void VM_HeapDumper::dump_large_objects(ObjectClosure* cl) {
 }
 
 // dump the heap to given path.
-int HeapDumper::dump(const char* path, outputStream* out, int compression, bool overwrite, uint num_dump_threads) {
+int HeapDumper::dump(const char* path, outputStream* out, int compression, bool overwrite,
+                     uint num_dump_threads, const char* compressor_name, bool segmented) {
   assert(path != nullptr && strlen(path) > 0, "path missing");
 
   // print message in interactive case
@@ -2511,10 +2679,10 @@ int HeapDumper::dump(const char* path, outputStream* out, int compression, bool
   AbstractCompressor* compressor = nullptr;
 
   if (compression > 0) {
-    compressor = new (std::nothrow) GZipCompressor(compression);
+    compressor = AbstractCompressor::create(compressor_name, compression);
 
     if (compressor == nullptr) {
-      set_error("Could not allocate gzip compressor");
+      set_error("Could not allocate compressor");
       return -1;
     }
   }
@@ -2531,7 +2699,8 @@ int HeapDumper::dump(const char* path, outputStream* out, int compression, bool
   }
 
   // generate the dump
-  VM_HeapDumper dumper(&writer, _gc_before_heap_dump, _oome, num_dump_threads);
+  VM_HeapDumper dumper(&writer, _gc_before_heap_dump, _oome, num_dump_threads,
+                       path, compressor_name, compression, segmented);
   if (Thread::current()->is_VM_thread()) {
     assert(SafepointSynchronize::is_at_safepoint(), "Expected to be called at a safepoint");
     dumper.doit();
@@ -2542,11 +2711,17 @@ int HeapDumper::dump(const char* path, outputStream* out, int compression, bool
   // record any error that the writer may have encountered
   set_error(writer.error());
 
+  // append the segment files, outside of the safepoint if possible
+  julong bytes_written = writer.bytes_written();
+  if (error() == nullptr && dumper.num_segments() > 0) {
+    set_error(dumper.merge_segments(&bytes_written));
+  }
+
   // emit JFR event
   if (error() == nullptr) {
     event.set_destination(path);
     event.set_gcBeforeDump(_gc_before_heap_dump);
-    event.set_size(writer.bytes_written());
+    event.set_size(bytes_written);
     event.set_onOutOfMemoryError(_oome);
     event.set_overwrite(overwrite);
     event.set_compression(compression);
@@ -2560,13 +2735,13 @@ int HeapDumper::dump(const char* path, outputStream* out, int compression, bool
     timer()->stop();
     if (error() == nullptr) {
       out->print_cr("Heap dump file created [" JULONG_FORMAT " bytes in %3.3f secs]",
-                    writer.bytes_written(), timer()->seconds());
+                    bytes_written, timer()->seconds());
     } else {
-      out->print_cr("Dump file is incomplete: %s", writer.error());
+      out->print_cr("Dump file is incomplete: %s", error());
     }
   }
 
-  return (writer.error() == nullptr) ? 0 : -1;
+  return (error() == nullptr) ? 0 : -1;
 }
 
 // stop timer (if still active), and free any error string we might be holding
@@ -70,9 +70,13 @@ class HeapDumper : public StackObj {
 
   // dumps the heap to the specified file, returns 0 if success.
   // additional info is written to out if not null.
-  // compression >= 0 creates a gzipped file with the given compression level.
+  // compression >= 0 creates a compressed file with the given compression level.
   // parallel_thread_num >= 0 indicates thread numbers of parallel object dump
-  int dump(const char* path, outputStream* out = nullptr, int compression = -1, bool overwrite = false, uint parallel_thread_num = 1);
+  // compressor is the compression format: "gzip", "zstd" or "lz4".
+  // segmented lets parallel dumper threads write to separate segment files,
+  // which are appended to the dump file once the heap has been iterated.
+  int dump(const char* path, outputStream* out = nullptr, int compression = -1, bool overwrite = false,
+           uint parallel_thread_num = 1, const char* compressor = "gzip", bool segmented = false);
 
   // returns error message (resource allocated), or null if no error
   char* error_as_C_string() const;
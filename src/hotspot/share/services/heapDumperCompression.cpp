@@ -35,7 +35,11 @@
 char const* FileWriter::open_writer() {
   assert(_fd < 0, "Must not already be open");
 
-  _fd = os::create_binary_file(_path, _overwrite);
+  if (_append) {
+    _fd = os::open(_path, O_WRONLY | O_APPEND | O_BINARY, 0);
+  } else {
+    _fd = os::create_binary_file(_path, _overwrite);
+  }
 
   if (_fd < 0) {
     return os::strerror(errno);
@@ -135,6 +139,149 @@ char const* GZipCompressor::compress(char* in, size_t in_size, char* out, size_t
   return msg;
 }
 
+
+// Loads 'name' from the first of the given system libraries that can be found.
+static void* load_system_library_func(char const* const* lib_names, char const* name) {
+  char ebuf[1024];
+  MutexLocker locker(Zip_lock, Monitor::_no_safepoint_check_flag);
+
+  for (int i = 0; lib_names[i] != nullptr; i++) {
+    void* handle = os::dll_load(lib_names[i], ebuf, sizeof ebuf);
+
+    if (handle != nullptr) {
+      return os::dll_lookup(handle, name);
+    }
+  }
+
+  return nullptr;
+}
+
+static char const* const zstd_lib_names[] = {
+#if defined(_WINDOWS)
+  "libzstd.dll", "zstd.dll",
+#elif defined(__APPLE__)
+  "libzstd.1.dylib", "libzstd.dylib",
+#else
+  "libzstd.so.1", "libzstd.so",
+#endif
+  nullptr
+};
+
+typedef size_t (*ZstdCompressBoundFunc)(size_t);
+typedef size_t (*ZstdCompressFunc)(void*, size_t, const void*, size_t, int);
+typedef unsigned (*ZstdIsErrorFunc)(size_t);
+typedef char const* (*ZstdGetErrorNameFunc)(size_t);
+
+static ZstdCompressBoundFunc zstd_compress_bound_func;
+static ZstdCompressFunc zstd_compress_func;
+static ZstdIsErrorFunc zstd_is_error_func;
+static ZstdGetErrorNameFunc zstd_get_error_name_func;
+
+char const* ZstdCompressor::init(size_t block_size, size_t* needed_out_size,
+                                 size_t* needed_tmp_size) {
+  if (zstd_compress_func == nullptr) {
+    zstd_compress_bound_func = (ZstdCompressBoundFunc) load_system_library_func(zstd_lib_names, "ZSTD_compressBound");
+    zstd_is_error_func = (ZstdIsErrorFunc) load_system_library_func(zstd_lib_names, "ZSTD_isError");
+    zstd_get_error_name_func = (ZstdGetErrorNameFunc) load_system_library_func(zstd_lib_names, "ZSTD_getErrorName");
+    ZstdCompressFunc compress_func = (ZstdCompressFunc) load_system_library_func(zstd_lib_names, "ZSTD_compress");
+
+    if (zstd_compress_bound_func == nullptr || zstd_is_error_func == nullptr ||
+        zstd_get_error_name_func == nullptr || compress_func == nullptr) {
+      return "Cannot load the zstd library";
+    }
+    zstd_compress_func = compress_func;
+  }
+
+  *needed_out_size = zstd_compress_bound_func(block_size);
+  *needed_tmp_size = 0;
+
+  return nullptr;
+}
+
+char const* ZstdCompressor::compress(char* in, size_t in_size, char* out, size_t out_size,
+                                     char* tmp, size_t tmp_size, size_t* compressed_size) {
+  size_t result = zstd_compress_func(out, out_size, in, in_size, _level);
+
+  if (zstd_is_error_func(result)) {
+    return zstd_get_error_name_func(result);
+  }
+
+  *compressed_size = result;
+  return nullptr;
+}
+
+static char const* const lz4_lib_names[] = {
+#if defined(_WINDOWS)
+  "liblz4.dll", "lz4.dll",
+#elif defined(__APPLE__)
+  "liblz4.1.dylib", "liblz4.dylib",
+#else
+  "liblz4.so.1", "liblz4.so",
+#endif
+  nullptr
+};
+
+// The preferences arguments are always null, which selects the default
+// (fastest) settings, so the LZ4F_preferences_t layout is not needed here.
+typedef size_t (*LZ4FCompressFrameBoundFunc)(size_t, const void*);
+typedef size_t (*LZ4FCompressFrameFunc)(void*, size_t, const void*, size_t, const void*);
+typedef unsigned (*LZ4FIsErrorFunc)(size_t);
+typedef char const* (*LZ4FGetErrorNameFunc)(size_t);
+
+static LZ4FCompressFrameBoundFunc lz4f_compress_frame_bound_func;
+static LZ4FCompressFrameFunc lz4f_compress_frame_func;
+static LZ4FIsErrorFunc lz4f_is_error_func;
+static LZ4FGetErrorNameFunc lz4f_get_error_name_func;
+
+char const* LZ4Compressor::init(size_t block_size, size_t* needed_out_size,
+                                size_t* needed_tmp_size) {
+  if (lz4f_compress_frame_func == nullptr) {
+    lz4f_compress_frame_bound_func = (LZ4FCompressFrameBoundFunc) load_system_library_func(lz4_lib_names, "LZ4F_compressFrameBound");
+    lz4f_is_error_func = (LZ4FIsErrorFunc) load_system_library_func(lz4_lib_names, "LZ4F_isError");
+    lz4f_get_error_name_func = (LZ4FGetErrorNameFunc) load_system_library_func(lz4_lib_names, "LZ4F_getErrorName");
+    LZ4FCompressFrameFunc compress_func = (LZ4FCompressFrameFunc) load_system_library_func(lz4_lib_names, "LZ4F_compressFrame");
+
+    if (lz4f_compress_frame_bound_func == nullptr || lz4f_is_error_func == nullptr ||
+        lz4f_get_error_name_func == nullptr || compress_func == nullptr) {
+      return "Cannot load the lz4 library";
+    }
+    lz4f_compress_frame_func = compress_func;
+  }
+
+  *needed_out_size = lz4f_compress_frame_bound_func(block_size, nullptr);
+  *needed_tmp_size = 0;
+
+  return nullptr;
+}
+
+char const* LZ4Compressor::compress(char* in, size_t in_size, char* out, size_t out_size,
+                                    char* tmp, size_t tmp_size, size_t* compressed_size) {
+  size_t result = lz4f_compress_frame_func(out, out_size, in, in_size, nullptr);
+
+  if (lz4f_is_error_func(result)) {
+    return lz4f_get_error_name_func(result);
+  }
+
+  *compressed_size = result;
+  return nullptr;
+}
+
+bool AbstractCompressor::is_valid_name(char const* name) {
+  return strcmp(name, "gzip") == 0 || strcmp(name, "zstd") == 0 || strcmp(name, "lz4") == 0;
+}
+
+AbstractCompressor* AbstractCompressor::create(char const* name, int level) {
+  if (strcmp(name, "gzip") == 0) {
+    return new (std::nothrow) GZipCompressor(level);
+  } else if (strcmp(name, "zstd") == 0) {
+    return new (std::nothrow) ZstdCompressor(level);
+  } else if (strcmp(name, "lz4") == 0) {
+    return new (std::nothrow) LZ4Compressor();
+  }
+
+  return nullptr;
+}
+
 WorkList::WorkList() {
   _head._next = &_head;
   _head._prev = &_head;
@@ -42,6 +42,14 @@ public:
   // message otherwise. Sets the 'compressed_size'.
   virtual char const* compress(char* in, size_t in_size, char* out, size_t out_size,
                                char* tmp, size_t tmp_size, size_t* compressed_size) = 0;
+
+  // Returns true if 'name' is the name of a supported compression format.
+  static bool is_valid_name(char const* name);
+
+  // Creates the compressor for the format 'name' ("gzip", "zstd" or "lz4")
+  // with the given level. Returns null if the name is unknown or the
+  // allocation failed.
+  static AbstractCompressor* create(char const* name, int level);
 };
 
 // Interface for a writer implementation.
@@ -62,10 +70,13 @@ class FileWriter : public AbstractWriter {
 private:
   char const* _path;
   bool _overwrite;
+  bool _append;
   int _fd;
 
 public:
-  FileWriter(char const* path, bool overwrite) : _path(path), _overwrite(overwrite), _fd(-1) { }
+  // If append is true the data is added to the end of an existing file.
+  FileWriter(char const* path, bool overwrite, bool append = false) :
+    _path(path), _overwrite(overwrite), _append(append), _fd(-1) { }
 
   ~FileWriter();
 
@@ -98,6 +109,41 @@ public:
 };
 
 
+// A compressor using the zstd format. Each block is written as an
+// independent zstd frame; zstd decoders handle concatenated frames.
+// Requires the zstd library to be installed on the system.
+class ZstdCompressor : public AbstractCompressor {
+private:
+  int _level;
+
+public:
+  ZstdCompressor(int level) : _level(level) {
+  }
+
+  virtual char const* init(size_t block_size, size_t* needed_out_size,
+                           size_t* needed_tmp_size);
+
+  virtual char const* compress(char* in, size_t in_size, char* out, size_t out_size,
+                               char* tmp, size_t tmp_size, size_t* compressed_size);
+};
+
+
+// A compressor using the lz4 frame format. Each block is written as an
+// independent lz4 frame; lz4 decoders handle concatenated frames.
+// Requires the lz4 library to be installed on the system.
+class LZ4Compressor : public AbstractCompressor {
+public:
+  LZ4Compressor() {
+  }
+
+  virtual char const* init(size_t block_size, size_t* needed_out_size,
+                           size_t* needed_tmp_size);
+
+  virtual char const* compress(char* in, size_t in_size, char* out, size_t out_size,
+                               char* tmp, size_t tmp_size, size_t* compressed_size);
+};
+
+
 // The data needed to write a single buffer (and compress it optionally).
 struct WriteWork {
   // The id of the work.
@@ -221,6 +267,8 @@ public:
 
   char const* error() const { return _err; }
 
+  bool is_compressed() const { return _compressor != nullptr; }
+
   // Sets up an internal buffer, fills with external buffer, and sends to compressor.
   void flush_external_buffer(char* buffer, size_t used, size_t max);
 
@@ -164,6 +164,9 @@ MallocSite* MallocSiteTable::lookup_or_add(const NativeCallStack& key, uint32_t*
 
 // Access malloc site
 MallocSite* MallocSiteTable::malloc_site(uint32_t marker) {
+  if (marker == unsampled_marker) {
+    return nullptr;
+  }
   uint16_t bucket_idx = bucket_idx_from_marker(marker);
   assert(bucket_idx < table_size, "Invalid bucket index");
   const uint16_t pos_idx = pos_idx_from_marker(marker);
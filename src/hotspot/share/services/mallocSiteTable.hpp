@@ -123,6 +123,10 @@ class MallocSiteTable : AllStatic {
   static uint16_t pos_idx_from_marker(uint32_t marker) { return marker & 0xFFFF; }
 
  public:
+  // Marker of an allocation whose call site was not sampled, see
+  // NativeMemoryTrackingSampleInterval. It never matches a table entry.
+  static const uint32_t unsampled_marker = 0xFFFFFFFF;
+  STATIC_ASSERT(MAX_MALLOCSITE_TABLE_SIZE < 0xFFFF);
 
   static bool initialize();
 
@@ -44,6 +44,8 @@
 #include "utilities/ostream.hpp"
 #include "utilities/vmError.hpp"
 
+#include <math.h>
+
 MallocMemorySnapshot MallocMemorySummary::_snapshot;
 
 void MemoryCounter::update_peak(size_t size, size_t cnt) {
@@ -136,6 +138,36 @@ bool MallocTracker::initialize(NMT_TrackingLevel level) {
   return true;
 }
 
+// Sampling state of the current thread. Malloc may be called by threads unknown
+// to the VM, so this cannot live in Thread.
+static THREAD_LOCAL size_t _bytes_until_sample = 0;
+static THREAD_LOCAL unsigned int _sample_seed = 0;
+
+// Draw the distance to the next sample from an exponential distribution with
+// the sample interval as mean, so that sampled bytes form a Poisson process and
+// every byte is equally likely to be sampled, whatever the allocation sizes.
+static void pick_next_sample() {
+  _sample_seed = (unsigned int)os::next_random(_sample_seed);
+  // In (0, 1].
+  const double u = ((double)_sample_seed + 1.0) / 2147483648.0;
+  _bytes_until_sample = (size_t)(-log(u) * (double)NativeMemoryTrackingSampleInterval) + 1;
+}
+
+bool MallocTracker::should_sample(size_t size) {
+  assert(NativeMemoryTrackingSampleInterval > 0, "sampling not enabled");
+  if (_sample_seed == 0) {
+    // First allocation of this thread.
+    _sample_seed = (unsigned int)(((uintptr_t)&_bytes_until_sample >> 3) & 0x3FFFFFFF) | 1;
+    pick_next_sample();
+  }
+  if (size < _bytes_until_sample) {
+    _bytes_until_sample -= size;
+    return false;
+  }
+  pick_next_sample();
+  return true;
+}
+
 // Record a malloc memory allocation
 void* MallocTracker::record_malloc(void* malloc_base, size_t size, MEMFLAGS flags,
   const NativeCallStack& stack)
@@ -146,7 +178,11 @@ void* MallocTracker::record_malloc(void* malloc_base, size_t size, MEMFLAGS flag
   MallocMemorySummary::record_malloc(size, flags);
   uint32_t mst_marker = 0;
   if (MemTracker::tracking_level() == NMT_detail) {
-    MallocSiteTable::allocation_at(stack, size, &mst_marker, flags);
+    if (NativeMemoryTrackingSampleInterval == 0 || should_sample(size)) {
+      MallocSiteTable::allocation_at(stack, size, &mst_marker, flags);
+    } else {
+      mst_marker = MallocSiteTable::unsampled_marker;
+    }
   }
 
   // Uses placement global new operator to initialize malloc header
@@ -272,6 +272,10 @@ class MallocTracker : AllStatic {
   // memblock = (char*)malloc_base + sizeof(nmt header)
   //
 
+  // With NativeMemoryTrackingSampleInterval set, decide whether the call site
+  // of an allocation of the given size is recorded.
+  static bool should_sample(size_t size);
+
   // Record  malloc on specified memory block
   static void* record_malloc(void* malloc_base, size_t size, MEMFLAGS flags,
     const NativeCallStack& stack);
@@ -26,6 +26,7 @@
 #include "memory/allocation.hpp"
 #include "memory/metaspace.hpp"
 #include "memory/metaspaceUtils.hpp"
+#include "runtime/globals.hpp"
 #include "services/mallocTracker.hpp"
 #include "services/memReporter.hpp"
 #include "services/threadStackTracker.hpp"
@@ -311,6 +312,10 @@ void MemDetailReporter::report_detail() {
   // Start detail report
   outputStream* out = output();
   out->print_cr("Details:\n");
+  if (NativeMemoryTrackingSampleInterval > 0) {
+    out->print_cr("(Malloc call sites are sampled, one in " SIZE_FORMAT " bytes allocated on average.)\n",
+                  NativeMemoryTrackingSampleInterval);
+  }
 
   int num_omitted =
       report_malloc_sites() +
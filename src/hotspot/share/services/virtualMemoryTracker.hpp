@@ -405,6 +405,10 @@ class VirtualMemoryTracker : AllStatic {
 
  private:
   static SortedLinkedList<ReservedMemoryRegion, compare_reserved_region_base>* _reserved_regions;
+  // Cache of the last region returned by find_reserved_region().
+  static ReservedMemoryRegion* _last_found_region;
+
+  static ReservedMemoryRegion* find_reserved_region(const ReservedMemoryRegion& rgn);
 };
 
 #endif // SHARE_SERVICES_VIRTUALMEMORYTRACKER_HPP
@@ -215,6 +215,18 @@ inline BitMap::idx_t BitMap::find_first_bit_impl(idx_t beg, idx_t end) const {
       idx_t word_limit = aligned_right
         ? to_words_align_down(end) // Minuscule savings when aligned.
         : to_words_align_up(end);
+      // Sparse bitmaps spend most of the search here, so first skip
+      // uninteresting words a block at a time.  The combined test is cheaper
+      // than a branch per word, and compilers can vectorize it.
+      const idx_t block_words = 4;
+      while (word_index + block_words < word_limit) {
+        const bm_word_t* words = _map + word_index + 1;
+        if (((words[0] ^ flip) | (words[1] ^ flip) |
+             (words[2] ^ flip) | (words[3] ^ flip)) != 0) {
+          break;
+        }
+        word_index += block_words;
+      }
       while (++word_index < word_limit) {
         cword = flipped_word(word_index, flip);
         if (cword != 0) {
@@ -325,10 +325,11 @@ class ConcurrentHashTable : public CHeapObj<F> {
   // Methods for growing.
   bool unzip_bucket(Thread* thread, InternalTable* old_table,
                     InternalTable* new_table, size_t even_index,
-                    size_t odd_index);
+                    size_t odd_index, bool is_mt);
   bool internal_grow_prolog(Thread* thread, size_t log2_size);
   void internal_grow_epilog(Thread* thread);
-  void internal_grow_range(Thread* thread, size_t start, size_t stop);
+  void internal_grow_range(Thread* thread, size_t start, size_t stop,
+                           bool is_mt = false);
   bool internal_grow(Thread* thread, size_t log2_size);
 
   // Get a value.
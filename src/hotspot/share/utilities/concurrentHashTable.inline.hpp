@@ -408,7 +408,7 @@ ConcurrentHashTable<CONFIG, F>::
 
 template <typename CONFIG, MEMFLAGS F>
 inline void ConcurrentHashTable<CONFIG, F>::
-  internal_grow_range(Thread* thread, size_t start, size_t stop)
+  internal_grow_range(Thread* thread, size_t start, size_t stop, bool is_mt)
 {
   assert(stop <= _table->_size, "Outside backing array");
   assert(_new_table != nullptr, "Grow not proper setup before start");
@@ -429,7 +429,7 @@ inline void ConcurrentHashTable<CONFIG, F>::
 
     // When this is done we have separated the nodes into corresponding buckets
     // in new table.
-    if (!unzip_bucket(thread, _table, _new_table, even_index, odd_index)) {
+    if (!unzip_bucket(thread, _table, _new_table, even_index, odd_index, is_mt)) {
       // If bucket is empty, unzip does nothing.
       // We must make sure readers go to new table before we poison the bucket.
       DEBUG_ONLY(GlobalCounter::write_synchronize();)
@@ -641,7 +641,8 @@ ConcurrentHashTable<CONFIG, F>::
 template <typename CONFIG, MEMFLAGS F>
 inline bool ConcurrentHashTable<CONFIG, F>::
   unzip_bucket(Thread* thread, InternalTable* old_table,
-               InternalTable* new_table, size_t even_index, size_t odd_index)
+               InternalTable* new_table, size_t even_index, size_t odd_index,
+               bool is_mt)
 {
   Node* aux = old_table->get_bucket(even_index)->first();
   if (aux == nullptr) {
@@ -686,8 +687,13 @@ inline bool ConcurrentHashTable<CONFIG, F>::
 
     // We can only move 1 pointer otherwise a reader might be moved to the wrong
     // chain. E.g. looking for even hash value but got moved to the odd bucket
-    // chain.
-    write_synchonize_on_visible_epoch(thread);
+    // chain. Several threads may be unzipping buckets at the same time, then
+    // the epoch of the resize lock owner cannot be used.
+    if (is_mt) {
+      GlobalCounter::write_synchronize();
+    } else {
+      write_synchonize_on_visible_epoch(thread);
+    }
     if (delete_me != nullptr) {
       Node::destroy_node(_context, delete_me);
       delete_me = nullptr;
@@ -195,7 +195,11 @@ class ConcurrentHashTable<CONFIG, F>::GrowTask :
   public BucketsOperation
 {
  public:
-  GrowTask(ConcurrentHashTable<CONFIG, F>* cht) : BucketsOperation(cht) {
+  // With is_mt, do_task may be called from several threads at once while the
+  // thread that called prepare holds the resize lock. The VM's own tables
+  // are still grown by a single thread, the ServiceThread.
+  GrowTask(ConcurrentHashTable<CONFIG, F>* cht, bool is_mt = false)
+    : BucketsOperation(cht, is_mt) {
   }
   // Before start prepare must be called.
   bool prepare(Thread* thread) {
@@ -215,7 +219,8 @@ class ConcurrentHashTable<CONFIG, F>::GrowTask :
     if (!this->claim(&start, &stop)) {
       return false;
     }
-    BucketsOperation::_cht->internal_grow_range(thread, start, stop);
+    BucketsOperation::_cht->internal_grow_range(thread, start, stop,
+                                                BucketsOperation::_is_mt);
     assert(BucketsOperation::_cht->_resize_lock_owner != nullptr,
            "Should be locked");
     return true;
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "logging/log.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/globals_extension.hpp"
+#include "utilities/hardwareCounters.hpp"
+#include "utilities/ostream.hpp"
+
+#if !defined(LINUX)
+bool NoHardwareCounters::initialize() {
+  log_info(os)("Hardware event counters not supported on this platform");
+  return false;
+}
+#endif
+
+volatile uint HardwareCounters::_worker_tasks = 0;
+
+void HardwareCounters::initialize() {
+  if (UsePerfEventCounters && !HardwareCountersDefault::initialize()) {
+    if (!FLAG_IS_DEFAULT(UsePerfEventCounters)) {
+      warning("UsePerfEventCounters specified, but not supported. Use -Xlog:os=info for details.");
+    }
+    FLAG_SET_ERGO(UsePerfEventCounters, false);
+  }
+}
+
+const char* HardwareCounters::event_name(HardwareCounterEvent event) {
+  switch (event) {
+    case HardwareCounterCycles:       return "cycles";
+    case HardwareCounterInstructions: return "instructions";
+    case HardwareCounterLLCMisses:    return "llc-misses";
+    case HardwareCounterDTLBMisses:   return "dtlb-misses";
+    default:
+      ShouldNotReachHere();
+      return nullptr;
+  }
+}
+
+void HardwareCounters::note_worker_task() {
+  if (UsePerfEventCounters) {
+    Atomic::inc(&_worker_tasks, memory_order_relaxed);
+  }
+}
+
+void HardwareCounters::start() {
+  assert(!_active, "already started");
+  if (UsePerfEventCounters) {
+    _worker_tasks_at_start = Atomic::load(&_worker_tasks);
+    _active = HardwareCountersDefault::start(_fds);
+  }
+}
+
+void HardwareCounters::stop() {
+  if (_active) {
+    HardwareCountersDefault::stop(_fds);
+    _active = false;
+  }
+}
+
+void HardwareCounters::print_on(outputStream* st) const {
+  if (!_active) {
+    return;
+  }
+  if (Atomic::load(&_worker_tasks) != _worker_tasks_at_start) {
+    // Most of the work was done by threads that were not measured.
+    st->print(" (parallel, not counted)");
+    return;
+  }
+  uint64_t values[HardwareCounterEventCount];
+  if (!HardwareCountersDefault::read(_fds, values)) {
+    return;
+  }
+  for (int i = 0; i < HardwareCounterEventCount; i++) {
+    if (values[i] != UINT64_MAX) {
+      st->print(" %s=" UINT64_FORMAT, event_name((HardwareCounterEvent)i), values[i]);
+    }
+  }
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_UTILITIES_HARDWARECOUNTERS_HPP
+#define SHARE_UTILITIES_HARDWARECOUNTERS_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class outputStream;
+
+// The hardware events counted by HardwareCounters.
+enum HardwareCounterEvent {
+  HardwareCounterCycles,
+  HardwareCounterInstructions,
+  HardwareCounterLLCMisses,
+  HardwareCounterDTLBMisses,
+  HardwareCounterEventCount
+};
+
+#if defined(LINUX)
+#include "hardwareCounters_linux.hpp"
+typedef LinuxHardwareCounters HardwareCountersDefault;
+#else
+class NoHardwareCounters : public AllStatic {
+ public:
+  static bool initialize();
+  static bool start(int* fds) { return false; }
+  static bool read(const int* fds, uint64_t* values) { return false; }
+  static void stop(int* fds) {}
+};
+typedef NoHardwareCounters HardwareCountersDefault;
+#endif
+
+// Counts hardware events of the current thread between start() and stop(),
+// if UsePerfEventCounters is enabled and the OS supports it. Only the caller
+// is measured, not the worker threads it might be handing work to, so
+// nothing is reported for phases during which a WorkerThreads task ran.
+//
+// Starting the counters takes a few system calls, so they are meant for
+// phases that are much longer than that, like GC phases and VM operations.
+class HardwareCounters : public StackObj {
+  // Number of tasks handed to WorkerThreads while counters are enabled.
+  static volatile uint _worker_tasks;
+
+  int _fds[HardwareCounterEventCount];
+  bool _active;
+  uint _worker_tasks_at_start;
+
+ public:
+  HardwareCounters() : _active(false), _worker_tasks_at_start(0) {}
+  ~HardwareCounters() { stop(); }
+
+  static void initialize();
+  // Called by WorkerThreads when a task is handed to the workers.
+  static void note_worker_task();
+  static const char* event_name(HardwareCounterEvent event);
+
+  void start();
+  void stop();
+  bool is_active() const { return _active; }
+
+  // Prints the counts since start(), as " cycles=<n> instructions=<n> ...".
+  // Events that are not supported by the hardware are left out. Prints
+  // " (parallel, not counted)" if worker threads ran a task since start().
+  void print_on(outputStream* st) const;
+};
+
+#endif // SHARE_UTILITIES_HARDWARECOUNTERS_HPP
@@ -232,6 +232,7 @@ class TimeInstant : public Rep<TimeSource> {
   friend class ObjectSample;
   friend class EventEmitter;
   friend class JfrPeriodicEventSet;
+  friend class JfrThreadLocal;
   // GC unit tests
   friend class TimePartitionsTest;
   friend class GCTimerTest;
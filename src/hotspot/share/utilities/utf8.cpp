@@ -29,6 +29,29 @@
 #include "utilities/utf8.hpp"
 #include "runtime/os.hpp"
 
+#include <string.h>
+
+static const uint64_t high_bits = UCONST64(0x8080808080808080);
+static const uint64_t low_bits  = UCONST64(0x0101010101010101);
+
+static inline uint64_t load_word(const void* p) {
+  uint64_t w;
+  memcpy(&w, p, sizeof(w));
+  return w;
+}
+
+// True if the 8 bytes at p are all in the range 0x00..0x7F.
+static inline bool is_ascii_word(const void* p) {
+  return (load_word(p) & high_bits) == 0;
+}
+
+// True if the 8 bytes at p are all in the range 0x01..0x7F.
+static inline bool is_nonzero_ascii_word(const void* p) {
+  uint64_t w = load_word(p);
+  uint64_t has_zero = (w - low_bits) & ~w;
+  return ((w | has_zero) & high_bits) == 0;
+}
+
 // Assume the utf8 string is in legal form and has been
 // checked in the class file parser/format checker.
 template<typename T> char* UTF8::next(const char* str, T* value) {
@@ -105,7 +128,17 @@ int UTF8::unicode_length(const char* str, int len, bool& is_latin1, bool& has_mu
   has_multibyte = false;
   is_latin1 = true;
   unsigned char prev = 0;
-  for (int i = 0; i < len; i++) {
+  int i = 0;
+  // ASCII bytes are never continuation bytes, skip them a word at a time.
+  for (; i <= len - (int)sizeof(uint64_t); i += sizeof(uint64_t)) {
+    if (!is_ascii_word(str + i)) {
+      break;
+    }
+  }
+  if (i > 0) {
+    prev = str[i - 1];
+  }
+  for (; i < len; i++) {
     unsigned char c = str[i];
     if ((c & 0xC0) == 0x80) {
       // Multibyte, check if valid latin1 character.
@@ -176,6 +209,17 @@ template<typename T> void UTF8::convert_to_unicode(const char* utf8_str, T* unic
   int index = 0;
 
   /* ASCII case loop optimization */
+  // There are at least as many bytes left as characters, so the
+  // word loads stay within the utf8 string.
+  for (; index <= unicode_length - (int)sizeof(uint64_t); index += sizeof(uint64_t)) {
+    if (!is_ascii_word(ptr)) {
+      break;
+    }
+    for (size_t k = 0; k < sizeof(uint64_t); k++) {
+      unicode_str[index + k] = (T)(unsigned char)ptr[k];
+    }
+    ptr += sizeof(uint64_t);
+  }
   for (; index < unicode_length; index++) {
     if((ch = ptr[0]) > 0x7F) { break; }
     unicode_str[index] = (T)ch;
@@ -332,7 +376,13 @@ jint UTF8::get_supplementary_character(const unsigned char* str) {
 bool UTF8::is_legal_utf8(const unsigned char* buffer, int length,
                          bool version_leq_47) {
   int i = 0;
-  int count = length >> 2;
+  // Skip words of non-zero ASCII bytes.
+  for (; i <= length - (int)sizeof(uint64_t); i += sizeof(uint64_t)) {
+    if (!is_nonzero_ascii_word(buffer + i)) {
+      break;
+    }
+  }
+  int count = (length - i) >> 2;
   for (int k=0; k<count; k++) {
     unsigned char b0 = buffer[i];
     unsigned char b1 = buffer[i+1];
@@ -432,7 +482,17 @@ int UNICODE::utf8_size(jbyte c) {
 template<typename T>
 int UNICODE::utf8_length(const T* base, int length) {
   int result = 0;
-  for (int index = 0; index < length; index++) {
+  int index = 0;
+  if (sizeof(T) == 1) {
+    // Non-zero ASCII bytes encode as themselves, skip them a word at a time.
+    for (; index <= length - (int)sizeof(uint64_t); index += sizeof(uint64_t)) {
+      if (!is_nonzero_ascii_word(base + index)) {
+        break;
+      }
+    }
+    result = index;
+  }
+  for (; index < length; index++) {
     T c = base[index];
     result += utf8_size(c);
   }
@@ -466,7 +526,17 @@ char* UNICODE::as_utf8(const jchar* base, int length, char* buf, int buflen) {
 char* UNICODE::as_utf8(const jbyte* base, int length, char* buf, int buflen) {
   assert(buflen > 0, "zero length output buffer");
   u_char* p = (u_char*)buf;
-  for (int index = 0; index < length; index++) {
+  int index = 0;
+  // Copy leading non-zero ASCII a word at a time, leaving room for the terminator.
+  for (; index <= length - (int)sizeof(uint64_t) && buflen > (int)sizeof(uint64_t); index += sizeof(uint64_t)) {
+    if (!is_nonzero_ascii_word(base + index)) {
+      break;
+    }
+    memcpy(p, base + index, sizeof(uint64_t));
+    p += sizeof(uint64_t);
+    buflen -= sizeof(uint64_t);
+  }
+  for (; index < length; index++) {
     jbyte c = base[index];
     int sz = utf8_size(c);
     buflen -= sz;
@@ -24,17 +24,91 @@
  */
 
 #include <sys/types.h>
+#include <sys/param.h>
 #include <sys/socket.h>
 #include <sys/uio.h>
+#include <errno.h>
 #include <unistd.h>
 
 #include "jni.h"
 #include "nio.h"
 #include "nio_util.h"
+#include "sun_nio_ch_FileDispatcherImpl.h"
 
-// Should contain a BSD implementation for FileDispatcherImpl
-//
-// Likely this means transfer operations that call sendfile() if possible
-// or revert to read()/write() depending on the underlying object behind
-// a file descriptor (BSD can only use sendfile() when the destination is
-// a socket).
+#if defined(__FreeBSD__) && __FreeBSD_version >= 1300037
+#define HAVE_COPY_FILE_RANGE 1
+#endif
+
+#ifdef __FreeBSD__
+// Maximum readahead, in pages, requested from sendfile(2)
+#define MAX_SENDFILE_READAHEAD 0xFFFF
+#endif
+
+JNIEXPORT jlong JNICALL
+Java_sun_nio_ch_FileDispatcherImpl_transferTo0(JNIEnv *env, jobject this,
+                                            jobject srcFDO,
+                                            jlong position, jlong count,
+                                            jobject dstFDO, jboolean append)
+{
+#ifdef __FreeBSD__
+    jint srcFD = fdval(env, srcFDO);
+    jint dstFD = fdval(env, dstFDO);
+
+#ifdef HAVE_COPY_FILE_RANGE
+    // copy_file_range fails with EBADF when appending, only try sendfile()
+    if (append != JNI_TRUE) {
+        off_t offset = (off_t)position;
+        size_t len = (size_t)count;
+        jlong n = copy_file_range(srcFD, &offset, dstFD, NULL, len, 0);
+        if (n >= 0)
+            return n;
+        switch (errno) {
+            case EINTR:
+                return IOS_INTERRUPTED;
+            case EBADF:
+            case EINVAL:
+            case EISDIR:
+            case ENOSYS:
+            case EXDEV:
+                // not a file-to-file transfer, try sendfile()
+                break;
+            default:
+                JNU_ThrowIOExceptionWithLastError(env, "Copy failed");
+                return IOS_THROWN;
+        }
+    }
+#endif
+
+    // sendfile(2) can only write to a stream socket. Ask for readahead
+    // covering the whole transfer so the pages are paged in with as few
+    // disk requests as possible.
+    size_t pages = ((size_t)count + getpagesize() - 1) / getpagesize();
+    int readahead = (int)MIN(pages, MAX_SENDFILE_READAHEAD);
+    off_t numBytes = 0;
+    int result = sendfile(srcFD, dstFD, (off_t)position, (size_t)count,
+                          NULL, &numBytes, SF_FLAGS(readahead, 0));
+
+    // A non-blocking socket may accept part of the data before sendfile
+    // fails with EAGAIN.
+    if (numBytes > 0)
+        return numBytes;
+
+    if (result == -1) {
+        if (errno == EAGAIN || errno == EBUSY)
+            return IOS_UNAVAILABLE;
+        if (errno == EOPNOTSUPP || errno == ENOTSOCK || errno == ENOTCONN)
+            return IOS_UNSUPPORTED_CASE;
+        if ((errno == EINVAL) && ((ssize_t)count >= 0))
+            return IOS_UNSUPPORTED_CASE;
+        if (errno == EINTR)
+            return IOS_INTERRUPTED;
+        JNU_ThrowIOExceptionWithLastError(env, "Transfer failed");
+        return IOS_THROWN;
+    }
+
+    return result;
+#else
+    // sendfile() is not available, fall back to read()/write()
+    return IOS_UNSUPPORTED;
+#endif
+}
@@ -117,17 +117,24 @@ Java_jdk_internal_foreign_abi_fallback_LibFallback_doDowncall(JNIEnv* env, jclas
 }
 
 static void do_upcall(ffi_cif* cif, void* ret, void** args, void* user_data) {
-  // attach thread
+  // attach thread, unless the upcall comes from a thread that is already attached,
+  // such as a Java thread that made a downcall
   JNIEnv* env;
-  jint result = (*VM)->AttachCurrentThreadAsDaemon(VM, (void**) &env, NULL);
+  jboolean attached = JNI_FALSE;
+  if ((*VM)->GetEnv(VM, (void**) &env, JNI_VERSION_1_2) != JNI_OK) {
+    jint result = (*VM)->AttachCurrentThreadAsDaemon(VM, (void**) &env, NULL);
+    attached = JNI_TRUE;
+  }
 
   // call into doUpcall in LibFallback
   jobject upcall_data = (jobject) user_data;
   (*env)->CallStaticVoidMethod(env, LibFallback_class, LibFallback_doUpcall_ID,
     ptr_to_jlong(ret), ptr_to_jlong(args), upcall_data);
 
-  // always detach for now
-  (*VM)->DetachCurrentThread(VM);
+  // only detach a thread that was attached above
+  if (attached) {
+    (*VM)->DetachCurrentThread(VM);
+  }
 }
 
 static void free_closure(JNIEnv* env, void* closure, jobject upcall_data) {
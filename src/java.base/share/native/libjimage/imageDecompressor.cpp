@@ -157,8 +157,13 @@ void ImageDecompressor::decompress_resource(u1* compressed, u1* uncompressed,
         compressed_resource += 1;
         has_header = _header._magic == ResourceHeader::resource_header_magic;
         if (has_header) {
+            // The last decompressor of the stack writes straight into the
+            // caller's buffer, saving a temporary copy of the resource.
+            bool to_caller = _header._is_terminal &&
+                    _header._uncompressed_size == uncompressed_size;
             // decompressed_resource array contains the result of decompression
-            decompressed_resource = new u1[(size_t) _header._uncompressed_size];
+            decompressed_resource = to_caller ? uncompressed :
+                    new u1[(size_t) _header._uncompressed_size];
             // Retrieve the decompressor name
             const char* decompressor_name = strings->get(_header._decompressor_name_offset);
             assert(decompressor_name && "image decompressor not found");
@@ -171,6 +176,15 @@ void ImageDecompressor::decompress_resource(u1* compressed, u1* uncompressed,
             if (compressed_resource_base != compressed) {
                 delete[] compressed_resource_base;
             }
+            if (to_caller) {
+                if (uncompressed_size < 4 ||
+                        getU4(uncompressed, endian) != ResourceHeader::resource_header_magic) {
+                    return;
+                }
+                // Not the last one after all, continue from a private copy.
+                decompressed_resource = new u1[(size_t) uncompressed_size];
+                memcpy(decompressed_resource, uncompressed, (size_t) uncompressed_size);
+            }
             compressed_resource = decompressed_resource;
         }
     } while (has_header);
@@ -33,6 +33,204 @@
 
 #include "java_util_zip_CRC32.h"
 
+/*
+ * These entry points are used when the JIT intrinsic for CRC32 is not: by
+ * the interpreter, by JNI callers and through ZIP_CRC32. Where the CPU supports
+ * it, larger buffers are checksummed with carry-less multiplication folding
+ * (x86 PCLMULQDQ) or the CRC32 instructions (AArch64), and the remaining
+ * bytes with zlib's crc32.
+ */
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+
+#include <cpuid.h>
+#include <immintrin.h>
+
+#define CRC32_FOLD_MIN 64
+
+/*
+ * Folds 64 bytes at a time with PCLMULQDQ, following "Fast CRC Computation
+ * for Generic Polynomials Using PCLMULQDQ Instruction" (Intel, 2009). The
+ * constants are for the reflected polynomial 0xEDB88320. len must be at
+ * least 64 and a multiple of 16. crc is the pre and post-conditioned value.
+ *
+ * This function is derived from crc32_sse42_simd_() in Chromium's zlib
+ * (third_party/zlib/crc32_simd.c), which is distributed under the
+ * following license:
+ *
+ * Copyright 2017 The Chromium Authors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *    * Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above
+ * copyright notice, this list of conditions and the following disclaimer
+ * in the documentation and/or other materials provided with the
+ * distribution.
+ *    * Neither the name of Google LLC nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+__attribute__((target("pclmul,sse4.1")))
+static uLong
+crc32_fold(uLong crc, const Bytef *buf, size_t len)
+{
+    static const jlong k1k2[2] __attribute__((aligned(16))) =
+        { 0x0154442bd4LL, 0x01c6e41596LL };
+    static const jlong k3k4[2] __attribute__((aligned(16))) =
+        { 0x01751997d0LL, 0x00ccaa009eLL };
+    static const jlong k5k0[2] __attribute__((aligned(16))) =
+        { 0x0163cd6124LL, 0x0000000000LL };
+    static const jlong poly[2] __attribute__((aligned(16))) =
+        { 0x01db710641LL, 0x01f7011641LL };
+    __m128i x0, x1, x2, x3, x4, x5, x6, x7, x8, y5, y6, y7, y8;
+
+    x1 = _mm_loadu_si128((const __m128i *)(buf + 0x00));
+    x2 = _mm_loadu_si128((const __m128i *)(buf + 0x10));
+    x3 = _mm_loadu_si128((const __m128i *)(buf + 0x20));
+    x4 = _mm_loadu_si128((const __m128i *)(buf + 0x30));
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)~crc));
+    x0 = _mm_load_si128((const __m128i *)k1k2);
+    buf += 64;
+    len -= 64;
+
+    /* Fold 64 bytes per iteration into the four accumulators. */
+    while (len >= 64) {
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+        x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+        x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+        y5 = _mm_loadu_si128((const __m128i *)(buf + 0x00));
+        y6 = _mm_loadu_si128((const __m128i *)(buf + 0x10));
+        y7 = _mm_loadu_si128((const __m128i *)(buf + 0x20));
+        y8 = _mm_loadu_si128((const __m128i *)(buf + 0x30));
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), y5);
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), y6);
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), y7);
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), y8);
+        buf += 64;
+        len -= 64;
+    }
+
+    /* Fold the accumulators into 128 bits. */
+    x0 = _mm_load_si128((const __m128i *)k3k4);
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+    /* Fold the remaining 16 byte blocks. */
+    while (len >= 16) {
+        x2 = _mm_loadu_si128((const __m128i *)buf);
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+        buf += 16;
+        len -= 16;
+    }
+
+    /* Fold 128 bits to 64 bits. */
+    x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+    x3 = _mm_setr_epi32(~0, 0, ~0, 0);
+    x1 = _mm_srli_si128(x1, 8);
+    x1 = _mm_xor_si128(x1, x2);
+    x0 = _mm_loadl_epi64((const __m128i *)k5k0);
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, x3);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    /* Barrett reduction to 32 bits. */
+    x0 = _mm_load_si128((const __m128i *)poly);
+    x2 = _mm_and_si128(x1, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+    x2 = _mm_and_si128(x2, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+    return ~(uLong)(unsigned int)_mm_extract_epi32(x1, 1) & 0xffffffffUL;
+}
+
+static int
+crc32_fold_supported(void)
+{
+    static int supported = -1;
+    if (supported == -1) {
+        unsigned int eax, ebx, ecx, edx;
+        supported = __get_cpuid(1, &eax, &ebx, &ecx, &edx) &&
+                    (ecx & bit_PCLMUL) != 0 && (ecx & bit_SSE4_1) != 0;
+    }
+    return supported;
+}
+
+#elif defined(__ARM_FEATURE_CRC32)
+
+#include <arm_acle.h>
+#include <stdint.h>
+#include <string.h>
+
+#define CRC32_FOLD_MIN 64
+
+/* Processes the buffer 8 bytes at a time with the CRC32X instruction. */
+static uLong
+crc32_fold(uLong crc, const Bytef *buf, size_t len)
+{
+    uint32_t c = ~(uint32_t)crc;
+    while (len >= 8) {
+        uint64_t v;
+        memcpy(&v, buf, sizeof(v));
+        c = __crc32d(c, v);
+        buf += 8;
+        len -= 8;
+    }
+    return ~c & 0xffffffffUL;
+}
+
+static int
+crc32_fold_supported(void)
+{
+    return 1;
+}
+
+#endif
+
+static uLong
+crc32_update(uLong crc, const Bytef *buf, size_t len)
+{
+#ifdef CRC32_FOLD_MIN
+    if (len >= CRC32_FOLD_MIN && crc32_fold_supported()) {
+        size_t folded = len & ~(size_t)15;
+        crc = crc32_fold(crc, buf, folded);
+        buf += folded;
+        len -= folded;
+    }
+#endif
+    return len == 0 ? crc : crc32(crc, buf, (uInt)len);
+}
+
 JNIEXPORT jint JNICALL
 Java_java_util_zip_CRC32_update(JNIEnv *env, jclass cls, jint crc, jint b)
 {
@@ -48,7 +246,7 @@ Java_java_util_zip_CRC32_updateBytes0(JNIEnv *env, jclass cls, jint crc,
 {
     Bytef *buf = (*env)->GetPrimitiveArrayCritical(env, b, 0);
     if (buf) {
-        crc = crc32(crc, buf + off, len);
+        crc = (jint)crc32_update((uLong)crc, buf + off, (size_t)len);
         (*env)->ReleasePrimitiveArrayCritical(env, b, buf, 0);
     }
     return crc;
@@ -57,7 +255,7 @@ Java_java_util_zip_CRC32_updateBytes0(JNIEnv *env, jclass cls, jint crc,
 JNIEXPORT jint
 ZIP_CRC32(jint crc, const jbyte *buf, jint len)
 {
-    return crc32(crc, (Bytef*)buf, len);
+    return (jint)crc32_update((uLong)crc, (const Bytef*)buf, (size_t)len);
 }
 
 JNIEXPORT jint JNICALL
@@ -66,7 +264,7 @@ Java_java_util_zip_CRC32_updateByteBuffer0(JNIEnv *env, jclass cls, jint crc,
 {
     Bytef *buf = (Bytef *)jlong_to_ptr(address);
     if (buf) {
-        crc = crc32(crc, buf + off, len);
+        crc = (jint)crc32_update((uLong)crc, buf + off, (size_t)len);
     }
     return crc;
 }
@@ -193,18 +193,18 @@ static float euclidianDistance(float a, float b)
     return root;
 }
 
-JDKFontInfo*
-     createJDKFontInfo(JNIEnv *env,
-                       jobject font2D,
-                       jobject fontStrike,
-                       jfloat ptSize,
-                       jfloatArray matrix) {
-
-
-    JDKFontInfo *fi = (JDKFontInfo*)malloc(sizeof(JDKFontInfo));
-    if (!fi) {
-       return NULL;
+static void initJDKFontInfo(JDKFontInfo *fi,
+                            JNIEnv *env,
+                            jobject font2D,
+                            jobject fontStrike,
+                            jfloat ptSize,
+                            jfloatArray matrix) {
+
+    static int noDevTx = -1;
+    if (noDevTx < 0) {
+        noDevTx = getenv("HB_NODEVTX") != NULL;
     }
+
     fi->env = env; // this is valid only for the life of this JNI call.
     fi->font2D = font2D;
     fi->fontStrike = fontStrike;
@@ -212,12 +212,18 @@ JDKFontInfo*
     fi->ptSize = ptSize;
     fi->xPtSize = euclidianDistance(fi->matrix[0], fi->matrix[1]);
     fi->yPtSize = euclidianDistance(fi->matrix[2], fi->matrix[3]);
-    if (getenv("HB_NODEVTX") != NULL) {
+    if (noDevTx) {
         fi->devScale = fi->xPtSize / fi->ptSize;
     } else {
         fi->devScale = 1.0f;
     }
-    return fi;
+}
+
+static void setFeature(hb_feature_t *feature, hb_tag_t tag, int enabled) {
+    feature->tag = tag;
+    feature->value = enabled ? 1 : 0;
+    feature->start = HB_FEATURE_GLOBAL_START;
+    feature->end = HB_FEATURE_GLOBAL_END;
 }
 
 
@@ -251,29 +257,26 @@ JNIEXPORT jboolean JNICALL Java_sun_font_SunLayoutEngine_shape
      hb_glyph_info_t *glyphInfo;
      hb_glyph_position_t *glyphPos;
      hb_direction_t direction = HB_DIRECTION_LTR;
-     hb_feature_t *features = NULL;
+     hb_feature_t features[2];
      int featureCount = 0;
-     char* kern = (flags & TYPO_KERN) ? "kern" : "-kern";
-     char* liga = (flags & TYPO_LIGA) ? "liga" : "-liga";
      jboolean ret;
      unsigned int buflen;
+     JDKFontInfo jdkFontInfo;
+     // Languages are interned for the life of the process.
+     static hb_language_t defaultLanguage = NULL;
 
-     JDKFontInfo *jdkFontInfo =
-         createJDKFontInfo(env, font2D, fontStrike, ptSize, matrix);
-     if (!jdkFontInfo) {
-        return JNI_FALSE;
+     if (defaultLanguage == NULL) {
+         defaultLanguage = hb_ot_tag_to_language(HB_OT_TAG_DEFAULT_LANGUAGE);
      }
-     jdkFontInfo->env = env; // this is valid only for the life of this JNI call.
-     jdkFontInfo->font2D = font2D;
-     jdkFontInfo->fontStrike = fontStrike;
+
+     initJDKFontInfo(&jdkFontInfo, env, font2D, fontStrike, ptSize, matrix);
 
      hbface = (hb_face_t*) jlong_to_ptr(pFace);
-     hbfont = hb_jdk_font_create(hbface, jdkFontInfo, NULL);
+     hbfont = hb_jdk_font_create(hbface, &jdkFontInfo, NULL);
 
      buffer = hb_buffer_create();
      hb_buffer_set_script(buffer, getHBScriptCode(script));
-     hb_buffer_set_language(buffer,
-                            hb_ot_tag_to_language(HB_OT_TAG_DEFAULT_LANGUAGE));
+     hb_buffer_set_language(buffer, defaultLanguage);
      if ((flags & TYPO_RTL) != 0) {
          direction = HB_DIRECTION_RTL;
      }
@@ -285,18 +288,17 @@ JNIEXPORT jboolean JNICALL Java_sun_font_SunLayoutEngine_shape
      if ((*env)->ExceptionCheck(env)) {
          hb_buffer_destroy(buffer);
          hb_font_destroy(hbfont);
-         free((void*)jdkFontInfo);
          return JNI_FALSE;
      }
      len = (*env)->GetArrayLength(env, text);
 
      hb_buffer_add_utf16(buffer, chars, len, offset, limit-offset);
 
-     features = calloc(2, sizeof(hb_feature_t));
-     if (features) {
-         hb_feature_from_string(kern, -1, &features[featureCount++]);
-         hb_feature_from_string(liga, -1, &features[featureCount++]);
-     }
+     // Global features keep the shape plan cacheable on the face.
+     setFeature(&features[featureCount++], HB_TAG('k','e','r','n'),
+                (flags & TYPO_KERN) != 0);
+     setFeature(&features[featureCount++], HB_TAG('l','i','g','a'),
+                (flags & TYPO_LIGA) != 0);
 
      hb_shape_full(hbfont, buffer, features, featureCount, 0);
      glyphCount = hb_buffer_get_length(buffer);
@@ -305,12 +307,10 @@ JNIEXPORT jboolean JNICALL Java_sun_font_SunLayoutEngine_shape
 
      ret = storeGVData(env, gvdata, slot, baseIndex, offset, startPt,
                        limit - offset, glyphCount, glyphInfo, glyphPos,
-                       jdkFontInfo->devScale);
+                       jdkFontInfo.devScale);
 
      hb_buffer_destroy (buffer);
      hb_font_destroy(hbfont);
-     free((void*)jdkFontInfo);
-     if (features != NULL) free(features);
      (*env)->ReleaseCharArrayElements(env, text, chars, JNI_ABORT);
      return ret;
 }
@@ -16,6 +16,13 @@
 #include "jinclude.h"
 #include "jpeglib.h"
 
+#if BITS_IN_JSAMPLE == 8 && RGB_PIXELSIZE == 3 && \
+    RGB_RED == 0 && RGB_GREEN == 1 && RGB_BLUE == 2 && \
+    (defined(__SSE2__) || defined(_M_X64))
+#include <emmintrin.h>
+#define YCC_RGB_SSE2_SUPPORTED
+#endif
+
 
 /* Private subobject */
 
@@ -161,6 +168,153 @@ ycc_rgb_convert (j_decompress_ptr cinfo,
 }
 
 
+#ifdef YCC_RGB_SSE2_SUPPORTED
+
+/*
+ * SSE2 version of ycc_rgb_convert, 16 pixels at a time.
+ *
+ * The products need more than 16 bits, so each multiplier is split into
+ * a multiple of 2^16, applied as a plain add, and a remainder that fits
+ * a signed 16-bit constant.  For x = Cb or Cr less CENTERJSAMPLE:
+ *      (FIX(1.40200) * x + ONE_HALF) >> 16 = x + ((26345 * x + ONE_HALF) >> 16)
+ *      (FIX(1.77200) * x + ONE_HALF) >> 16 = 2*x + ((-14942 * x + ONE_HALF) >> 16)
+ *      (-FIX(0.34414) * cb - FIX(0.71414) * cr + ONE_HALF) >> 16
+ *          = -cr + ((-22554 * cb + 18734 * cr + ONE_HALF) >> 16)
+ * The remainders are formed with pmaddwd in 32 bits, so the results are
+ * identical to the table lookups.  Saturating packs replace range_limit,
+ * which only clamps for the values that can arise here.  The planes are
+ * then interleaved into 48 bytes of R,G,B output with shifts and masks.
+ */
+
+/* Multiply-add the 16-bit pairs (a, b) by k, and return (sum + bias) >> 16 */
+LOCAL(__m128i)
+madd_descale (__m128i a, __m128i b, __m128i k, __m128i bias)
+{
+  __m128i lo = _mm_madd_epi16(_mm_unpacklo_epi16(a, b), k);
+  __m128i hi = _mm_madd_epi16(_mm_unpackhi_epi16(a, b), k);
+  lo = _mm_srai_epi32(_mm_add_epi32(lo, bias), SCALEBITS);
+  hi = _mm_srai_epi32(_mm_add_epi32(hi, bias), SCALEBITS);
+  return _mm_packs_epi32(lo, hi);
+}
+
+/* Convert 8 pixels held in 16-bit lanes, returning R, G and B */
+LOCAL(void)
+ycc_rgb_sse2_8 (__m128i y, __m128i cb, __m128i cr,
+                __m128i * r, __m128i * g, __m128i * b)
+{
+  const __m128i center = _mm_set1_epi16(CENTERJSAMPLE);
+  const __m128i two = _mm_set1_epi16(2);
+  const __m128i none = _mm_setzero_si128();
+  const __m128i half = _mm_set1_epi32(ONE_HALF);
+  const __m128i k_r = _mm_set_epi16(16384, 26345, 16384, 26345,
+                                    16384, 26345, 16384, 26345);
+  const __m128i k_b = _mm_set_epi16(16384, -14942, 16384, -14942,
+                                    16384, -14942, 16384, -14942);
+  const __m128i k_g = _mm_set_epi16(18734, -22554, 18734, -22554,
+                                    18734, -22554, 18734, -22554);
+
+  cb = _mm_sub_epi16(cb, center);
+  cr = _mm_sub_epi16(cr, center);
+  /* For R and B the pairs (x, 2) times (k, 16384) supply ONE_HALF */
+  *r = _mm_add_epi16(_mm_add_epi16(y, cr),
+                     madd_descale(cr, two, k_r, none));
+  *b = _mm_add_epi16(_mm_add_epi16(y, _mm_add_epi16(cb, cb)),
+                     madd_descale(cb, two, k_b, none));
+  *g = _mm_add_epi16(_mm_sub_epi16(y, cr),
+                     madd_descale(cb, cr, k_g, half));
+}
+
+/* Squeeze four R,G,B,0 pixels into the low 12 bytes */
+LOCAL(__m128i)
+pack_rgb12 (__m128i px)
+{
+  const __m128i lo24 = _mm_set_epi32(0, 0xFFFFFF, 0, 0xFFFFFF);
+  const __m128i hi24 = _mm_set_epi32(0xFFFF, 0xFF000000, 0xFFFF, 0xFF000000);
+  const __m128i lo_q = _mm_set_epi32(0, 0, -1, -1);
+
+  /* Two 3-byte pixels in the low 6 bytes of each quadword */
+  px = _mm_or_si128(_mm_and_si128(px, lo24),
+                    _mm_and_si128(_mm_srli_epi64(px, 8), hi24));
+  return _mm_or_si128(_mm_and_si128(px, lo_q),
+                      _mm_srli_si128(_mm_andnot_si128(lo_q, px), 2));
+}
+
+METHODDEF(void)
+ycc_rgb_convert_sse2 (j_decompress_ptr cinfo,
+                      JSAMPIMAGE input_buf, JDIMENSION input_row,
+                      JSAMPARRAY output_buf, int num_rows)
+{
+  my_cconvert_ptr cconvert = (my_cconvert_ptr) cinfo->cconvert;
+  register int y, cb, cr;
+  register JSAMPROW outptr;
+  register JSAMPROW inptr0, inptr1, inptr2;
+  register JDIMENSION col;
+  JDIMENSION num_cols = cinfo->output_width;
+  register JSAMPLE * range_limit = cinfo->sample_range_limit;
+  register int * Crrtab = cconvert->Cr_r_tab;
+  register int * Cbbtab = cconvert->Cb_b_tab;
+  register INT32 * Crgtab = cconvert->Cr_g_tab;
+  register INT32 * Cbgtab = cconvert->Cb_g_tab;
+  const __m128i zero = _mm_setzero_si128();
+  SHIFT_TEMPS
+
+  while (--num_rows >= 0) {
+    inptr0 = input_buf[0][input_row];
+    inptr1 = input_buf[1][input_row];
+    inptr2 = input_buf[2][input_row];
+    input_row++;
+    outptr = *output_buf++;
+    for (col = 0; col + 16 <= num_cols; col += 16) {
+      __m128i vy = _mm_loadu_si128((const __m128i *) (inptr0 + col));
+      __m128i vcb = _mm_loadu_si128((const __m128i *) (inptr1 + col));
+      __m128i vcr = _mm_loadu_si128((const __m128i *) (inptr2 + col));
+      __m128i r0, g0, b0, r1, g1, b1;
+      __m128i rgb0, rgb1, rgb2, rgb3;
+
+      ycc_rgb_sse2_8(_mm_unpacklo_epi8(vy, zero), _mm_unpacklo_epi8(vcb, zero),
+                     _mm_unpacklo_epi8(vcr, zero), &r0, &g0, &b0);
+      ycc_rgb_sse2_8(_mm_unpackhi_epi8(vy, zero), _mm_unpackhi_epi8(vcb, zero),
+                     _mm_unpackhi_epi8(vcr, zero), &r1, &g1, &b1);
+      r0 = _mm_packus_epi16(r0, r1);
+      g0 = _mm_packus_epi16(g0, g1);
+      b0 = _mm_packus_epi16(b0, b1);
+      /* R,G,B,0 pixels 0-3, 4-7, 8-11 and 12-15 */
+      r1 = _mm_unpacklo_epi8(r0, g0);
+      g1 = _mm_unpacklo_epi8(b0, zero);
+      rgb0 = pack_rgb12(_mm_unpacklo_epi16(r1, g1));
+      rgb1 = pack_rgb12(_mm_unpackhi_epi16(r1, g1));
+      r1 = _mm_unpackhi_epi8(r0, g0);
+      g1 = _mm_unpackhi_epi8(b0, zero);
+      rgb2 = pack_rgb12(_mm_unpacklo_epi16(r1, g1));
+      rgb3 = pack_rgb12(_mm_unpackhi_epi16(r1, g1));
+      _mm_storeu_si128((__m128i *) outptr,
+                       _mm_or_si128(rgb0, _mm_slli_si128(rgb1, 12)));
+      _mm_storeu_si128((__m128i *) (outptr + 16),
+                       _mm_or_si128(_mm_srli_si128(rgb1, 4),
+                                    _mm_slli_si128(rgb2, 8)));
+      _mm_storeu_si128((__m128i *) (outptr + 32),
+                       _mm_or_si128(_mm_srli_si128(rgb2, 8),
+                                    _mm_slli_si128(rgb3, 4)));
+      outptr += 16 * RGB_PIXELSIZE;
+    }
+    /* Remaining columns as in ycc_rgb_convert */
+    for (; col < num_cols; col++) {
+      y  = GETJSAMPLE(inptr0[col]);
+      cb = GETJSAMPLE(inptr1[col]);
+      cr = GETJSAMPLE(inptr2[col]);
+      outptr[RGB_RED] =   range_limit[y + Crrtab[cr]];
+      outptr[RGB_GREEN] = range_limit[y +
+                              ((int) RIGHT_SHIFT(Cbgtab[cb] + Crgtab[cr],
+                                                 SCALEBITS))];
+      outptr[RGB_BLUE] =  range_limit[y + Cbbtab[cb]];
+      outptr += RGB_PIXELSIZE;
+    }
+  }
+}
+
+#endif /* YCC_RGB_SSE2_SUPPORTED */
+
+
 /**************** Cases other than YCbCr -> RGB **************/
 
 
@@ -360,7 +514,11 @@ jinit_color_deconverter (j_decompress_ptr cinfo)
   case JCS_RGB:
     cinfo->out_color_components = RGB_PIXELSIZE;
     if (cinfo->jpeg_color_space == JCS_YCbCr) {
+#ifdef YCC_RGB_SSE2_SUPPORTED
+      cconvert->pub.color_convert = ycc_rgb_convert_sse2;
+#else
       cconvert->pub.color_convert = ycc_rgb_convert;
+#endif
       build_ycc_rgb_table(cinfo);
     } else if (cinfo->jpeg_color_space == JCS_GRAYSCALE) {
       cconvert->pub.color_convert = gray_rgb_convert;
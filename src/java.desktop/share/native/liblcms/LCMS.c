@@ -35,6 +35,12 @@
 #include <lcms2_plugin.h>
 #include "jlong.h"
 
+#ifndef _WIN32
+#include <pthread.h>
+#include <unistd.h>
+#define PARALLEL_CONVERT
+#endif
+
 #define SigMake(a,b,c,d) \
                     ( ( ((int) ((unsigned char) (a))) << 24) | \
                       ( ((int) ((unsigned char) (b))) << 16) | \
@@ -55,6 +61,17 @@
 
 #define ERR_MSG_SIZE 256
 
+/*
+ * Images of PARALLEL_MIN_PIXELS or more are converted in bands of rows by
+ * the calling thread and a pool of worker threads, see doTransform.  The
+ * number of bands is the number of online processors, at most
+ * PARALLEL_MAX_THREADS.  Setting the J2D_LCMS_THREADS environment variable
+ * to a number lowers it, and J2D_LCMS_THREADS=1 converts every image on
+ * the calling thread.  The variable is read once, on the first large image.
+ */
+#define PARALLEL_MIN_PIXELS (1 << 20)
+#define PARALLEL_MAX_THREADS 8
+
 #ifdef _MSC_VER
 # ifndef snprintf
 #       define snprintf  _snprintf
@@ -72,6 +89,22 @@ typedef union {
 
 JavaVM *javaVM;
 
+#ifdef PARALLEL_CONVERT
+/*
+ * The error of a band converted in parallel.  lcms reports errors through
+ * errorHandler, which must not use JNI on a worker thread, and must not
+ * throw on the calling thread before all bands are done.  A thread that
+ * converts a band points convertErrorKey at the error of the band, and
+ * errorHandler only records the error there.
+ */
+typedef struct {
+    jboolean failed;
+    char errMsg[ERR_MSG_SIZE];
+} convertError_t;
+
+static pthread_key_t convertErrorKey;
+#endif
+
 void errorHandler(cmsContext ContextID, cmsUInt32Number errorCode,
                   const char *errorText) {
     JNIEnv *env;
@@ -84,6 +117,17 @@ void errorHandler(cmsContext ContextID, cmsUInt32Number errorCode,
     }
     errMsg[count] = 0;
 
+#ifdef PARALLEL_CONVERT
+    convertError_t *convertError = pthread_getspecific(convertErrorKey);
+    if (convertError != NULL) {
+        if (!convertError->failed) {
+            convertError->failed = JNI_TRUE;
+            memcpy(convertError->errMsg, errMsg, count + 1);
+        }
+        return;
+    }
+#endif
+
     (*javaVM)->AttachCurrentThread(javaVM, (void**)&env, NULL);
     if (!(*env)->ExceptionCheck(env)) { // errorHandler may throw it before
         JNU_ThrowByName(env, "java/awt/color/CMMException", errMsg);
@@ -93,6 +137,11 @@ void errorHandler(cmsContext ContextID, cmsUInt32Number errorCode,
 JNIEXPORT jint JNICALL DEF_JNI_OnLoad(JavaVM *jvm, void *reserved) {
     javaVM = jvm;
 
+#ifdef PARALLEL_CONVERT
+    if (pthread_key_create(&convertErrorKey, NULL) != 0) {
+        return JNI_ERR;
+    }
+#endif
     cmsSetLogErrorHandler(errorHandler);
     return JNI_VERSION_1_6;
 }
@@ -503,6 +552,208 @@ static void releaseILData(JNIEnv *env, void *pData, jint type, jobject data,
     }
 }
 
+#ifdef PARALLEL_CONVERT
+
+typedef struct {
+    int remaining;  /* bands not converted yet, guarded by poolLock */
+} convertBatch_t;
+
+typedef struct convertSlice_s {
+    cmsHTRANSFORM sTrans;
+    char *input;
+    char *output;
+    jint width;
+    jint height;
+    jint srcNextRowOffset;
+    jint dstNextRowOffset;
+    convertBatch_t *batch;
+    convertError_t error;
+    struct convertSlice_s *next;
+} convertSlice_t;
+
+/*
+ * The worker threads are started on demand and then wait for bands to
+ * convert.  The bands queued by all concurrent colorConvert calls are
+ * taken in any order; each call waits until its own bands are done.
+ */
+static pthread_mutex_t poolLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t poolWork = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t poolDone = PTHREAD_COND_INITIALIZER;
+static convertSlice_t *poolQueue = NULL;
+static int poolThreads = 0;
+
+static void convertSlice(convertSlice_t *slice) {
+    pthread_setspecific(convertErrorKey, &slice->error);
+    cmsDoTransformLineStride(slice->sTrans, slice->input, slice->output,
+                             slice->width, slice->height,
+                             slice->srcNextRowOffset, slice->dstNextRowOffset,
+                             0, 0);
+    pthread_setspecific(convertErrorKey, NULL);
+}
+
+/* Called with poolLock held */
+static convertSlice_t *takeSlice() {
+    convertSlice_t *slice = poolQueue;
+    if (slice != NULL) {
+        poolQueue = slice->next;
+    }
+    return slice;
+}
+
+/* Called with poolLock held */
+static void finishSlice(convertSlice_t *slice) {
+    if (--slice->batch->remaining == 0) {
+        pthread_cond_broadcast(&poolDone);
+    }
+}
+
+static void *convertWorker(void *arg) {
+    pthread_mutex_lock(&poolLock);
+    for (;;) {
+        convertSlice_t *slice = takeSlice();
+        if (slice == NULL) {
+            pthread_cond_wait(&poolWork, &poolLock);
+            continue;
+        }
+        pthread_mutex_unlock(&poolLock);
+        convertSlice(slice);
+        pthread_mutex_lock(&poolLock);
+        finishSlice(slice);
+    }
+    return NULL;
+}
+
+/*
+ * Starts worker threads until there are count of them, or until one
+ * cannot be started.  Called with poolLock held.
+ */
+static void growPool(int count) {
+    pthread_attr_t attr;
+    if (poolThreads >= count || pthread_attr_init(&attr) != 0) {
+        return;
+    }
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    while (poolThreads < count) {
+        pthread_t thread;
+        if (pthread_create(&thread, &attr, convertWorker, NULL) != 0) {
+            break;
+        }
+        poolThreads++;
+    }
+    pthread_attr_destroy(&attr);
+}
+
+/*
+ * The number of bands to convert a large image in, see
+ * PARALLEL_MAX_THREADS and J2D_LCMS_THREADS.
+ */
+static int getConvertThreads() {
+    static int threads = 0;
+    if (threads == 0) {
+        long n = sysconf(_SC_NPROCESSORS_ONLN);
+        char *env = getenv("J2D_LCMS_THREADS");
+        if (env != NULL) {
+            long limit = strtol(env, NULL, 10);
+            if (limit >= 1 && limit < n) {
+                n = limit;
+            }
+        }
+        if (n < 1) {
+            n = 1;
+        } else if (n > PARALLEL_MAX_THREADS) {
+            n = PARALLEL_MAX_THREADS;
+        }
+        threads = (int) n;
+    }
+    return threads;
+}
+
+#endif /* PARALLEL_CONVERT */
+
+/*
+ * Transforms the rows of an image.  lcms2 transforms may be shared
+ * between threads, each call keeps its own copy of the pixel cache, so
+ * large images are split into bands of rows that are converted in
+ * parallel.  The calling thread converts bands too, so that the image is
+ * still converted if no worker thread can be started.
+ *
+ * Returns JNI_FALSE with the message in errMsg if lcms reported an error
+ * while converting a band.  The caller throws it once the buffers are
+ * released.  Errors of an image converted on the calling thread alone
+ * are thrown by errorHandler as before.
+ */
+static jboolean doTransform(cmsHTRANSFORM sTrans, char *input, char *output,
+                            jint width, jint height,
+                            jint srcNextRowOffset, jint dstNextRowOffset,
+                            char *errMsg)
+{
+#ifdef PARALLEL_CONVERT
+    int n = ((jlong) width * height >= PARALLEL_MIN_PIXELS) ?
+            getConvertThreads() : 1;
+    if (n > height) {
+        n = height;
+    }
+    if (n > 1) {
+        convertSlice_t slices[PARALLEL_MAX_THREADS];
+        convertBatch_t batch;
+        jint y = 0;
+        int i;
+
+        batch.remaining = n;
+        for (i = 0; i < n; i++) {
+            jint rows = height / n + (i < height % n ? 1 : 0);
+            slices[i].sTrans = sTrans;
+            slices[i].input = input + (size_t) y * srcNextRowOffset;
+            slices[i].output = output + (size_t) y * dstNextRowOffset;
+            slices[i].width = width;
+            slices[i].height = rows;
+            slices[i].srcNextRowOffset = srcNextRowOffset;
+            slices[i].dstNextRowOffset = dstNextRowOffset;
+            slices[i].batch = &batch;
+            slices[i].error.failed = JNI_FALSE;
+            y += rows;
+        }
+
+        pthread_mutex_lock(&poolLock);
+        growPool(n - 1);
+        for (i = 1; i < n; i++) {
+            slices[i].next = poolQueue;
+            poolQueue = &slices[i];
+        }
+        pthread_cond_broadcast(&poolWork);
+        pthread_mutex_unlock(&poolLock);
+
+        convertSlice(&slices[0]);
+
+        pthread_mutex_lock(&poolLock);
+        finishSlice(&slices[0]);
+        while (batch.remaining > 0) {
+            convertSlice_t *slice = takeSlice();
+            if (slice != NULL) {
+                pthread_mutex_unlock(&poolLock);
+                convertSlice(slice);
+                pthread_mutex_lock(&poolLock);
+                finishSlice(slice);
+            } else {
+                pthread_cond_wait(&poolDone, &poolLock);
+            }
+        }
+        pthread_mutex_unlock(&poolLock);
+
+        for (i = 0; i < n; i++) {
+            if (slices[i].error.failed) {
+                memcpy(errMsg, slices[i].error.errMsg, ERR_MSG_SIZE);
+                return JNI_FALSE;
+            }
+        }
+        return JNI_TRUE;
+    }
+#endif
+    cmsDoTransformLineStride(sTrans, input, output, width, height,
+                             srcNextRowOffset, dstNextRowOffset, 0, 0);
+    return JNI_TRUE;
+}
+
 /*
  * Class:     sun_java2d_cmm_lcms_LCMS
  * Method:    colorConvert
@@ -539,11 +790,17 @@ JNIEXPORT void JNICALL Java_sun_java2d_cmm_lcms_LCMS_colorConvert
     char *input = (char *) inputBuffer + srcOffset;
     char *output = (char *) outputBuffer + dstOffset;
 
-    cmsDoTransformLineStride(sTrans, input, output, width, height,
-                             srcNextRowOffset, dstNextRowOffset, 0, 0);
+    char errMsg[ERR_MSG_SIZE];
+    jboolean converted = doTransform(sTrans, input, output, width, height,
+                                     srcNextRowOffset, dstNextRowOffset,
+                                     errMsg);
 
     releaseILData(env, inputBuffer, srcDType, srcData, JNI_ABORT);
     releaseILData(env, outputBuffer, dstDType, dstData, 0);
+
+    if (!converted) {
+        JNU_ThrowByName(env, "java/awt/color/CMMException", errMsg);
+    }
 }
 
 static cmsBool _getHeaderInfo(cmsHPROFILE pf, jbyte* pBuffer, jint bufferSize)
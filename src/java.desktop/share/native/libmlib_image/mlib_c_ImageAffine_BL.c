@@ -65,6 +65,11 @@
 
 #include "mlib_ImageAffine.h"
 
+#if (defined(__SSE2__) || defined(_M_X64)) && MLIB_SHIFT == 16
+#include <emmintrin.h>
+#define MLIB_AFFINE_BL_SSE2
+#endif /* (defined(__SSE2__) || defined(_M_X64)) && MLIB_SHIFT == 16 */
+
 /***************************************************************/
 #define DTYPE  mlib_u8
 #define FTYPE  mlib_f32
@@ -261,6 +266,107 @@ mlib_status FUN_NAME(3ch)(mlib_affine_param *param)
 }
 
 /***************************************************************/
+#ifdef MLIB_AFFINE_BL_SSE2
+
+/* a + ((f * (b - a) + MLIB_ROUND) >> MLIB_SHIFT) in 16-bit lanes,
+ * where f is an unsigned 16-bit fraction.
+ */
+static __m128i mlib_ImageAffine_lerp_sse2(__m128i a,
+                                          __m128i b,
+                                          __m128i f)
+{
+  __m128i d = _mm_sub_epi16(b, a);
+  __m128i lo = _mm_mullo_epi16(f, d);
+  __m128i hi = _mm_mulhi_epi16(f, d);
+
+  /* mulhi takes f as signed, add d back where f >= 0x8000 */
+  hi = _mm_add_epi16(hi, _mm_and_si128(_mm_srai_epi16(f, 15), d));
+  return _mm_add_epi16(_mm_add_epi16(a, hi), _mm_srli_epi16(lo, 15));
+}
+
+/***************************************************************/
+/* Two pixels per step, the four channels of each in 16-bit lanes.
+ * Gives the same results as the COUNT() arithmetic below.
+ */
+mlib_status FUN_NAME(4ch)(mlib_affine_param *param)
+{
+  DECLAREVAR_BL();
+  DTYPE *dstLineEnd;
+  __m128i zero = _mm_setzero_si128();
+
+  for (j = yStart; j <= yFinish; j++) {
+    mlib_s32 fdx, fdy, fdx1, fdy1;
+    DTYPE *srcPixelPtr1;
+    __m128i r0, r1, r2, r3, a0, a1, a2, a3, fx, fy;
+
+    CLIP(4);
+    dstLineEnd = (DTYPE *) dstData + 4 * xRight;
+
+    for (; dstPixelPtr < dstLineEnd; dstPixelPtr += 8) {
+      fdx = X & MLIB_MASK;
+      fdy = Y & MLIB_MASK;
+      srcPixelPtr = MLIB_POINTER_GET(lineAddr, MLIB_POINTER_SHIFT(Y)) + 4 * (X >> MLIB_SHIFT);
+      X += dX;
+      Y += dY;
+      fdx1 = X & MLIB_MASK;
+      fdy1 = Y & MLIB_MASK;
+      srcPixelPtr1 = MLIB_POINTER_GET(lineAddr, MLIB_POINTER_SHIFT(Y)) + 4 * (X >> MLIB_SHIFT);
+      X += dX;
+      Y += dY;
+
+      /* a00 then a01 of each pixel, from the upper and the lower line */
+      r0 = _mm_unpacklo_epi8(_mm_loadl_epi64((__m128i *) srcPixelPtr), zero);
+      r1 = _mm_unpacklo_epi8(_mm_loadl_epi64((__m128i *) srcPixelPtr1), zero);
+      r2 = _mm_unpacklo_epi8(_mm_loadl_epi64((__m128i *) (srcPixelPtr + srcYStride)), zero);
+      r3 = _mm_unpacklo_epi8(_mm_loadl_epi64((__m128i *) (srcPixelPtr1 + srcYStride)), zero);
+      a0 = _mm_unpacklo_epi64(r0, r1);
+      a1 = _mm_unpackhi_epi64(r0, r1);
+      a2 = _mm_unpacklo_epi64(r2, r3);
+      a3 = _mm_unpackhi_epi64(r2, r3);
+
+      fx = _mm_set_epi16((short) fdx1, (short) fdx1, (short) fdx1, (short) fdx1,
+                         (short) fdx, (short) fdx, (short) fdx, (short) fdx);
+      fy = _mm_set_epi16((short) fdy1, (short) fdy1, (short) fdy1, (short) fdy1,
+                         (short) fdy, (short) fdy, (short) fdy, (short) fdy);
+
+      a0 = mlib_ImageAffine_lerp_sse2(a0, a2, fy);
+      a1 = mlib_ImageAffine_lerp_sse2(a1, a3, fy);
+      a0 = mlib_ImageAffine_lerp_sse2(a0, a1, fx);
+      _mm_storel_epi64((__m128i *) dstPixelPtr, _mm_packus_epi16(a0, a0));
+    }
+
+    if (dstPixelPtr <= dstLineEnd) {
+      mlib_s32 a00_0, a01_0, a10_0, a11_0;
+      mlib_s32 a00_1, a01_1, a10_1, a11_1;
+      mlib_s32 a00_2, a01_2, a10_2, a11_2;
+      mlib_s32 a00_3, a01_3, a10_3, a11_3;
+      mlib_s32 pix0_0, pix1_0, res0;
+      mlib_s32 pix0_1, pix1_1, res1;
+      mlib_s32 pix0_2, pix1_2, res2;
+      mlib_s32 pix0_3, pix1_3, res3;
+      DTYPE *srcPixelPtr2;
+
+      GET_POINTERS(4);
+      LOAD(0, 0, 4);
+      LOAD(1, 1, 5);
+      LOAD(2, 2, 6);
+      LOAD(3, 3, 7);
+      COUNT(0);
+      COUNT(1);
+      COUNT(2);
+      COUNT(3);
+      dstPixelPtr[0] = (DTYPE) res0;
+      dstPixelPtr[1] = (DTYPE) res1;
+      dstPixelPtr[2] = (DTYPE) res2;
+      dstPixelPtr[3] = (DTYPE) res3;
+    }
+  }
+
+  return MLIB_SUCCESS;
+}
+
+#else
+
 mlib_status FUN_NAME(4ch)(mlib_affine_param *param)
 {
   DECLAREVAR_BL();
@@ -325,4 +431,6 @@ mlib_status FUN_NAME(4ch)(mlib_affine_param *param)
   return MLIB_SUCCESS;
 }
 
+#endif /* MLIB_AFFINE_BL_SSE2 */
+
 /***************************************************************/
@@ -379,8 +379,14 @@ static int peekMem(void* pStream) {
 static void closeMem(void* pStream) {
 }
 
+/* Decoders read in small pieces, so give stdio a larger buffer to fill */
+#define SPLASH_FILE_BUFFER_SIZE (64 * 1024)
+
 int SplashStreamInitFile(SplashStream * pStream, const char* filename) {
     pStream->arg.stdio.f = fopen(filename, "rb");
+    if (pStream->arg.stdio.f != 0) {
+        setvbuf(pStream->arg.stdio.f, NULL, _IOFBF, SPLASH_FILE_BUFFER_SIZE);
+    }
     pStream->read = readFile;
     pStream->peek = peekFile;
     pStream->close = closeFile;
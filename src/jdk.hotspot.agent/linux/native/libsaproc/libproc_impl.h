@@ -101,6 +101,8 @@ struct core_data {
    // part of the class sharing workaround
    map_info*          class_share_maps;// class share maps in a linked list
    map_info**         map_array; // sorted (by vaddr) array of map_info pointers
+   char*              core_map;  // read-only mapping of the core file, or NULL
+   size_t             core_map_size; // size of the core file mapping
 };
 
 struct ps_prochandle {
@@ -30,6 +30,8 @@
 #include <stddef.h>
 #include <elf.h>
 #include <link.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "libproc_impl.h"
 #include "ps_core_common.h"
 #include "proc_service.h"
@@ -105,6 +107,26 @@ static bool sort_map_array(struct ps_prochandle* ph) {
 #define MIN(x, y) (((x) < (y))? (x): (y))
 #endif
 
+// map the whole core file read-only. Reads then only copy from the page
+// cache, which matters for heap walks that issue millions of small reads.
+// If the file can't be mapped, for example because it doesn't fit in the
+// address space, core_read_data falls back to pread.
+static void map_core_file(struct ps_prochandle* ph) {
+  struct stat st;
+  void* addr;
+
+  if (fstat(ph->core->core_fd, &st) != 0 || st.st_size <= 0) {
+    return;
+  }
+  addr = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, ph->core->core_fd, 0);
+  if (addr == MAP_FAILED) {
+    print_debug("can't mmap core file, reading it with pread\n");
+    return;
+  }
+  ph->core->core_map = (char*)addr;
+  ph->core->core_map_size = (size_t)st.st_size;
+}
+
 static bool core_read_data(struct ps_prochandle* ph, uintptr_t addr, char *buf, size_t size) {
    ssize_t resid = size;
    int page_size=sysconf(_SC_PAGE_SIZE);
@@ -124,7 +146,15 @@ static bool core_read_data(struct ps_prochandle* ph, uintptr_t addr, char *buf,
       len = MIN(resid, mp->memsz - mapoff);
       off = mp->offset + mapoff;
 
-      if ((len = pread(fd, buf, len, off)) <= 0) {
+      if (fd == ph->core->core_fd && ph->core->core_map != NULL) {
+         // segments of the core file itself are read from its mapping,
+         // without a system call for each request.
+         if (off < 0 || (size_t)off >= ph->core->core_map_size) {
+            break;
+         }
+         len = MIN(len, (ssize_t)(ph->core->core_map_size - off));
+         memcpy(buf, ph->core->core_map + off, len);
+      } else if ((len = pread(fd, buf, len, off)) <= 0) {
          break;
       }
 
@@ -760,6 +790,8 @@ Pgrab_core(const char* exec_file, const char* core_file) {
     goto err;
   }
 
+  map_core_file(ph);
+
   if ((ph->core->exec_fd = open(exec_file, O_RDONLY)) < 0) {
     print_debug("can't open executable file\n");
     goto err;
@@ -31,6 +31,7 @@
 #ifdef LINUX
 #include <elf.h>
 #include <link.h>
+#include <sys/mman.h>
 #include "proc_service.h"
 #include "salibelf.h"
 #endif
@@ -66,6 +67,12 @@
 static void close_files(struct ps_prochandle* ph) {
   lib_info* lib = NULL;
 
+#ifdef LINUX
+  // unmap core file
+  if (ph->core->core_map != NULL)
+    munmap(ph->core->core_map, ph->core->core_map_size);
+#endif
+
   // close core file descriptor
   if (ph->core->core_fd >= 0)
     close(ph->core->core_fd);
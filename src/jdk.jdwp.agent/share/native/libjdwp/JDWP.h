@@ -63,6 +63,15 @@
 #define JDWP_HIGHEST_COMMAND_SET 18
 #define JDWP_REQUEST_NONE        -1
 
+/*
+ * Command sets 128 and up are reserved by the JDWP specification for
+ * vendor-defined commands and extensions. They are not part of the
+ * generated JDWPCommands.h.
+ */
+#define JDWP_ThreadReferenceExt                 128
+#define JDWP_ThreadReferenceExt_BatchedFrames   1
+#define JDWP_HIGHEST_VENDOR_COMMAND_SET         JDWP_ThreadReferenceExt
+
 /* This typedef helps keep the event and error types straight. */
 typedef unsigned short jdwpError;
 typedef unsigned char  jdwpEvent;
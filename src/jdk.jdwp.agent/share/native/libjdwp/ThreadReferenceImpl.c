@@ -690,6 +690,181 @@ isVirtual(PacketInputStream *in, PacketOutputStream *out)
     return JNI_TRUE;
 }
 
+/*
+ * Returns the JDWP error to report for a thread in a batched request,
+ * JDWP_ERROR(NONE) if its frames can be returned.
+ */
+static jdwpError
+validateBatchedThread(jthread thread)
+{
+    jvmtiError error;
+    jint count;
+
+    if (thread == NULL || threadControl_isDebugThread(thread)) {
+        return JDWP_ERROR(INVALID_THREAD);
+    }
+    error = threadControl_suspendCount(thread, &count);
+    if (error != JVMTI_ERROR_NONE) {
+        return map2jdwpError(error);
+    }
+    if (count == 0) {
+        return JDWP_ERROR(THREAD_NOT_SUSPENDED);
+    }
+    return JDWP_ERROR(NONE);
+}
+
+/*
+ * Vendor extension: the frames of several suspended threads in one reply.
+ * The stack traces are taken with a single GetThreadListStackTraces call,
+ * so a debugger taking a snapshot of many threads needs one round trip
+ * instead of one ThreadReference.Frames command per thread.
+ *
+ * Command data: int threads, threadID[threads], int maxFrames (-1 for all).
+ * Reply data, for each requested thread in order: int error, int frames,
+ * and for each frame its frameID and location, as in ThreadReference.Frames.
+ */
+static jboolean
+batchedFrames(PacketInputStream *in, PacketOutputStream *out)
+{
+    JNIEnv *env;
+    jint threadCount;
+    jint maxFrames;
+
+    env = getEnv();
+
+    threadCount = inStream_readInt(in);
+    if (inStream_error(in)) {
+        return JNI_TRUE;
+    }
+    if (threadCount < 0) {
+        outStream_setError(out, JDWP_ERROR(ILLEGAL_ARGUMENT));
+        return JNI_TRUE;
+    }
+
+    WITH_LOCAL_REFS(env, threadCount + 1) {
+
+        jthread *threads;
+        jthread *validThreads;
+        jdwpError *errors;
+        jvmtiStackInfo *stackInfo;
+        jvmtiError error;
+        jint validCount;
+        jint i;
+
+        threads = NULL;
+        validThreads = NULL;
+        errors = NULL;
+        stackInfo = NULL;
+        error = JVMTI_ERROR_NONE;
+        validCount = 0;
+
+        if (threadCount > 0) {
+            threads = jvmtiAllocate(threadCount * (int)sizeof(jthread));
+            validThreads = jvmtiAllocate(threadCount * (int)sizeof(jthread));
+            errors = jvmtiAllocate(threadCount * (int)sizeof(jdwpError));
+            if (threads == NULL || validThreads == NULL || errors == NULL) {
+                outStream_setError(out, JDWP_ERROR(OUT_OF_MEMORY));
+                goto done;
+            }
+        }
+
+        for (i = 0; i < threadCount; i++) {
+            threads[i] = inStream_readThreadRef(env, in);
+            if (inStream_error(in)) {
+                goto done;
+            }
+        }
+        maxFrames = inStream_readInt(in);
+        if (inStream_error(in)) {
+            goto done;
+        }
+        if (maxFrames < -1) {
+            outStream_setError(out, JDWP_ERROR(ILLEGAL_ARGUMENT));
+            goto done;
+        }
+
+        for (i = 0; i < threadCount; i++) {
+            errors[i] = validateBatchedThread(threads[i]);
+            if (errors[i] == JDWP_ERROR(NONE)) {
+                validThreads[validCount++] = threads[i];
+            }
+        }
+
+        if (maxFrames == -1) {
+            /* The threads are suspended so their frame counts are stable. */
+            maxFrames = 0;
+            for (i = 0; i < validCount && error == JVMTI_ERROR_NONE; i++) {
+                jint count;
+
+                error = JVMTI_FUNC_PTR(gdata->jvmti,GetFrameCount)
+                                    (gdata->jvmti, validThreads[i], &count);
+                if (error == JVMTI_ERROR_NONE && count > maxFrames) {
+                    maxFrames = count;
+                }
+            }
+        }
+
+        if (error == JVMTI_ERROR_NONE && validCount > 0) {
+            error = JVMTI_FUNC_PTR(gdata->jvmti,GetThreadListStackTraces)
+                                (gdata->jvmti, validCount, validThreads,
+                                 maxFrames, &stackInfo);
+        }
+        if (error != JVMTI_ERROR_NONE) {
+            outStream_setError(out, map2jdwpError(error));
+            goto done;
+        }
+
+        (void)outStream_writeInt(out, threadCount);
+        validCount = 0;
+        for (i = 0; i < threadCount && error == JVMTI_ERROR_NONE; i++) {
+            jvmtiStackInfo *info;
+            jint index;
+
+            (void)outStream_writeInt(out, errors[i]);
+            if (errors[i] != JDWP_ERROR(NONE)) {
+                (void)outStream_writeInt(out, 0);
+                continue;
+            }
+
+            info = &stackInfo[validCount++];
+            (void)outStream_writeInt(out, info->frame_count);
+            for (index = 0; index < info->frame_count && error == JVMTI_ERROR_NONE; index++) {
+                WITH_LOCAL_REFS(env, 1) {
+                    jclass clazz;
+                    error = methodClass(info->frame_buffer[index].method, &clazz);
+
+                    if (error == JVMTI_ERROR_NONE) {
+                        FrameID frame = createFrameID(threads[i], index);
+                        outStream_writeFrameID(out, frame);
+                        writeCodeLocation(out, clazz, info->frame_buffer[index].method,
+                                          info->frame_buffer[index].location);
+                    }
+                } END_WITH_LOCAL_REFS(env);
+            }
+        }
+        if (error != JVMTI_ERROR_NONE) {
+            outStream_setError(out, map2jdwpError(error));
+        }
+
+    done:
+        if (stackInfo != NULL) {
+            jvmtiDeallocate(stackInfo);
+        }
+        if (errors != NULL) {
+            jvmtiDeallocate(errors);
+        }
+        if (validThreads != NULL) {
+            jvmtiDeallocate(validThreads);
+        }
+        if (threads != NULL) {
+            jvmtiDeallocate(threads);
+        }
+
+    } END_WITH_LOCAL_REFS(env);
+
+    return JNI_TRUE;
+}
+
 Command ThreadReference_Commands[] = {
     {name, "Name"},
     {suspend, "Suspend"},
@@ -709,3 +884,9 @@ Command ThreadReference_Commands[] = {
 };
 
 DEBUG_DISPATCH_DEFINE_CMDSET(ThreadReference)
+
+Command ThreadReferenceExt_Commands[] = {
+    {batchedFrames, "BatchedFrames"}
+};
+
+DEBUG_DISPATCH_DEFINE_CMDSET(ThreadReferenceExt)
@@ -26,3 +26,4 @@
 #include "debugDispatch.h"
 
 extern CommandSet ThreadReference_CmdSet;
+extern CommandSet ThreadReferenceExt_CmdSet;
@@ -63,8 +63,12 @@
 #define HASH_INIT_SIZE 512
 /* If element count exceeds HASH_EXPAND_SCALE*hash_size we expand & re-hash */
 #define HASH_EXPAND_SCALE 8
-/* Maximum hash table size (must be power of 2) */
-#define HASH_MAX_SIZE  (1024*HASH_INIT_SIZE)
+/* Maximum hash table size (must be power of 2). IDs are sequence numbers,
+ * so every bucket holds at most count/size nodes. The limit is large enough
+ * that the chains stay short even when a debugger references millions of
+ * objects, for example when inspecting a big collection.
+ */
+#define HASH_MAX_SIZE  (32*1024*HASH_INIT_SIZE)
 
 /* Map a key (ID) to a hash bucket */
 static jint
@@ -684,7 +688,8 @@ commonRef_compact(void)
 
     env = getEnv();
     debugMonitorEnter(gdata->refLock); {
-        if ( gdata->objectsByIDsize > 0 ) {
+        /* With pinAll in effect every node is strong and nothing can be collected. */
+        if ( gdata->objectsByIDsize > 0 && gdata->pinAllCount == 0 ) {
             /*
              * Walk through the id-based hash table. Detach any nodes
              * for which the ref has been collected.
@@ -54,13 +54,13 @@ debugDispatch_initialize(void)
      * Zero the table so that unknown CommandSets do not
      * cause random errors.
      */
-    cmdSetsArray = jvmtiAllocate((JDWP_HIGHEST_COMMAND_SET+1) * sizeof(CommandSet *));
+    cmdSetsArray = jvmtiAllocate((JDWP_HIGHEST_VENDOR_COMMAND_SET+1) * sizeof(CommandSet *));
 
     if (cmdSetsArray == NULL) {
         EXIT_ERROR(AGENT_ERROR_OUT_OF_MEMORY,"command set array");
     }
 
-    (void)memset(cmdSetsArray, 0, (JDWP_HIGHEST_COMMAND_SET+1) * sizeof(CommandSet *));
+    (void)memset(cmdSetsArray, 0, (JDWP_HIGHEST_VENDOR_COMMAND_SET+1) * sizeof(CommandSet *));
 
     /*
      * Create the level-two (Command) dispatch tables to the
@@ -84,6 +84,9 @@ debugDispatch_initialize(void)
     cmdSetsArray[JDWP_COMMAND_SET(StackFrame)] = &StackFrame_CmdSet;
     cmdSetsArray[JDWP_COMMAND_SET(ClassObjectReference)] = &ClassObjectReference_CmdSet;
     cmdSetsArray[JDWP_COMMAND_SET(ModuleReference)] = &ModuleReference_CmdSet;
+
+    /* Vendor extensions */
+    cmdSetsArray[JDWP_COMMAND_SET(ThreadReferenceExt)] = &ThreadReferenceExt_CmdSet;
 }
 
 void
@@ -98,7 +101,7 @@ debugDispatch_getHandler(int cmdSetNum, int cmdNum, const char **cmdSetName_p, c
     *cmdSetName_p = "<Invalid CommandSet>";
     *cmdName_p = "<Unknown Command>";
 
-    if (cmdSetNum > JDWP_HIGHEST_COMMAND_SET) {
+    if (cmdSetNum > JDWP_HIGHEST_VENDOR_COMMAND_SET) {
         return NULL;
     }
 
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "classfile/javaClasses.hpp"
+#include "runtime/os.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "unittest.hpp"
+
+// The serial String.hashCode() loop that java_lang_String::hash_code() must match.
+static unsigned int reference_hash(const jchar* s, int len) {
+  unsigned int h = 0;
+  for (int i = 0; i < len; i++) {
+    h = 31 * h + (unsigned int) s[i];
+  }
+  return h;
+}
+
+static unsigned int reference_hash(const jbyte* s, int len) {
+  unsigned int h = 0;
+  for (int i = 0; i < len; i++) {
+    h = 31 * h + (((unsigned int) s[i]) & 0xFF);
+  }
+  return h;
+}
+
+TEST(java_lang_String, hash_code_known_values) {
+  const jbyte latin1[] = { 'h', 'e', 'l', 'l', 'o' };
+  const jchar utf16[] = { 'h', 'e', 'l', 'l', 'o' };
+  // "hello".hashCode()
+  EXPECT_EQ(99162322u, java_lang_String::hash_code(latin1, 5));
+  EXPECT_EQ(99162322u, java_lang_String::hash_code(utf16, 5));
+  EXPECT_EQ(0u, java_lang_String::hash_code(latin1, 0));
+  EXPECT_EQ(0u, java_lang_String::hash_code(utf16, 0));
+}
+
+// All lengths around the four element steps, with elements that have the high
+// bit set, so that sign extension of jbyte would show.
+TEST(java_lang_String, hash_code_matches_serial_loop) {
+  const int max_len = 67;
+  jbyte bytes[max_len];
+  jchar chars[max_len];
+  for (int i = 0; i < max_len; i++) {
+    const int r = os::random();
+    bytes[i] = (jbyte) r;
+    chars[i] = (jchar) (r >> 8);
+  }
+  bytes[0] = (jbyte) 0xFF;
+  chars[0] = (jchar) 0xFFFF;
+  for (int len = 0; len <= max_len; len++) {
+    EXPECT_EQ(reference_hash(bytes, len), java_lang_String::hash_code(bytes, len)) << "length " << len;
+    EXPECT_EQ(reference_hash(chars, len), java_lang_String::hash_code(chars, len)) << "length " << len;
+  }
+}
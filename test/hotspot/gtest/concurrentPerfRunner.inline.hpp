@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef GTEST_CONCURRENT_PERF_RUNNER_INLINE_HPP
+#define GTEST_CONCURRENT_PERF_RUNNER_INLINE_HPP
+
+#include "memory/allocation.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/os.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/ostream.hpp"
+#include "utilities/quickSort.hpp"
+#include "threadHelper.inline.hpp"
+
+// This file contains a helper for micro-benchmarking concurrent data
+// structures from the gtest launcher.
+//
+// A benchmark BENCH is a class with the members
+//
+//   void setup(uint nthreads, size_t ops_per_thread);
+//   void op(Thread* current, uint id, size_t i);
+//   void teardown();
+//
+// ConcurrentPerfRunner runs BENCH::op ops_per_thread times in each of 1, 2,
+// 4, ... threads, up to the number of processors or max_threads. setup() and
+// teardown() are called in the test thread before and after each of these
+// runs. All threads are released at the same time, and for each run the
+// throughput, the latency percentiles of a sample of the operations, and the
+// speedup relative to the single threaded run are printed.
+//
+// Timings are only reported, never checked, since they depend on the machine
+// and on whatever else it is doing.
+
+struct ConcurrentPerfResult {
+  uint _threads;
+  size_t _ops;
+  jlong _elapsed_ns;
+  jlong _p50_ns;
+  jlong _p99_ns;
+  jlong _p999_ns;
+
+  double ops_per_ms() const {
+    return (double)_ops * NANOSECS_PER_MILLISEC / MAX2(_elapsed_ns, (jlong)1);
+  }
+};
+
+template<typename BENCH>
+class ConcurrentPerfRunner {
+  // One in this many operations has its latency measured. Reading the clock
+  // around every operation would dominate cheap operations.
+  static const size_t sample_interval = 16;
+
+  const char* _name;
+  size_t _ops_per_thread;
+  uint _max_threads;
+
+  static int compare_samples(jlong a, jlong b) {
+    return a < b ? -1 : (a > b ? 1 : 0);
+  }
+
+  static jlong percentile(const jlong* sorted, size_t length, double fraction) {
+    if (length == 0) {
+      return 0;
+    }
+    size_t index = (size_t)(fraction * (length - 1));
+    return sorted[index];
+  }
+
+  ConcurrentPerfResult run_threads(BENCH* bench, uint nthreads) {
+    const size_t ops = _ops_per_thread;
+    const size_t samples_per_thread = (ops + sample_interval - 1) / sample_interval;
+    const size_t nsamples = samples_per_thread * nthreads;
+    jlong* samples = NEW_C_HEAP_ARRAY(jlong, nsamples, mtTest);
+    jlong* elapsed = NEW_C_HEAP_ARRAY(jlong, nthreads, mtTest);
+    volatile uint ready = 0;
+    volatile bool go = false;
+
+    auto worker = [&](Thread* current, int id) {
+      jlong* my_samples = samples + samples_per_thread * id;
+      Atomic::inc(&ready);
+      while (!Atomic::load_acquire(&go)) {}
+      jlong start = os::javaTimeNanos();
+      for (size_t i = 0; i < ops; ++i) {
+        if ((i % sample_interval) == 0) {
+          jlong op_start = os::javaTimeNanos();
+          bench->op(current, (uint)id, i);
+          my_samples[i / sample_interval] = os::javaTimeNanos() - op_start;
+        } else {
+          bench->op(current, (uint)id, i);
+        }
+      }
+      elapsed[id] = os::javaTimeNanos() - start;
+    };
+
+    bench->setup(nthreads, ops);
+    {
+      TestThreadGroup<decltype(worker)> ttg(worker, nthreads);
+      ttg.doit();
+      while (Atomic::load_acquire(&ready) < nthreads) {}
+      Atomic::release_store(&go, true);
+      ttg.join();
+    }
+    bench->teardown();
+
+    ConcurrentPerfResult result;
+    result._threads = nthreads;
+    result._ops = ops * nthreads;
+    result._elapsed_ns = 0;
+    for (uint i = 0; i < nthreads; ++i) {
+      result._elapsed_ns = MAX2(result._elapsed_ns, elapsed[i]);
+    }
+    QuickSort::sort(samples, nsamples, compare_samples, false);
+    result._p50_ns = percentile(samples, nsamples, 0.50);
+    result._p99_ns = percentile(samples, nsamples, 0.99);
+    result._p999_ns = percentile(samples, nsamples, 0.999);
+
+    FREE_C_HEAP_ARRAY(jlong, elapsed);
+    FREE_C_HEAP_ARRAY(jlong, samples);
+    return result;
+  }
+
+  void print_result(const ConcurrentPerfResult& result, const ConcurrentPerfResult& baseline) const {
+    double speedup = result.ops_per_ms() / baseline.ops_per_ms();
+    tty->print_cr("%s: %2u threads %12.1f ops/ms speedup %5.2f efficiency %3.0f%%"
+                  " latency p50 " JLONG_FORMAT " ns p99 " JLONG_FORMAT " ns p99.9 " JLONG_FORMAT " ns",
+                  _name, result._threads, result.ops_per_ms(), speedup,
+                  speedup * 100.0 / result._threads,
+                  result._p50_ns, result._p99_ns, result._p999_ns);
+  }
+
+public:
+  ConcurrentPerfRunner(const char* name, size_t ops_per_thread, uint max_threads = 8) :
+    _name(name),
+    _ops_per_thread(ops_per_thread),
+    _max_threads(clamp<uint>((uint)os::processor_count(), 1, max_threads)) {}
+
+  // Runs bench with 1, 2, 4, ... threads, and finally with the maximum
+  // number of threads if that is not a power of 2.
+  void run(BENCH* bench) {
+    ConcurrentPerfResult baseline = run_threads(bench, 1);
+    print_result(baseline, baseline);
+    uint nthreads = 1;
+    while (nthreads < _max_threads) {
+      nthreads = MIN2(nthreads * 2, _max_threads);
+      print_result(run_threads(bench, nthreads), baseline);
+    }
+  }
+};
+
+#endif // GTEST_CONCURRENT_PERF_RUNNER_INLINE_HPP
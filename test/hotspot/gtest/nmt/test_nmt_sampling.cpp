@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "runtime/flags/flagSetting.hpp"
+#include "runtime/globals_extension.hpp"
+#include "services/mallocTracker.hpp"
+#include "unittest.hpp"
+
+// Allocations of 64 bytes with a mean distance of 1 byte between samples are
+// always sampled: the distance drawn is at most 22 bytes.
+TEST_VM(NMT, sampling_every_allocation) {
+  AutoSaveRestore<size_t> FLAG_GUARD(NativeMemoryTrackingSampleInterval);
+  FLAG_SET_CMDLINE(NativeMemoryTrackingSampleInterval, 1);
+  for (int i = 0; i < 1000; i++) {
+    EXPECT_TRUE(MallocTracker::should_sample(64));
+  }
+}
+
+// For allocations much smaller than the interval, the number of samples is
+// the number of bytes allocated divided by the interval. An allocation takes
+// at most one sample, so larger allocations are sampled less than that.
+static void test_sampling_rate(size_t interval, size_t size, size_t total) {
+  AutoSaveRestore<size_t> FLAG_GUARD(NativeMemoryTrackingSampleInterval);
+  FLAG_SET_CMDLINE(NativeMemoryTrackingSampleInterval, interval);
+  size_t samples = 0;
+  for (size_t allocated = 0; allocated < total; allocated += size) {
+    if (MallocTracker::should_sample(size)) {
+      samples++;
+    }
+  }
+  const size_t expected = total / interval;
+  EXPECT_GT(samples, expected * 3 / 4) << "size " << size;
+  EXPECT_LT(samples, expected * 5 / 4) << "size " << size;
+}
+
+TEST_VM(NMT, sampling_rate) {
+  const size_t interval = 4 * K;
+  const size_t total = 64 * M;
+  test_sampling_rate(interval, 16, total);
+  test_sampling_rate(interval, 64, total);
+  test_sampling_rate(interval, 256, total);
+}
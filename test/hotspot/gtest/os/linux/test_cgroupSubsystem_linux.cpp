@@ -151,6 +151,23 @@ TEST(cgroupTest, SubSystemFileLineContentsMultipleLinesSuccessCases) {
   EXPECT_EQ(x, 10001);
 }
 
+TEST(cgroupTest, SubSystemFileLineContentsPressure) {
+  TestController my_controller{};
+  const char* test_file = temp_file("cgroups");
+  double d = -1.0;
+  int err = 0;
+
+  fill_file(test_file, "some avg10=12.50 avg60=3.25 avg300=0.75 total=123456\n"
+                       "full avg10=1.00 avg60=0.50 avg300=0.10 total=6543\n");
+  err = subsystem_file_line_contents(&my_controller, test_file, "some", "avg10=%lf", &d);
+  EXPECT_EQ(err, 0);
+  EXPECT_DOUBLE_EQ(d, 12.50);
+
+  err = subsystem_file_line_contents(&my_controller, test_file, "full", "avg10=%lf", &d);
+  EXPECT_EQ(err, 0);
+  EXPECT_DOUBLE_EQ(d, 1.00);
+}
+
 TEST(cgroupTest, SubSystemFileLineContentsSingleLine) {
   TestController my_controller{};
   const char* test_file = temp_file("cgroups");
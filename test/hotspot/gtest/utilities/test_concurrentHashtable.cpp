@@ -1179,6 +1179,78 @@ TEST_VM(ConcurrentHashTable, concurrent_mt_bulk_delete) {
   mt_test_doer<Driver_BD_Thread>();
 }
 
+class MT_Grow_Thread : public JavaTestThread {
+  TestTable::GrowTask* _gt;
+  Semaphore run;
+
+  public:
+  MT_Grow_Thread(Semaphore* post)
+    : JavaTestThread(post) {}
+  virtual ~MT_Grow_Thread() {}
+  void main_run() {
+    run.wait();
+    while(_gt->do_task(this));
+  }
+
+  void set_grow_task(TestTable::GrowTask* gt) {
+    _gt = gt;
+    run.signal();
+  }
+};
+
+class Driver_Grow_Thread : public JavaTestThread {
+public:
+  Driver_Grow_Thread(Semaphore* post) : JavaTestThread(post) {
+  };
+  virtual ~Driver_Grow_Thread(){}
+
+  void main_run() {
+    Semaphore done(0);
+    TestTable* cht = new TestTable(10, 16, 2);
+    for (uintptr_t v = 1; v < 99999; v++ ) {
+      TestLookup tl(v);
+      EXPECT_TRUE(cht->insert(this, tl, v)) << "Inserting an unique value should work.";
+    }
+    size_t log2_size = cht->get_size_log2(this);
+
+    // Must create and start threads before acquiring mutex inside GrowTask.
+    MT_Grow_Thread* tt[4];
+    for (int i = 0; i < 4; i++) {
+      tt[i] = new MT_Grow_Thread(&done);
+      tt[i]->doit();
+    }
+
+    TestTable::GrowTask gt(cht, true /* mt */ );
+    EXPECT_TRUE(gt.prepare(this)) << "Uncontended prepare must work.";
+
+    for (int i = 0; i < 4; i++) {
+      tt[i]->set_grow_task(&gt);
+    }
+
+    for (uintptr_t v = 1; v < 99999; v++ ) {
+      TestLookup tl(v);
+      EXPECT_EQ(cht_get_copy(cht, this, tl), v) << "Getting a present value while growing should work.";
+    }
+
+    for (int i = 0; i < 4; i++) {
+      done.wait();
+    }
+
+    gt.done(this);
+
+    EXPECT_EQ(cht->get_size_log2(this), log2_size + 1) << "Table should have grown once.";
+    for (uintptr_t v = 1; v < 99999; v++ ) {
+      TestLookup tl(v);
+      EXPECT_EQ(cht_get_copy(cht, this, tl), v) << "Getting a present value after growing should work.";
+    }
+    delete cht;
+  }
+};
+
+TEST_VM(ConcurrentHashTable, concurrent_mt_grow) {
+  mt_test_doer<Driver_Grow_Thread>();
+}
+
 class CHTParallelScanTask: public WorkerTask {
   TestTable* _cht;
   TestTable::ScanTask* _scan_task;
@@ -0,0 +1,357 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/oopStorage.inline.hpp"
+#include "memory/allocation.inline.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/mutex.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "utilities/concurrentHashTable.inline.hpp"
+#include "utilities/filterQueue.inline.hpp"
+#include "utilities/globalCounter.inline.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/lockFreeStack.hpp"
+#include "utilities/nonblockingQueue.inline.hpp"
+#include "concurrentPerfRunner.inline.hpp"
+#include "unittest.hpp"
+
+#include <new>
+
+// These "tests" don't verify much. They are micro-benchmarks printing the
+// throughput, latency and scaling of the concurrent data structures used by
+// the GC and the runtime, see concurrentPerfRunner.inline.hpp. They are
+// disabled by default, run them with
+//   --gtest_also_run_disabled_tests --gtest_filter=ConcurrentPerf.*
+//
+// The lock-free stack and queue are subject to ABA if popped elements are
+// pushed again while other threads are popping, so the push and pop
+// benchmarks are run separately, and an element is never pushed twice
+// during a run.
+
+static const size_t perf_ops_per_thread = 20000;
+
+class ConcurrentPerfElement {
+  ConcurrentPerfElement* volatile _stack_next;
+  ConcurrentPerfElement* volatile _queue_next;
+
+public:
+  ConcurrentPerfElement() : _stack_next(), _queue_next() {}
+
+  static ConcurrentPerfElement* volatile* stack_next_ptr(ConcurrentPerfElement& e) {
+    return &e._stack_next;
+  }
+  static ConcurrentPerfElement* volatile* queue_next_ptr(ConcurrentPerfElement& e) {
+    return &e._queue_next;
+  }
+};
+
+typedef ConcurrentPerfElement PerfElement;
+typedef LockFreeStack<PerfElement, &PerfElement::stack_next_ptr> PerfStack;
+typedef NonblockingQueue<PerfElement, &PerfElement::queue_next_ptr> PerfQueue;
+
+// Owns the elements for one run, thread id gets [id * ops, (id + 1) * ops).
+class PerfElements {
+  PerfElement* _elements;
+  size_t _ops_per_thread;
+  size_t _count;
+
+public:
+  PerfElements() : _elements(nullptr), _ops_per_thread(0), _count(0) {}
+
+  void allocate(uint nthreads, size_t ops_per_thread) {
+    _ops_per_thread = ops_per_thread;
+    _count = nthreads * ops_per_thread;
+    _elements = NEW_C_HEAP_ARRAY(PerfElement, _count, mtTest);
+    for (size_t i = 0; i < _count; ++i) {
+      ::new (&_elements[i]) PerfElement();
+    }
+  }
+
+  void free() {
+    FREE_C_HEAP_ARRAY(PerfElement, _elements);
+    _elements = nullptr;
+  }
+
+  size_t count() const { return _count; }
+  PerfElement& at(size_t i) const { return _elements[i]; }
+  PerfElement& at(uint id, size_t i) const { return _elements[id * _ops_per_thread + i]; }
+};
+
+class LockFreeStackPushPerf {
+  PerfElements _elements;
+  PerfStack _stack;
+
+public:
+  void setup(uint nthreads, size_t ops_per_thread) {
+    _elements.allocate(nthreads, ops_per_thread);
+  }
+  void op(Thread* current, uint id, size_t i) {
+    _stack.push(_elements.at(id, i));
+  }
+  void teardown() {
+    EXPECT_EQ(_elements.count(), _stack.length());
+    _stack.pop_all();
+    _elements.free();
+  }
+};
+
+class LockFreeStackPopPerf {
+  PerfElements _elements;
+  PerfStack _stack;
+
+public:
+  void setup(uint nthreads, size_t ops_per_thread) {
+    _elements.allocate(nthreads, ops_per_thread);
+    for (size_t i = 0; i < _elements.count(); ++i) {
+      _stack.push(_elements.at(i));
+    }
+  }
+  void op(Thread* current, uint id, size_t i) {
+    _stack.pop();
+  }
+  void teardown() {
+    EXPECT_TRUE(_stack.empty());
+    _elements.free();
+  }
+};
+
+TEST_VM(ConcurrentPerf, DISABLED_lock_free_stack) {
+  LockFreeStackPushPerf push;
+  ConcurrentPerfRunner<LockFreeStackPushPerf>("LockFreeStack push", perf_ops_per_thread).run(&push);
+  LockFreeStackPopPerf pop;
+  ConcurrentPerfRunner<LockFreeStackPopPerf>("LockFreeStack pop", perf_ops_per_thread).run(&pop);
+}
+
+class NonblockingQueuePushPerf {
+  PerfElements _elements;
+  PerfQueue _queue;
+
+public:
+  void setup(uint nthreads, size_t ops_per_thread) {
+    _elements.allocate(nthreads, ops_per_thread);
+  }
+  void op(Thread* current, uint id, size_t i) {
+    _queue.push(_elements.at(id, i));
+  }
+  void teardown() {
+    EXPECT_EQ(_elements.count(), _queue.length());
+    _queue.take_all();
+    _elements.free();
+  }
+};
+
+class NonblockingQueuePopPerf {
+  PerfElements _elements;
+  PerfQueue _queue;
+
+public:
+  void setup(uint nthreads, size_t ops_per_thread) {
+    _elements.allocate(nthreads, ops_per_thread);
+    for (size_t i = 0; i < _elements.count(); ++i) {
+      _queue.push(_elements.at(i));
+    }
+  }
+  void op(Thread* current, uint id, size_t i) {
+    _queue.pop();
+  }
+  void teardown() {
+    EXPECT_TRUE(_queue.empty());
+    _elements.free();
+  }
+};
+
+TEST_VM(ConcurrentPerf, DISABLED_nonblocking_queue) {
+  NonblockingQueuePushPerf push;
+  ConcurrentPerfRunner<NonblockingQueuePushPerf>("NonblockingQueue push", perf_ops_per_thread).run(&push);
+  NonblockingQueuePopPerf pop;
+  ConcurrentPerfRunner<NonblockingQueuePopPerf>("NonblockingQueue pop", perf_ops_per_thread).run(&pop);
+}
+
+// Pushes are lock-free, but pops must be serialized by the caller. As with
+// handshakes, each thread pushes an item and then pops it under a lock, so
+// the queue stays short.
+class FilterQueuePerf {
+  FilterQueue<uintptr_t> _queue;
+  Mutex _lock;
+
+  struct Match {
+    uintptr_t _value;
+    Match(uintptr_t value) : _value(value) {}
+    bool operator()(uintptr_t value) { return value == _value; }
+  };
+
+public:
+  FilterQueuePerf() : _queue(), _lock(Mutex::nosafepoint, "FilterQueuePerf_lock") {}
+
+  void setup(uint nthreads, size_t ops_per_thread) {}
+  void op(Thread* current, uint id, size_t i) {
+    uintptr_t value = id + 1;
+    _queue.push(value);
+    Match match(value);
+    MutexLocker ml(&_lock, Mutex::_no_safepoint_check_flag);
+    EXPECT_EQ(value, _queue.pop(match));
+  }
+  void teardown() {
+    EXPECT_TRUE(_queue.is_empty());
+  }
+};
+
+TEST_VM(ConcurrentPerf, DISABLED_filter_queue) {
+  FilterQueuePerf perf;
+  ConcurrentPerfRunner<FilterQueuePerf>("FilterQueue push/pop", perf_ops_per_thread).run(&perf);
+}
+
+class GlobalCounterPerf {
+  volatile uintptr_t _value;
+
+public:
+  GlobalCounterPerf() : _value(0) {}
+
+  void setup(uint nthreads, size_t ops_per_thread) {}
+  void op(Thread* current, uint id, size_t i) {
+    GlobalCounter::CriticalSection cs(current);
+    Atomic::load_acquire(&_value);
+  }
+  void teardown() {}
+};
+
+TEST_VM(ConcurrentPerf, DISABLED_global_counter) {
+  GlobalCounterPerf perf;
+  ConcurrentPerfRunner<GlobalCounterPerf>("GlobalCounter read", perf_ops_per_thread).run(&perf);
+}
+
+class ConcurrentPerfTableConfig : public AllStatic {
+public:
+  typedef uintptr_t Value;
+  static uintx get_hash(const Value& value, bool* dead_hash) {
+    return (uintx)(value + 18446744073709551557ul) * 18446744073709551557ul;
+  }
+  static void* allocate_node(void* context, size_t size, const Value& value) {
+    return AllocateHeap(size, mtTest);
+  }
+  static void free_node(void* context, void* memory, const Value& value) {
+    FreeHeap(memory);
+  }
+};
+
+typedef ConcurrentHashTable<ConcurrentPerfTableConfig, mtTest> PerfTable;
+
+struct PerfTableLookup {
+  uintptr_t _value;
+  PerfTableLookup(uintptr_t value) : _value(value) {}
+  uintx get_hash() {
+    return ConcurrentPerfTableConfig::get_hash(_value, nullptr);
+  }
+  bool equals(const uintptr_t* value) {
+    return _value == *value;
+  }
+  bool is_dead(const uintptr_t* value) {
+    return false;
+  }
+};
+
+struct PerfTableFound {
+  uintptr_t _value;
+  PerfTableFound() : _value(0) {}
+  void operator()(uintptr_t* value) { _value = *value; }
+};
+
+// Large enough that the table never has to grow during a run.
+static const size_t perf_table_log2_size = 18;
+
+// Each thread inserts, or looks up, its own distinct keys.
+class ConcurrentHashTablePerf {
+  PerfTable* _table;
+  size_t _ops_per_thread;
+  bool _prefill;
+
+  uintptr_t key(uint id, size_t i) const {
+    return (uintptr_t)(id * _ops_per_thread + i + 1);
+  }
+
+public:
+  ConcurrentHashTablePerf(bool prefill) : _table(nullptr), _ops_per_thread(0), _prefill(prefill) {}
+
+  void setup(uint nthreads, size_t ops_per_thread) {
+    _ops_per_thread = ops_per_thread;
+    _table = new PerfTable(perf_table_log2_size, perf_table_log2_size);
+    if (_prefill) {
+      Thread* current = Thread::current();
+      for (uint id = 0; id < nthreads; ++id) {
+        for (size_t i = 0; i < ops_per_thread; ++i) {
+          PerfTableLookup lookup(key(id, i));
+          _table->insert(current, lookup, key(id, i));
+        }
+      }
+    }
+  }
+  void op(Thread* current, uint id, size_t i) {
+    PerfTableLookup lookup(key(id, i));
+    if (_prefill) {
+      PerfTableFound found;
+      _table->get(current, lookup, found);
+      EXPECT_EQ(key(id, i), found._value);
+    } else {
+      EXPECT_TRUE(_table->insert(current, lookup, key(id, i)));
+    }
+  }
+  void teardown() {
+    delete _table;
+    _table = nullptr;
+  }
+};
+
+TEST_VM(ConcurrentPerf, DISABLED_concurrent_hash_table) {
+  ConcurrentHashTablePerf insert(false);
+  ConcurrentPerfRunner<ConcurrentHashTablePerf>("ConcurrentHashTable insert", perf_ops_per_thread).run(&insert);
+  ConcurrentHashTablePerf get(true);
+  ConcurrentPerfRunner<ConcurrentHashTablePerf>("ConcurrentHashTable get", perf_ops_per_thread).run(&get);
+}
+
+class OopStoragePerf {
+  OopStorage* _storage;
+
+public:
+  OopStoragePerf() : _storage(nullptr) {}
+
+  void setup(uint nthreads, size_t ops_per_thread) {
+    _storage = OopStorage::create("ConcurrentPerf Storage", mtTest);
+  }
+  void op(Thread* current, uint id, size_t i) {
+    oop* ptr = _storage->allocate();
+    ASSERT_TRUE(ptr != nullptr);
+    _storage->release(ptr);
+  }
+  void teardown() {
+    EXPECT_EQ(0u, _storage->allocation_count());
+    delete _storage;
+    _storage = nullptr;
+  }
+};
+
+TEST_VM(ConcurrentPerf, DISABLED_oop_storage) {
+  OopStoragePerf perf;
+  ConcurrentPerfRunner<OopStoragePerf>("OopStorage allocate/release", perf_ops_per_thread).run(&perf);
+}
@@ -103,3 +103,33 @@ TEST_VM(utf8, jbyte_length) {
   }
 
 }
+
+TEST_VM(utf8, jbyte_non_ascii_positions) {
+  const int len = 40;
+  jbyte str[len];
+  char res[2 * len + 1];
+  const jbyte specials[] = { 0x00, (jbyte) 0xE9 };
+
+  for (size_t s = 0; s < ARRAY_SIZE(specials); s++) {
+    for (int pos = 0; pos < len; pos++) {
+      for (int i = 0; i < len; i++) {
+        str[i] = 'a' + (i % 26);
+      }
+      str[pos] = specials[s];
+
+      ASSERT_EQ(UNICODE::utf8_length(str, len), len + 1) << "one two-byte character at " << pos;
+
+      UNICODE::as_utf8(str, len, res, sizeof(res));
+      ASSERT_EQ(strlen(res), (size_t) len + 1) << "one two-byte character at " << pos;
+      for (int i = 0; i < pos; i++) {
+        ASSERT_EQ(res[i], str[i]) << "ASCII prefix must be copied";
+      }
+      const jchar c = ((jchar) specials[s]) & 0xff;
+      ASSERT_EQ((u_char) res[pos], (u_char) (0xC0 | (c >> 6)));
+      ASSERT_EQ((u_char) res[pos + 1], (u_char) (0x80 | (c & 0x3F)));
+      for (int i = pos + 1; i < len; i++) {
+        ASSERT_EQ(res[i + 1], str[i]) << "ASCII suffix must be copied";
+      }
+    }
+  }
+}
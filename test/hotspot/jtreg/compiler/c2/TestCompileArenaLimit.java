@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+/*
+ * @test
+ * @summary Compilations that grow their arenas past C2CompileArenaLimit are
+ *          retried without escape analysis and then given up, without
+ *          affecting the results of the program.
+ * @library /test/lib
+ * @requires vm.flagless & vm.compiler2.enabled
+ * @run driver compiler.c2.TestCompileArenaLimit
+ */
+
+package compiler.c2;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestCompileArenaLimit {
+    public static void main(String[] args) throws Exception {
+        ProcessBuilder pb = ProcessTools.createLimitedTestJavaProcessBuilder(
+                "-Xbatch", "-XX:-TieredCompilation",
+                "-XX:C2CompileArenaLimit=64K",
+                "-XX:CompileCommand=compileonly," + Test.class.getName() + "::test",
+                "-XX:+PrintCompilation",
+                Test.class.getName());
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        output.shouldContain("COMPILE SKIPPED: over C2CompileArenaLimit");
+        output.shouldContain("PASSED");
+    }
+
+    static class Test {
+        static int test(int[] a) {
+            int sum = 0;
+            for (int i = 0; i < a.length; i++) {
+                Integer boxed = a[i];
+                sum += (i & 1) == 0 ? boxed : -boxed;
+            }
+            return sum;
+        }
+
+        public static void main(String[] args) {
+            int[] a = new int[100];
+            int expected = 0;
+            for (int i = 0; i < a.length; i++) {
+                a[i] = i * 3;
+                expected += (i & 1) == 0 ? a[i] : -a[i];
+            }
+            for (int i = 0; i < 20_000; i++) {
+                int res = test(a);
+                if (res != expected) {
+                    throw new RuntimeException("Wrong result " + res + ", expected " + expected);
+                }
+            }
+            System.out.println("PASSED");
+        }
+    }
+}
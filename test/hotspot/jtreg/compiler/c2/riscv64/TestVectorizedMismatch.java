@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+/**
+ * @test
+ * @summary riscv64: check the RVV vectorizedMismatch stub against a scalar loop
+ *
+ * @requires os.arch == "riscv64" & vm.compiler2.enabled
+ * @run main/othervm -XX:+UseRVV -Xbatch -XX:-TieredCompilation
+ *      compiler.c2.riscv64.TestVectorizedMismatch
+ */
+
+package compiler.c2.riscv64;
+
+import java.util.Arrays;
+
+public class TestVectorizedMismatch {
+
+    private static final int MAX_LEN = 300;
+    private static final int ITERS   = 3;
+
+    public static void main(String args[]) {
+        for (int iter = 0; iter < ITERS; iter++) {
+            for (int offset = 0; offset < 8; offset++) {
+                testBytes(offset);
+                testChars(offset);
+                testInts(offset);
+                testLongs(offset);
+            }
+        }
+    }
+
+    private static void check(int expected, int actual, String type, int len, int offset) {
+        if (expected != actual) {
+            throw new RuntimeException(type + " mismatch: expected " + expected + " but got " + actual +
+                                       " for length " + len + " at offset " + offset);
+        }
+    }
+
+    // Unaligned slices of every length, equal and with a difference at each position.
+    private static void testBytes(int offset) {
+        byte[] a = new byte[MAX_LEN + offset];
+        byte[] b = new byte[MAX_LEN + offset];
+        for (int i = 0; i < a.length; i++) {
+            a[i] = b[i] = (byte) (i * 7);
+        }
+        for (int len = 0; len <= MAX_LEN; len++) {
+            check(-1, Arrays.mismatch(a, offset, offset + len, b, offset, offset + len), "byte", len, offset);
+            for (int pos = 0; pos < len; pos++) {
+                b[offset + pos]++;
+                check(pos, Arrays.mismatch(a, offset, offset + len, b, offset, offset + len), "byte", len, offset);
+                b[offset + pos]--;
+            }
+        }
+    }
+
+    private static void testChars(int offset) {
+        char[] a = new char[MAX_LEN + offset];
+        char[] b = new char[MAX_LEN + offset];
+        for (int i = 0; i < a.length; i++) {
+            a[i] = b[i] = (char) (i * 7);
+        }
+        for (int len = 0; len <= MAX_LEN; len++) {
+            check(-1, Arrays.mismatch(a, offset, offset + len, b, offset, offset + len), "char", len, offset);
+            for (int pos = 0; pos < len; pos++) {
+                b[offset + pos]++;
+                check(pos, Arrays.mismatch(a, offset, offset + len, b, offset, offset + len), "char", len, offset);
+                b[offset + pos]--;
+            }
+        }
+    }
+
+    private static void testInts(int offset) {
+        int[] a = new int[MAX_LEN + offset];
+        int[] b = new int[MAX_LEN + offset];
+        for (int i = 0; i < a.length; i++) {
+            a[i] = b[i] = i * 7;
+        }
+        for (int len = 0; len <= MAX_LEN; len++) {
+            check(-1, Arrays.mismatch(a, offset, offset + len, b, offset, offset + len), "int", len, offset);
+            for (int pos = 0; pos < len; pos++) {
+                // Only change the most significant byte of the element.
+                b[offset + pos] ^= 0x1000000;
+                check(pos, Arrays.mismatch(a, offset, offset + len, b, offset, offset + len), "int", len, offset);
+                b[offset + pos] ^= 0x1000000;
+            }
+        }
+    }
+
+    private static void testLongs(int offset) {
+        long[] a = new long[MAX_LEN + offset];
+        long[] b = new long[MAX_LEN + offset];
+        for (int i = 0; i < a.length; i++) {
+            a[i] = b[i] = i * 7L;
+        }
+        for (int len = 0; len <= MAX_LEN; len++) {
+            check(-1, Arrays.mismatch(a, offset, offset + len, b, offset, offset + len), "long", len, offset);
+            for (int pos = 0; pos < len; pos++) {
+                b[offset + pos] ^= Long.MIN_VALUE;
+                check(pos, Arrays.mismatch(a, offset, offset + len, b, offset, offset + len), "long", len, offset);
+                b[offset + pos] ^= Long.MIN_VALUE;
+            }
+        }
+    }
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+/*
+ * @test
+ * @summary A megamorphic call site whose receivers overflow every profile row
+ *          must not be treated as having an exact morphism. A polymorphic
+ *          call site that fits in the profile must still dispatch correctly,
+ *          also to a receiver that was not profiled.
+ * @requires vm.compiler2.enabled
+ *
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   -XX:CompileCommand=compileonly,compiler.inlining.TestMegamorphicCallProfile::test
+ *                   compiler.inlining.TestMegamorphicCallProfile
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:TypeProfileWidth=8
+ *                   -XX:CompileCommand=compileonly,compiler.inlining.TestMegamorphicCallProfile::test
+ *                   compiler.inlining.TestMegamorphicCallProfile
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:TypeProfileWidth=8
+ *                   -XX:CompileCommand=compileonly,compiler.inlining.TestMegamorphicCallProfile::test
+ *                   compiler.inlining.TestMegamorphicCallProfile 3
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:TypeProfileWidth=8
+ *                   -XX:CompileCommand=compileonly,compiler.inlining.TestMegamorphicCallProfile::test
+ *                   compiler.inlining.TestMegamorphicCallProfile 4
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:TypeProfileWidth=8
+ *                   -XX:CompileCommand=compileonly,compiler.inlining.TestMegamorphicCallProfile::test
+ *                   compiler.inlining.TestMegamorphicCallProfile 5
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:TypeProfileWidth=8
+ *                   -XX:CompileCommand=compileonly,compiler.inlining.TestMegamorphicCallProfile::test
+ *                   compiler.inlining.TestMegamorphicCallProfile 6
+ */
+
+package compiler.inlining;
+
+public class TestMegamorphicCallProfile {
+    static abstract class A { abstract int m(); }
+    static class B0 extends A { int m() { return 0; } }
+    static class B1 extends A { int m() { return 1; } }
+    static class B2 extends A { int m() { return 2; } }
+    static class B3 extends A { int m() { return 3; } }
+    static class B4 extends A { int m() { return 4; } }
+    static class B5 extends A { int m() { return 5; } }
+    static class B6 extends A { int m() { return 6; } }
+    static class B7 extends A { int m() { return 7; } }
+    static class B8 extends A { int m() { return 8; } }
+
+    static int test(A a) {
+        return a.m();
+    }
+
+    public static void main(String[] args) {
+        // By default more receivers than the widest profile can record, so
+        // the call site count keeps growing once all rows are taken.
+        A[] receivers = { new B0(), new B1(), new B2(), new B3(), new B4(),
+                          new B5(), new B6(), new B7(), new B8() };
+        int profiled = args.length > 0 ? Integer.parseInt(args[0]) : receivers.length;
+        for (int i = 0; i < 50_000; i++) {
+            check(receivers, i % profiled);
+        }
+        // Receivers that were not seen while profiling.
+        for (int i = profiled; i < receivers.length; i++) {
+            check(receivers, i);
+        }
+    }
+
+    static void check(A[] receivers, int expected) {
+        int result = test(receivers[expected]);
+        if (result != expected) {
+            throw new RuntimeException("Expected " + expected + " but got " + result);
+        }
+    }
+}
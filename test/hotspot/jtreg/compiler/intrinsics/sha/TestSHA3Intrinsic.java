@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+/*
+ * @test
+ * @summary Compare the digests of the SHA-3 intrinsics with the Java implementation
+ *          for all digest sizes and for lengths around the block boundaries.
+ * @requires os.arch == "amd64" | os.arch == "x86_64" | os.arch == "aarch64"
+ * @requires vm.flagless & vm.compiler2.enabled
+ * @library /test/lib
+ * @run driver compiler.intrinsics.sha.TestSHA3Intrinsic
+ */
+
+package compiler.intrinsics.sha;
+
+import java.security.MessageDigest;
+import java.util.HexFormat;
+
+import jdk.test.lib.Asserts;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestSHA3Intrinsic {
+    private static final String[] ALGORITHMS = { "SHA3-224", "SHA3-256", "SHA3-384", "SHA3-512" };
+    // Rates of the algorithms above, in bytes.
+    private static final int[] BLOCK_SIZES = { 144, 136, 104, 72 };
+    private static final int WARMUP = 20_000;
+
+    public static void main(String[] args) throws Exception {
+        if (args.length > 0) {
+            Digests.main(args);
+            return;
+        }
+        String intrinsic = digests("-XX:+UseSHA3Intrinsics");
+        String java = digests("-XX:-UseSHA3Intrinsics");
+        Asserts.assertEquals(intrinsic, java, "SHA-3 intrinsics and Java implementation disagree");
+    }
+
+    private static String digests(String flag) throws Exception {
+        ProcessBuilder pb = ProcessTools.createLimitedTestJavaProcessBuilder(
+                "-Xbatch", "-XX:+UnlockDiagnosticVMOptions", flag,
+                TestSHA3Intrinsic.class.getName(), "child");
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        return output.getStdout();
+    }
+
+    static class Digests {
+        public static void main(String[] args) throws Exception {
+            byte[] data = new byte[5 * BLOCK_SIZES[0]];
+            for (int i = 0; i < data.length; i++) {
+                data[i] = (byte)(i * 31 + 7);
+            }
+            // Get the compress stubs used from compiled code before printing.
+            for (int i = 0; i < WARMUP; i++) {
+                for (int a = 0; a < ALGORITHMS.length; a++) {
+                    digest(ALGORITHMS[a], data, 1 + i % 3, 3 * BLOCK_SIZES[a], BLOCK_SIZES[a]);
+                }
+            }
+            HexFormat hex = HexFormat.of();
+            for (int a = 0; a < ALGORITHMS.length; a++) {
+                int block = BLOCK_SIZES[a];
+                int[] lengths = { 0, 1, block - 1, block, block + 1,
+                                  2 * block - 1, 2 * block, 2 * block + 1,
+                                  3 * block, 4 * block + 15 };
+                for (int length : lengths) {
+                    for (int offset = 0; offset < 3; offset++) {
+                        // In one update, which compresses several blocks at a time,
+                        // and in pieces that straddle the block boundaries.
+                        for (int chunk : new int[] { length, 7, block - 1 }) {
+                            byte[] d = digest(ALGORITHMS[a], data, offset, length, Math.max(chunk, 1));
+                            System.out.println(ALGORITHMS[a] + " " + length + " " + offset + " " + chunk +
+                                               " " + hex.formatHex(d));
+                        }
+                    }
+                }
+            }
+        }
+
+        private static byte[] digest(String algorithm, byte[] data, int offset, int length, int chunk)
+                throws Exception {
+            MessageDigest md = MessageDigest.getInstance(algorithm);
+            for (int pos = 0; pos < length; pos += chunk) {
+                md.update(data, offset + pos, Math.min(chunk, length - pos));
+            }
+            return md.digest();
+        }
+    }
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+/**
+ * @test
+ * @summary Masked post loops of vectorized loops step by the vector length and
+ *          keep the original trip counter increment for its other users.
+ * @requires vm.compiler2.enabled & (os.arch == "amd64" | os.arch == "x86_64")
+ * @library /test/lib /
+ * @run driver compiler.loopopts.superword.TestMaskedPostLoop
+ */
+
+package compiler.loopopts.superword;
+
+import compiler.lib.ir_framework.*;
+
+public class TestMaskedPostLoop {
+
+    // Lengths around the vector lengths, so that the post loop runs with a
+    // full mask, a partial mask and not at all.
+    private static final int[] LENGTHS = { 0, 1, 7, 8, 9, 15, 16, 17, 31, 32, 33, 63, 64, 65, 100, 1000 };
+
+    public static void main(String[] args) {
+        TestFramework.runWithFlags("-XX:+UnlockExperimentalVMOptions", "-XX:+PostLoopMultiversioning");
+    }
+
+    @Test
+    @IR(counts = {IRNode.LOAD_VECTOR_MASKED, ">= 1", IRNode.STORE_VECTOR_MASKED, ">= 1"},
+        applyIfCPUFeature = {"avx512vl", "true"})
+    static void add(int[] a, int[] b) {
+        for (int i = 0; i < a.length; i++) {
+            b[i] = a[i] + 1;
+        }
+    }
+
+    @Run(test = "add")
+    static void runAdd() {
+        for (int len : LENGTHS) {
+            int[] a = new int[len];
+            int[] b = new int[len];
+            for (int i = 0; i < len; i++) {
+                a[i] = i * 3;
+            }
+            add(a, b);
+            for (int i = 0; i < len; i++) {
+                if (b[i] != a[i] + 1) {
+                    throw new RuntimeException("add: wrong value at " + i + " of " + len + ": " + b[i]);
+                }
+            }
+        }
+    }
+
+    // The load address uses the same "i + 1" node as the trip counter
+    // increment, it must not see the vector length stride of the post loop.
+    @Test
+    static void shift(int[] a, int[] b, int n) {
+        for (int i = 0; i < n; i++) {
+            b[i] = a[i + 1];
+        }
+    }
+
+    @Run(test = "shift")
+    static void runShift() {
+        for (int len : LENGTHS) {
+            int[] a = new int[len + 1];
+            int[] b = new int[len];
+            for (int i = 0; i <= len; i++) {
+                a[i] = i * 3;
+            }
+            shift(a, b, len);
+            for (int i = 0; i < len; i++) {
+                if (b[i] != a[i + 1]) {
+                    throw new RuntimeException("shift: wrong value at " + i + " of " + len + ": " + b[i]);
+                }
+            }
+        }
+    }
+}
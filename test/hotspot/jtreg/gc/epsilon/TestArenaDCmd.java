@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+package gc.epsilon;
+
+/**
+ * @test TestArenaDCmd
+ * @requires vm.gc.Epsilon
+ * @summary GC.epsilon_arena resets the heap to the mark only if nothing refers into the arena
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @run driver gc.epsilon.TestArenaDCmd
+ */
+
+import java.io.BufferedReader;
+import java.io.InputStreamReader;
+import java.io.PrintStream;
+
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestArenaDCmd {
+
+    public static void main(String[] args) throws Exception {
+        ProcessBuilder pb = ProcessTools.createTestJavaProcessBuilder(
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:+UseEpsilonGC",
+            "-XX:+EpsilonArenas",
+            "-Xmx256m",
+            Target.class.getName());
+        Process target = pb.start();
+        try {
+            BufferedReader out = new BufferedReader(new InputStreamReader(target.getInputStream()));
+            PrintStream in = new PrintStream(target.getOutputStream(), true);
+            expectLine(out, "ready");
+
+            PidJcmdExecutor jcmd = new PidJcmdExecutor(String.valueOf(target.pid()));
+            // Start the attach listener before the mark, its thread object lives forever.
+            jcmd.execute("VM.version");
+
+            jcmd.execute("GC.epsilon_arena reset").shouldContain("No arena mark");
+
+            // The target is blocked reading its input, it allocates nothing in the arena.
+            jcmd.execute("GC.epsilon_arena mark").shouldContain("Arena mark at");
+            jcmd.execute("GC.epsilon_arena reset").shouldContain("Arena reset released");
+
+            // The target keeps an object allocated after the mark.
+            jcmd.execute("GC.epsilon_arena mark").shouldContain("Arena mark at");
+            in.println("retain");
+            expectLine(out, "retained");
+            jcmd.execute("GC.epsilon_arena reset").shouldContain("Arena reset refused");
+
+            in.println("exit");
+            OutputAnalyzer output = new OutputAnalyzer(target);
+            output.shouldHaveExitValue(0);
+        } finally {
+            target.destroy();
+        }
+    }
+
+    private static void expectLine(BufferedReader out, String expected) throws Exception {
+        String line = out.readLine();
+        if (!expected.equals(line)) {
+            throw new RuntimeException("Expected \"" + expected + "\" from the target, got \"" + line + "\"");
+        }
+    }
+
+    public static class Target {
+        static Object retained;
+
+        public static void main(String[] args) throws Exception {
+            BufferedReader in = new BufferedReader(new InputStreamReader(System.in));
+            System.out.println("ready");
+            String line;
+            while ((line = in.readLine()) != null) {
+                if (line.equals("retain")) {
+                    retained = new int[1024];
+                    System.out.println("retained");
+                } else if (line.equals("exit")) {
+                    return;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+package gc.g1.pinnedobjs;
+
+/*
+ * @test
+ * @summary Regions with pinned objects must survive young collections and
+ *          Full GCs in place, even when they are mostly garbage.
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ * @build jdk.test.whitebox.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller jdk.test.whitebox.WhiteBox
+ * @run main/native/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *                          -XX:+UseG1GC -Xmx64m -XX:G1HeapRegionSize=1m -Xlog:gc
+ *                          gc.g1.pinnedobjs.TestPinnedSparseRegion
+ */
+
+import jdk.test.whitebox.WhiteBox;
+
+public class TestPinnedSparseRegion {
+    static { System.loadLibrary("TestPinnedSparseRegion"); }
+
+    private static final WhiteBox WB = WhiteBox.getWhiteBox();
+
+    private static final int LENGTH = 16;
+
+    // Pins the array with GetPrimitiveArrayCritical and holds it until unpin().
+    private static native void pin(int[] array);
+    private static native boolean isPinned();
+    private static native void unpin();
+    // Returns whether the array is still at the address it was pinned at.
+    private static native boolean hasNotMoved(int[] array);
+
+    public static volatile Object sink;
+
+    // Allocate the array followed by garbage, so that its region is sparse.
+    private static int[] allocateInSparseRegion() {
+        int[] array = new int[LENGTH];
+        for (int i = 0; i < LENGTH; i++) {
+            array[i] = i * 31;
+        }
+        for (int i = 0; i < 8 * 1024; i++) {
+            sink = new byte[96];
+        }
+        sink = null;
+        return array;
+    }
+
+    private static Thread startPinner(int[] array) throws InterruptedException {
+        Thread pinner = new Thread(() -> pin(array));
+        pinner.start();
+        while (!isPinned()) {
+            Thread.sleep(10);
+        }
+        return pinner;
+    }
+
+    private static void check(int[] array) {
+        if (!hasNotMoved(array)) {
+            throw new RuntimeException("Pinned array moved");
+        }
+        for (int i = 0; i < LENGTH; i++) {
+            if (array[i] != i * 31) {
+                throw new RuntimeException("Pinned array was overwritten at index " + i);
+            }
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        // A young collection fails the evacuation of the pinned region and
+        // keeps it as an old region. The next Full GC does not compact it.
+        int[] array = allocateInSparseRegion();
+        Thread pinner = startPinner(array);
+        WB.youngGC();
+        check(array);
+        WB.fullGC();
+        check(array);
+        unpin();
+        pinner.join();
+
+        // A Full GC does not compact a pinned young region either.
+        array = allocateInSparseRegion();
+        pinner = startPinner(array);
+        WB.fullGC();
+        check(array);
+        unpin();
+        pinner.join();
+
+        // Once unpinned, the regions can be collected normally again.
+        WB.youngGC();
+        WB.fullGC();
+    }
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include <jni.h>
+
+static void* volatile pinned_address = NULL;
+static volatile int release_pin = 0;
+
+JNIEXPORT void JNICALL Java_gc_g1_pinnedobjs_TestPinnedSparseRegion_pin
+  (JNIEnv *env, jclass cls, jintArray array)
+{
+    void* address = (*env)->GetPrimitiveArrayCritical(env, array, NULL);
+    if (address == NULL) {
+        return;
+    }
+    release_pin = 0;
+    pinned_address = address;
+
+    // Stay in the critical section, without further JNI calls, until released.
+    while (!release_pin) /* empty */;
+
+    pinned_address = NULL;
+    (*env)->ReleasePrimitiveArrayCritical(env, array, address, 0);
+}
+
+JNIEXPORT jboolean JNICALL Java_gc_g1_pinnedobjs_TestPinnedSparseRegion_isPinned
+  (JNIEnv *env, jclass cls)
+{
+    return pinned_address != NULL ? JNI_TRUE : JNI_FALSE;
+}
+
+JNIEXPORT void JNICALL Java_gc_g1_pinnedobjs_TestPinnedSparseRegion_unpin
+  (JNIEnv *env, jclass cls)
+{
+    release_pin = 1;
+}
+
+JNIEXPORT jboolean JNICALL Java_gc_g1_pinnedobjs_TestPinnedSparseRegion_hasNotMoved
+  (JNIEnv *env, jclass cls, jintArray array)
+{
+    void* address = (*env)->GetPrimitiveArrayCritical(env, array, NULL);
+    jboolean result = (address != NULL && address == pinned_address) ? JNI_TRUE : JNI_FALSE;
+    if (address != NULL) {
+        (*env)->ReleasePrimitiveArrayCritical(env, array, address, JNI_ABORT);
+    }
+    return result;
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+/*
+ * @test
+ * @summary The background class linker must not run while a CDS archive is dumped.
+ * @requires vm.cds
+ * @library /test/lib
+ * @run driver BackgroundLinkClassListDump
+ */
+
+import java.io.File;
+import java.nio.file.Files;
+import java.util.List;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class BackgroundLinkClassListDump {
+    public static void main(String[] args) throws Exception {
+        File classList = new File("BackgroundLinkClassListDump.classlist");
+        Files.write(classList.toPath(), List.of("java/lang/Object id: 0", "java/util/ArrayList id: 1"));
+
+        ProcessBuilder pb = ProcessTools.createLimitedTestJavaProcessBuilder(
+                "-Xshare:dump",
+                "-XX:SharedArchiveFile=BackgroundLinkClassListDump.jsa",
+                "-XX:SharedClassListFile=" + classList.getPath(),
+                "-XX:+UnlockExperimentalVMOptions",
+                "-XX:BackgroundLinkClassList=" + classList.getPath(),
+                "-Xlog:class+init=info",
+                "-version");
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        output.shouldContain("Background linking is disabled when dumping a CDS archive");
+        output.shouldNotContain("Background linking of");
+    }
+}
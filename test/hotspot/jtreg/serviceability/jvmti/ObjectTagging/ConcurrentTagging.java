@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+/*
+ * @test
+ * @summary SetTag and GetTag no longer take the tag map lock. Tag and read
+ *          tags from several threads while objects die and are collected,
+ *          and check the tags, GetObjectsWithTags and ObjectFree events.
+ * @requires vm.jvmti
+ * @library /test/lib
+ * @run main/othervm/native -agentlib:ConcurrentTagging ConcurrentTagging
+ */
+
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.atomic.AtomicBoolean;
+
+public class ConcurrentTagging {
+    private static final int THREADS = 4;
+    private static final int OBJECTS = 10_000;
+    private static final int ROUNDS = 5;
+
+    private static native void setTag(Object object, long tag);
+    private static native long getTag(Object object);
+    private static native int countObjectsWithTag(long tag);
+    private static native int freedCount();
+
+    private static long tagOf(int thread, int round, int index) {
+        return ((long)thread << 48) | ((long)round << 32) | (index + 1);
+    }
+
+    public static void main(String[] args) throws Exception {
+        List<Object>[] kept = new List[THREADS];
+        AtomicBoolean done = new AtomicBoolean();
+        Thread gc = new Thread(() -> {
+            while (!done.get()) {
+                System.gc();
+            }
+        });
+        gc.start();
+
+        Thread[] threads = new Thread[THREADS];
+        Throwable[] failures = new Throwable[THREADS];
+        for (int t = 0; t < THREADS; t++) {
+            final int thread = t;
+            kept[t] = new ArrayList<>();
+            threads[t] = new Thread(() -> {
+                try {
+                    for (int round = 0; round < ROUNDS; round++) {
+                        Object[] objects = new Object[OBJECTS];
+                        for (int i = 0; i < OBJECTS; i++) {
+                            objects[i] = new Object();
+                            setTag(objects[i], tagOf(thread, round, i));
+                        }
+                        for (int i = 0; i < OBJECTS; i++) {
+                            long tag = getTag(objects[i]);
+                            if (tag != tagOf(thread, round, i)) {
+                                throw new RuntimeException("Wrong tag " + tag + " for object " + i +
+                                                           " of thread " + thread + ", round " + round);
+                            }
+                        }
+                        // Retag every other object, clear the tag of some, and
+                        // keep one object per round alive.
+                        for (int i = 0; i < OBJECTS; i += 2) {
+                            setTag(objects[i], tagOf(thread, round, i) + OBJECTS);
+                            if (getTag(objects[i]) != tagOf(thread, round, i) + OBJECTS) {
+                                throw new RuntimeException("Retagging object " + i + " failed");
+                            }
+                        }
+                        for (int i = 1; i < OBJECTS; i += 4) {
+                            setTag(objects[i], 0);
+                            if (getTag(objects[i]) != 0) {
+                                throw new RuntimeException("Clearing the tag of object " + i + " failed");
+                            }
+                        }
+                        kept[thread].add(objects[0]);
+                    }
+                } catch (Throwable e) {
+                    failures[thread] = e;
+                }
+            });
+            threads[t].start();
+        }
+        for (Thread t : threads) {
+            t.join();
+        }
+        done.set(true);
+        gc.join();
+        for (Throwable failure : failures) {
+            if (failure != null) {
+                throw new RuntimeException(failure);
+            }
+        }
+
+        // Only the kept objects are alive, every other tagged object is freed.
+        int tagged = THREADS * ROUNDS * (OBJECTS - OBJECTS / 4);
+        int alive = THREADS * ROUNDS;
+        for (int t = 0; t < THREADS; t++) {
+            for (int round = 0; round < ROUNDS; round++) {
+                long tag = tagOf(t, round, 0) + OBJECTS;
+                if (countObjectsWithTag(tag) != 1) {
+                    throw new RuntimeException("Object with tag " + tag + " not found");
+                }
+                if (getTag(kept[t].get(round)) != tag) {
+                    throw new RuntimeException("Wrong tag for kept object " + round + " of thread " + t);
+                }
+            }
+        }
+        long deadline = System.currentTimeMillis() + 60_000;
+        while (freedCount() < tagged - alive) {
+            if (System.currentTimeMillis() > deadline) {
+                throw new RuntimeException("Only " + freedCount() + " of " + (tagged - alive) +
+                                           " ObjectFree events posted");
+            }
+            System.gc();
+            countObjectsWithTag(0x1L << 62); // Posts the pending ObjectFree events.
+            Thread.sleep(10);
+        }
+        if (freedCount() != tagged - alive) {
+            throw new RuntimeException(freedCount() + " ObjectFree events posted, expected " + (tagged - alive));
+        }
+    }
+}
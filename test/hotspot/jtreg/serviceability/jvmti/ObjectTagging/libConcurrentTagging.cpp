@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include <atomic>
+#include <string.h>
+#include "jvmti.h"
+#include "jvmti_common.h"
+
+extern "C" {
+
+static jvmtiEnv* jvmti = nullptr;
+static std::atomic<int> freed_count(0);
+
+static void JNICALL
+ObjectFree(jvmtiEnv* jvmti_env, jlong tag) {
+  freed_count++;
+}
+
+JNIEXPORT jint JNICALL
+Agent_OnLoad(JavaVM* jvm, char* options, void* reserved) {
+  if (jvm->GetEnv((void**)&jvmti, JVMTI_VERSION) != JNI_OK) {
+    LOG("Could not initialize JVMTI\n");
+    return JNI_ERR;
+  }
+  jvmtiCapabilities caps;
+  memset(&caps, 0, sizeof(caps));
+  caps.can_tag_objects = 1;
+  caps.can_generate_object_free_events = 1;
+  if (jvmti->AddCapabilities(&caps) != JVMTI_ERROR_NONE) {
+    LOG("Could not add capabilities\n");
+    return JNI_ERR;
+  }
+  jvmtiEventCallbacks callbacks;
+  memset(&callbacks, 0, sizeof(callbacks));
+  callbacks.ObjectFree = &ObjectFree;
+  if (jvmti->SetEventCallbacks(&callbacks, sizeof(callbacks)) != JVMTI_ERROR_NONE ||
+      jvmti->SetEventNotificationMode(JVMTI_ENABLE, JVMTI_EVENT_OBJECT_FREE, nullptr) != JVMTI_ERROR_NONE) {
+    LOG("Could not enable ObjectFree events\n");
+    return JNI_ERR;
+  }
+  return JNI_OK;
+}
+
+JNIEXPORT void JNICALL
+Java_ConcurrentTagging_setTag(JNIEnv* jni, jclass cls, jobject object, jlong tag) {
+  check_jvmti_status(jni, jvmti->SetTag(object, tag), "SetTag failed");
+}
+
+JNIEXPORT jlong JNICALL
+Java_ConcurrentTagging_getTag(JNIEnv* jni, jclass cls, jobject object) {
+  jlong tag = 0;
+  check_jvmti_status(jni, jvmti->GetTag(object, &tag), "GetTag failed");
+  return tag;
+}
+
+JNIEXPORT jint JNICALL
+Java_ConcurrentTagging_countObjectsWithTag(JNIEnv* jni, jclass cls, jlong tag) {
+  jint count = 0;
+  jobject* objects = nullptr;
+  check_jvmti_status(jni, jvmti->GetObjectsWithTags(1, &tag, &count, &objects, nullptr),
+                     "GetObjectsWithTags failed");
+  for (jint i = 0; i < count; i++) {
+    jni->DeleteLocalRef(objects[i]);
+  }
+  jvmti->Deallocate((unsigned char*)objects);
+  return count;
+}
+
+JNIEXPORT jint JNICALL
+Java_ConcurrentTagging_freedCount(JNIEnv* jni, jclass cls) {
+  return freed_count;
+}
+
+}
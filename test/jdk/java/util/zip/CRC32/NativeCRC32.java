@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+/*
+ * @test
+ * @summary Check the native CRC32 implementation against a table driven
+ *          one for short and unaligned buffers
+ * @run main/othervm -XX:+UnlockDiagnosticVMOptions -XX:-UseCRC32Intrinsics NativeCRC32
+ * @run main/othervm -Xint -XX:+UnlockDiagnosticVMOptions -XX:-UseCRC32Intrinsics NativeCRC32
+ */
+
+import java.nio.ByteBuffer;
+import java.util.Random;
+import java.util.zip.CRC32;
+
+public class NativeCRC32 {
+    private static final int[] TABLE = new int[256];
+    static {
+        for (int n = 0; n < 256; n++) {
+            int c = n;
+            for (int k = 0; k < 8; k++) {
+                c = (c & 1) != 0 ? 0xedb88320 ^ (c >>> 1) : c >>> 1;
+            }
+            TABLE[n] = c;
+        }
+    }
+
+    private static int reference(int crc, byte[] b, int off, int len) {
+        int c = ~crc;
+        for (int i = off; i < off + len; i++) {
+            c = TABLE[(c ^ b[i]) & 0xff] ^ (c >>> 8);
+        }
+        return ~c;
+    }
+
+    public static void main(String[] args) {
+        Random random = new Random(42);
+        byte[] data = new byte[1 << 16];
+        random.nextBytes(data);
+        ByteBuffer direct = ByteBuffer.allocateDirect(data.length);
+        direct.put(data);
+
+        // All lengths around the 16 and 64 byte folding thresholds, at every
+        // alignment, then random large lengths.
+        for (int off = 0; off < 32; off++) {
+            for (int len = 0; len <= 300; len++) {
+                check(data, direct, off, len);
+            }
+        }
+        for (int i = 0; i < 1000; i++) {
+            int off = random.nextInt(64);
+            int len = random.nextInt(data.length - off);
+            check(data, direct, off, len);
+        }
+    }
+
+    private static void check(byte[] data, ByteBuffer direct, int off, int len) {
+        // Seed the checksum with a prefix, so the folding starts from a
+        // non-trivial value.
+        int prefix = Math.min(off, 3);
+        int start = off - prefix;
+        int expected = reference(0, data, start, prefix + len);
+
+        CRC32 crc = new CRC32();
+        crc.update(data, start, prefix);
+        crc.update(data, off, len);
+        checkValue("byte[]", off, len, crc.getValue(), expected);
+
+        crc.reset();
+        crc.update(data, start, prefix);
+        crc.update(direct.slice(off, len));
+        checkValue("direct ByteBuffer", off, len, crc.getValue(), expected);
+
+        crc.reset();
+        crc.update(data, start, prefix);
+        crc.update(ByteBuffer.wrap(data, off, len));
+        checkValue("heap ByteBuffer", off, len, crc.getValue(), expected);
+    }
+
+    private static void checkValue(String kind, int off, int len, long actual, int expected) {
+        if (actual != (expected & 0xffffffffL)) {
+            throw new RuntimeException(kind + " offset " + off + " length " + len + ": got 0x" +
+                                       Long.toHexString(actual) + ", expected 0x" +
+                                       Integer.toHexString(expected));
+        }
+    }
+}
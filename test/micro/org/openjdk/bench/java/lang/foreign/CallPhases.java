@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.java.lang.foreign;
+
+import java.lang.foreign.*;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Level;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.TearDown;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.lang.invoke.MethodHandle;
+import java.lang.invoke.MethodType;
+import java.util.concurrent.TimeUnit;
+
+import static java.lang.invoke.MethodHandles.lookup;
+
+/**
+ * Splits the cost of downcalls and upcalls into their parts, using
+ * timestamps taken on the native side (rdtsc or cntvct, see libCallPhases.c).
+ * Each probe measures the time from the exit of the previous native call to
+ * its own entry:
+ *
+ * - stub: trivial to trivial, the downcall stub and Java glue only
+ * - transitionIn: trivial to normal, adds the thread state transition to native
+ * - transitionOut: normal to trivial, adds the transition back to Java
+ * - args10: trivial to trivial with 10 arguments, adds argument shuffling
+ * - upcallIn: native to the first statement of the Java callback
+ * - upcallOut: from that statement back to native, after the callback returns
+ *
+ * The JMH score is the time of the whole benchmark method. The native
+ * latency distributions are printed on stdout at the end of each trial.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@Warmup(iterations = 5, time = 500, timeUnit = TimeUnit.MILLISECONDS)
+@Measurement(iterations = 10, time = 500, timeUnit = TimeUnit.MILLISECONDS)
+@State(org.openjdk.jmh.annotations.Scope.Thread)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@Fork(value = 3, jvmArgsAppend = { "--enable-native-access=ALL-UNNAMED", "--enable-preview" })
+public class CallPhases extends CLayouts {
+
+    static final int STUB = 0;
+    static final int TRANSITION_IN = 1;
+    static final int TRANSITION_OUT = 2;
+    static final int ARGS10 = 3;
+    static final int UPCALL_IN = 4;
+    static final int UPCALL_OUT = 5;
+    static final String[] SLOT_NAMES = {
+        "stub", "transitionIn", "transitionOut", "args10", "upcallIn", "upcallOut"
+    };
+
+    static final Linker abi = Linker.nativeLinker();
+
+    static final MethodHandle MARK_TRIVIAL;
+    static final MethodHandle PROBE;
+    static final MethodHandle PROBE_TRIVIAL;
+    static final MethodHandle PROBE_ARGS10_TRIVIAL;
+    static final MethodHandle UPCALL;
+    static final MethodHandle RESET;
+    static final MethodHandle PRINT_HISTOGRAM;
+    static final MemorySegment CB;
+
+    static {
+        System.loadLibrary("CallPhases");
+        SymbolLookup lookup = SymbolLookup.loaderLookup();
+        MARK_TRIVIAL = abi.downcallHandle(lookup.find("mark").orElseThrow(),
+                FunctionDescriptor.ofVoid(), Linker.Option.isTrivial());
+        MemorySegment probe = lookup.find("probe").orElseThrow();
+        PROBE = abi.downcallHandle(probe, FunctionDescriptor.ofVoid(C_INT));
+        PROBE_TRIVIAL = abi.downcallHandle(probe, FunctionDescriptor.ofVoid(C_INT), Linker.Option.isTrivial());
+        PROBE_ARGS10_TRIVIAL = abi.downcallHandle(lookup.find("probe_args10").orElseThrow(),
+                FunctionDescriptor.ofVoid(C_INT,
+                        C_LONG_LONG, C_DOUBLE, C_LONG_LONG, C_DOUBLE, C_LONG_LONG,
+                        C_DOUBLE, C_LONG_LONG, C_DOUBLE, C_LONG_LONG, C_DOUBLE),
+                Linker.Option.isTrivial());
+        UPCALL = abi.downcallHandle(lookup.find("upcall").orElseThrow(),
+                FunctionDescriptor.ofVoid(C_INT, C_INT, C_POINTER));
+        RESET = abi.downcallHandle(lookup.find("reset").orElseThrow(), FunctionDescriptor.ofVoid());
+        PRINT_HISTOGRAM = abi.downcallHandle(lookup.find("print_histogram").orElseThrow(),
+                FunctionDescriptor.ofVoid(C_INT, C_POINTER));
+        try {
+            CB = abi.upcallStub(
+                    lookup().findStatic(CallPhases.class, "cb", MethodType.methodType(void.class, int.class)),
+                    FunctionDescriptor.ofVoid(C_INT), Arena.global());
+        } catch (ReflectiveOperationException e) {
+            throw new BootstrapMethodError(e);
+        }
+    }
+
+    static void cb(int slot) {
+        try {
+            PROBE_TRIVIAL.invokeExact(slot);
+        } catch (Throwable t) {
+            throw new AssertionError(t);
+        }
+    }
+
+    @Setup(Level.Iteration)
+    public void reset() throws Throwable {
+        // Only keep the samples of the last iteration, after warmup.
+        RESET.invokeExact();
+    }
+
+    @TearDown(Level.Trial)
+    public void printHistograms() throws Throwable {
+        try (Arena arena = Arena.ofConfined()) {
+            for (int slot = 0; slot < SLOT_NAMES.length; slot++) {
+                PRINT_HISTOGRAM.invokeExact(slot, arena.allocateUtf8String(SLOT_NAMES[slot]));
+            }
+        }
+    }
+
+    @Benchmark
+    public void stub() throws Throwable {
+        MARK_TRIVIAL.invokeExact();
+        PROBE_TRIVIAL.invokeExact(STUB);
+    }
+
+    @Benchmark
+    public void transitionIn() throws Throwable {
+        MARK_TRIVIAL.invokeExact();
+        PROBE.invokeExact(TRANSITION_IN);
+    }
+
+    @Benchmark
+    public void transitionOut() throws Throwable {
+        PROBE.invokeExact(-1);
+        PROBE_TRIVIAL.invokeExact(TRANSITION_OUT);
+    }
+
+    @Benchmark
+    public void args10() throws Throwable {
+        MARK_TRIVIAL.invokeExact();
+        PROBE_ARGS10_TRIVIAL.invokeExact(ARGS10, 1L, 2D, 3L, 4D, 5L, 6D, 7L, 8D, 9L, 10D);
+    }
+
+    @Benchmark
+    public void upcall() throws Throwable {
+        UPCALL.invokeExact(UPCALL_IN, UPCALL_OUT, CB);
+    }
+}
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef _WIN64
+#define EXPORT __declspec(dllexport)
+#include <windows.h>
+#include <intrin.h>
+#else
+#define EXPORT
+#include <time.h>
+#endif
+
+// Timestamps the native side of downcalls and upcalls with the cycle
+// counter, see CallPhases.java. Each probe records the ticks from the
+// exit of the previous probe (or mark) to its own entry. Not thread safe,
+// the benchmark runs in a single thread.
+
+#define SLOTS 8
+#define SAMPLES (1 << 18)
+
+static uint64_t samples[SLOTS][SAMPLES];
+static uint64_t counts[SLOTS];
+static uint64_t last;
+
+static inline uint64_t ticks(void) {
+#if defined(__x86_64__) || defined(_M_X64)
+    // rdtsc is not ordered with the instructions before it, lfence waits for
+    // them to complete, like isb does on aarch64.
+#ifdef _WIN64
+    _mm_lfence();
+    return __rdtsc();
+#else
+    uint32_t lo, hi;
+    __asm__ __volatile__ ("lfence; rdtsc" : "=a" (lo), "=d" (hi) : : "memory");
+    return ((uint64_t)hi << 32) | lo;
+#endif
+#elif defined(__aarch64__)
+    uint64_t t;
+    __asm__ __volatile__ ("isb; mrs %0, cntvct_el0" : "=r" (t));
+    return t;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+static uint64_t now_ns(void) {
+#ifdef _WIN64
+    LARGE_INTEGER count, freq;
+    QueryPerformanceCounter(&count);
+    QueryPerformanceFrequency(&freq);
+    return (uint64_t)((double)count.QuadPart * 1e9 / (double)freq.QuadPart);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+static inline void record(int slot, uint64_t delta) {
+    if (slot >= 0 && slot < SLOTS) {
+        samples[slot][counts[slot]++ % SAMPLES] = delta;
+    }
+}
+
+EXPORT void mark(void) {
+    last = ticks();
+}
+
+EXPORT void probe(int slot) {
+    record(slot, ticks() - last);
+    last = ticks();
+}
+
+EXPORT void probe_args10(int slot, long long a0, double a1, long long a2, double a3, long long a4,
+                         double a5, long long a6, double a7, long long a8, double a9) {
+    record(slot, ticks() - last);
+    last = ticks();
+}
+
+// cb is expected to call probe(in_slot) first thing.
+EXPORT void upcall(int in_slot, int out_slot, void (*cb)(int)) {
+    last = ticks();
+    cb(in_slot);
+    record(out_slot, ticks() - last);
+}
+
+EXPORT void reset(void) {
+    for (int i = 0; i < SLOTS; i++) {
+        counts[i] = 0;
+    }
+}
+
+static int compare(const void* a, const void* b) {
+    uint64_t x = *(const uint64_t*)a;
+    uint64_t y = *(const uint64_t*)b;
+    return x < y ? -1 : (x > y ? 1 : 0);
+}
+
+// Nanoseconds per tick, measured against the monotonic clock.
+static double calibrate(void) {
+    uint64_t ns0 = now_ns();
+    uint64_t t0 = ticks();
+    while (now_ns() - ns0 < 20000000) {}
+    uint64_t ns1 = now_ns();
+    uint64_t t1 = ticks();
+    return (double)(ns1 - ns0) / (double)(t1 - t0);
+}
+
+EXPORT void print_histogram(int slot, const char* name) {
+    if (slot < 0 || slot >= SLOTS || counts[slot] == 0) {
+        return;
+    }
+    size_t n = counts[slot] < SAMPLES ? (size_t)counts[slot] : SAMPLES;
+    uint64_t* s = samples[slot];
+    qsort(s, n, sizeof(uint64_t), compare);
+    double ns = calibrate();
+    printf("%-24s samples %8zu  min %7.1f  p50 %7.1f  p90 %7.1f  p99 %7.1f  p99.9 %7.1f  max %9.1f ns\n",
+           name, n, s[0] * ns, s[n / 2] * ns, s[n * 9 / 10] * ns, s[n * 99 / 100] * ns,
+           s[n * 999 / 1000] * ns, s[n - 1] * ns);
+    fflush(stdout);
+}
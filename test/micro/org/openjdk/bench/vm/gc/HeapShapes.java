@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.gc;
+
+import java.lang.management.GarbageCollectorMXBean;
+import java.lang.management.ManagementFactory;
+import java.lang.ref.SoftReference;
+import java.util.List;
+import java.util.concurrent.TimeUnit;
+
+import org.openjdk.jmh.annotations.AuxCounters;
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Level;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.TearDown;
+import org.openjdk.jmh.annotations.Warmup;
+import org.openjdk.jmh.infra.Blackhole;
+
+/**
+ * Measures collection pauses with a live heap of a controlled shape.
+ *
+ * The shape is built once per trial and then kept live:
+ * <ul>
+ * <li>linkedList: one long chain of small objects, marking cannot be parallelized
+ * <li>wideArrays: a few very wide object arrays that have to be split between workers
+ * <li>humongous: many large primitive arrays
+ * <li>softCache: a cache of SoftReferences, stressing reference processing
+ * <li>oldToYoung: an old object array whose slots are overwritten with new objects
+ * on every operation, filling the remembered sets or card table
+ * </ul>
+ *
+ * fullGC measures System.gc() on that heap. churn allocates short lived garbage,
+ * so the young collections happen during the measurement, and reports the number
+ * and total time of the collections per iteration as secondary results, from the
+ * GarbageCollectorMXBeans.
+ *
+ * Run with the collector to compare, and with -Xlog:gc+phases=debug for the per
+ * phase timings, e.g.
+ * -jvmArgsAppend "-XX:+UseG1GC -Xlog:gc+phases=debug:file=phases.log"
+ */
+@BenchmarkMode(Mode.AverageTime)
+@Warmup(iterations = 3, time = 2, timeUnit = TimeUnit.SECONDS)
+@Measurement(iterations = 5, time = 2, timeUnit = TimeUnit.SECONDS)
+@State(Scope.Thread)
+@OutputTimeUnit(TimeUnit.MICROSECONDS)
+@Fork(value = 3, jvmArgsAppend = {"-Xms2g", "-Xmx2g"})
+public class HeapShapes {
+
+    @Param({"linkedList", "wideArrays", "humongous", "softCache", "oldToYoung"})
+    String shape;
+
+    @Param({"256"})
+    int liveMB;
+
+    static final class Node {
+        Node next;
+        long payload;
+    }
+
+    Object live;
+    Object[] oldSlots;
+    boolean storeOldToYoung;
+    int slot;
+
+    @Setup(Level.Trial)
+    public void setup() {
+        long liveBytes = (long)liveMB * 1024 * 1024;
+        switch (shape) {
+            case "linkedList": {
+                // About 32 bytes per node with compressed oops.
+                Node head = null;
+                for (long i = 0; i < liveBytes / 32; i++) {
+                    Node n = new Node();
+                    n.next = head;
+                    head = n;
+                }
+                live = head;
+                break;
+            }
+            case "wideArrays": {
+                Object[][] arrays = new Object[4][];
+                int length = (int)(liveBytes / 4 / 20);
+                for (int i = 0; i < arrays.length; i++) {
+                    arrays[i] = new Object[length];
+                    for (int j = 0; j < length; j++) {
+                        arrays[i][j] = new Object();
+                    }
+                }
+                live = arrays;
+                break;
+            }
+            case "humongous": {
+                byte[][] arrays = new byte[(int)(liveBytes / (4 * 1024 * 1024))][];
+                for (int i = 0; i < arrays.length; i++) {
+                    arrays[i] = new byte[4 * 1024 * 1024];
+                }
+                live = arrays;
+                break;
+            }
+            case "softCache": {
+                SoftReference<?>[] refs = new SoftReference<?>[(int)(liveBytes / 1024)];
+                for (int i = 0; i < refs.length; i++) {
+                    refs[i] = new SoftReference<>(new byte[1000]);
+                }
+                live = refs;
+                break;
+            }
+            case "oldToYoung": {
+                live = null;
+                break;
+            }
+            default:
+                throw new IllegalArgumentException("Unknown shape: " + shape);
+        }
+        oldSlots = new Object[(int)(liveBytes / 4 / 20)];
+        storeOldToYoung = shape.equals("oldToYoung");
+        // Promote the shape and the slots array before measuring.
+        System.gc();
+        System.gc();
+    }
+
+    @TearDown(Level.Trial)
+    public void tearDown() {
+        live = null;
+        oldSlots = null;
+    }
+
+    @AuxCounters(AuxCounters.Type.EVENTS)
+    @State(Scope.Thread)
+    public static class Pauses {
+        public long gcCount;
+        public long gcTimeMs;
+
+        private long startCount;
+        private long startTimeMs;
+
+        private static long sum(boolean time) {
+            long result = 0;
+            List<GarbageCollectorMXBean> beans = ManagementFactory.getGarbageCollectorMXBeans();
+            for (GarbageCollectorMXBean bean : beans) {
+                result += Math.max(0, time ? bean.getCollectionTime() : bean.getCollectionCount());
+            }
+            return result;
+        }
+
+        @Setup(Level.Iteration)
+        public void start() {
+            gcCount = 0;
+            gcTimeMs = 0;
+            startCount = sum(false);
+            startTimeMs = sum(true);
+        }
+
+        @TearDown(Level.Iteration)
+        public void stop() {
+            gcCount = sum(false) - startCount;
+            gcTimeMs = sum(true) - startTimeMs;
+        }
+    }
+
+    @Benchmark
+    @BenchmarkMode(Mode.SingleShotTime)
+    @Warmup(iterations = 3)
+    @Measurement(iterations = 20)
+    @OutputTimeUnit(TimeUnit.MILLISECONDS)
+    public void fullGC() {
+        System.gc();
+    }
+
+    @Benchmark
+    public void churn(Pauses pauses, Blackhole bh) {
+        // 64 KB of garbage, plus one old-to-young pointer for the oldToYoung shape.
+        for (int i = 0; i < 64; i++) {
+            bh.consume(new byte[1000]);
+        }
+        if (storeOldToYoung) {
+            oldSlots[slot] = new Node();
+            slot = (slot + 4099) % oldSlots.length;
+        }
+    }
+}